@@ -1,8 +1,19 @@
 grammar sc_json;
 
+// Commands and answers are sent in text websocket frames (opcode 0x1) encoded in JSON or in binary websocket frames
+// (opcode 0x2) encoded in MessagePack. Encoding is chosen for every frame by its opcode, answers and sc-events
+// messages are sent in frames of the same kind as commands that caused them. Binary frame contains exactly one
+// MessagePack value with the same structure as JSON text described by this grammar:
+//   - answer is a map of 5 pairs in order "id", "event", "status", "errors", "payload";
+//   - keys, command types, identifiers and aliases are MessagePack strings;
+//   - SC_ADDR_HASH and SC_ADDR_TYPE values are MessagePack unsigned integers in the shortest form
+//     (positive fixint, uint 8, uint 16, uint 32 or uint 64), BOOL values are true and false;
+//   - "binary" link contents are base64 strings as in JSON.
+
 sc_json_text
   : sc_json_command
   | sc_json_command_answer
+  | sc_json_events_batch
   ;
 
 sc_json_command
@@ -21,9 +32,11 @@ sc_json_command_type_and_payload
   | sc_json_command_handle_keynodes
   | sc_json_command_handle_link_contents
   | sc_json_command_search_template
+  | sc_json_command_search_template_page
   | sc_json_command_generate_template
   | sc_json_command_handle_events
   | sc_json_command_answer_init_event
+  | sc_json_command_batch
   ;
 
 sc_json_command_answer
@@ -43,8 +56,10 @@ sc_json_command_answer_payload
   | sc_json_command_answer_handle_keynodes
   | sc_json_command_answer_handle_link_contents
   | sc_json_command_answer_search_template
+  | sc_json_command_answer_search_template_page
   | sc_json_command_answer_generate_template
   | sc_json_command_answer_handle_events
+  | sc_json_command_answer_batch
   ;
 
 sc_json_command_healthcheck
@@ -241,6 +256,16 @@ sc_json_command_search_template
     sc_json_command_template_payload
   ;
 
+// Search with "page_size" in template payload returns the first page and cursor of the next pages
+sc_json_command_search_template_page
+  : '"type"' ':' '"search_template_page"' ','
+    '"payload"' ':'
+    '{'
+        '"cursor"' ':' NUMBER ','
+        ('"cancel"' ':' BOOL ',')?
+    '}' ','
+  ;
+
 sc_json_command_template_payload
   : '"payload"' ':'
     '{'
@@ -288,6 +313,7 @@ sc_json_command_template_payload
         '{'
             (SC_ALIAS ':' (SC_ADDR_HASH | SC_ALIAS) ',')*
         '}' ','
+        ('"page_size"' ':' NUMBER ',')?
     '}' ','
   ;
 
@@ -311,6 +337,24 @@ sc_json_command_answer_search_template
     '}' ','
   ;
 
+// Cursor is null, if the returned page is the last one or search has been cancelled
+sc_json_command_answer_search_template_page
+  : '"payload"' ':'
+    '{'
+        '"addrs"' ':'
+        '['
+            ('['
+                (SC_ADDR_HASH ',')*
+            ']' ',')*
+        ']' ','
+        '"aliases"' ':'
+        '{'
+            (SC_ALIAS ':' NUMBER ',')*
+        '}' ','
+        '"cursor"' ':' (NUMBER | 'null') ','
+    '}' ','
+  ;
+
 sc_json_command_generate_template
   : '"type"' ':' '"generate_template"' ','
     sc_json_command_template_payload
@@ -330,6 +374,35 @@ sc_json_command_answer_generate_template
     '}' ','
   ;
 
+// Sub-requests are completed in order, "batch_ref" object is replaced with item of payload of previous sub-request
+// answer, or with whole payload if item index is omitted
+sc_json_command_batch
+  : '"type"' ':' '"batch"' ','
+    '"payload"' ':'
+    '['
+        ('{'
+            sc_json_command_type_and_payload
+        '}' ',')*
+    ']' ','
+  ;
+
+sc_json_batch_ref
+  : '{'
+        '"batch_ref"' ':' '[' NUMBER (',' NUMBER)? ']'
+    '}'
+  ;
+
+sc_json_command_answer_batch
+  : '"payload"' ':'
+    '['
+        ('{'
+            '"status"' ':' BOOL ','
+            '"errors"' ':' '[' (STRING_CONTENT ',')* ']' ','
+            sc_json_command_answer_payload
+        '}' ',')*
+    ']' ','
+  ;
+
 sc_json_command_handle_events
   : '"type"' ':' '"events"' ','
     '"payload"' ':'
@@ -363,6 +436,17 @@ sc_json_command_answer_init_event
     ']' ','
   ;
 
+// Sc-events messages of client are sent in one frame as array, if sc-server events_batch_interval is more than 0
+sc_json_events_batch
+  : '['
+        ('{'
+            '"id"' ':' NUMBER ','
+            '"status"' ':' BOOL ','
+            sc_json_command_answer_init_event
+        '}' ',')*
+    ']'
+  ;
+
 SC_LINK_CONTENT_TYPE
   : '"string"'
   | '"int"'
@@ -10,6 +10,8 @@
 #include <sc-common/sc_keynodes.h>
 #include <sc-common/sc_utils.h>
 
+#include <sc-core/sc-base/sc_allocator.h>
+
 #include "utils_keynodes.h"
 
 /*!
@@ -47,6 +49,11 @@ sc_result agent_erase_elements(sc_event_subscription const * event, sc_addr arg)
   sc_addr set_addr = sc_iterator5_value(get_set_it, 2);
   sc_iterator5_free(get_set_it);
 
+  // collect sc-elements of set before erasing them to erase them as one batch
+  sc_uint32 element_addrs_capacity = 16;
+  sc_uint32 element_addrs_count = 0;
+  sc_addr * element_addrs = sc_mem_new(sc_addr, element_addrs_capacity);
+
   sc_iterator3 * set_it = sc_iterator3_f_a_a_new(s_erase_elements_ctx, set_addr, 0, 0);
   while (sc_iterator3_next(set_it) == SC_TRUE)
   {
@@ -55,6 +62,7 @@ sc_result agent_erase_elements(sc_event_subscription const * event, sc_addr arg)
     if (SC_ADDR_IS_EQUAL(element_addr, action_addr))
     {
       sc_iterator3_free(set_it);
+      sc_mem_free(element_addrs);
       finish_action_unsuccessfully(s_erase_elements_ctx, action_addr);
       return SC_RESULT_ERROR;
     }
@@ -80,10 +88,22 @@ sc_result agent_erase_elements(sc_event_subscription const * event, sc_addr arg)
       }
     }
 
-    sc_memory_element_free(s_erase_elements_ctx, element_addr);
+    if (element_addrs_count == element_addrs_capacity)
+    {
+      element_addrs_capacity *= 2;
+      sc_addr * new_element_addrs = sc_mem_new(sc_addr, element_addrs_capacity);
+      sc_mem_cpy(new_element_addrs, element_addrs, element_addrs_count * sizeof(sc_addr));
+      sc_mem_free(element_addrs);
+      element_addrs = new_element_addrs;
+    }
+    element_addrs[element_addrs_count++] = element_addr;
   }
 
   sc_iterator3_free(set_it);
+
+  sc_memory_elements_free(s_erase_elements_ctx, element_addrs, element_addrs_count);
+  sc_mem_free(element_addrs);
+
   // @TODO: edge from finish_action_successfully to action doesn't create
   finish_action_successfully(s_erase_elements_ctx, action_addr);
   return SC_RESULT_OK;
@@ -18,7 +18,7 @@ typedef struct _sc_dictionary_node sc_dictionary_node;
 
 /*! Initializes sc-dictionary
  * @param[out] dictionary Pointer to a sc-dictionary pointer to initialize
- * @param[in] children_size SC-dictionary node children count
+ * @param[in] children_size SC-dictionary node children count, it is unused since children containers grow on demand
  * @param[in] char_to_int Pointer to function that converts sc_char to sc_uint8 and returns sc_uint8 mask
  * @returns Returns SC_TRUE, if sc-dictionary didn't exist; otherwise return SC_FALSE.
  */
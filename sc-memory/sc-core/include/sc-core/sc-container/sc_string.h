@@ -47,4 +47,6 @@
 
 #define sc_str_cmp(str, other) (strcmp(str, other) == 0)
 
+#define sc_str_n_cmp(str, other, size) (memcmp(str, other, size) == 0)
+
 #endif
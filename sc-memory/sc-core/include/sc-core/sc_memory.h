@@ -242,6 +242,33 @@ _SC_EXTERN sc_bool sc_memory_is_element_ext(sc_memory_context const * ctx, sc_ad
  */
 _SC_EXTERN sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr);
 
+/*!
+ * @brief Frees the memory occupied by sc-elements and all connected elements.
+ *
+ * This function works like `sc_memory_element_free` called for every specified sc-element, but erases them as one
+ * batch: the closure of connected sc-elements is computed once and sc-elements are freed grouped by segments.
+ * Permissions are checked for all sc-elements before any of them is erased.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs An array of sc-addrs of the sc-elements to be freed.
+ * @param count A count of sc-addrs in array.
+ *
+ * @return Returns SC_RESULT_OK if the operation executed successfully.
+ *
+ * @note The caller is responsible for handling any errors indicated by the result value.
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Some of specified sc-addrs are not valid. Other sc-elements are freed.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS The specified sc-memory context does not have
+ * erase permissions for some of sc-elements.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_ERASE_PERMISSIONS The specified sc-memory context
+ * does not have permissions to erase permissions of some of sc-elements.
+ */
+_SC_EXTERN sc_result sc_memory_elements_free(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count);
+
 /*!
  * @brief Generates a new sc-node with the specified type.
  *
@@ -794,6 +821,35 @@ _SC_EXTERN sc_result sc_memory_find_links_by_content_substring(
     sc_uint32 max_length_to_search_as_prefix,
     sc_list ** result_hashes);
 
+/*!
+ * @brief Finds sc-links with numeric contents in the specified range.
+ *
+ * This function searches for sc-links with contents that are numbers from the closed
+ * range [min_value; max_value]. The result is stored in the provided pointer to sc-list,
+ * containing the hash values of the sc-links in order of their values.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param min_value The minimal value of the range.
+ * @param max_value The maximal value of the range.
+ * @param result_hashes The list containing the hash values of sc-links with numeric contents
+ *                      from the specified range.
+ *
+ * @note Sc-link content is a number if its whole string is a finite decimal or hexadecimal number,
+ *       such contents are kept in ordered numeric index.
+ * @note This function is thread-safe.
+ *
+ * @return Returns an sc_result indicating the success or failure of the operation.
+ * Possible result values:
+ * @retval SC_RESULT_OK: The operation was successful.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO: An error occurred during file memory I/O.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ */
+_SC_EXTERN sc_result sc_memory_find_links_by_content_range(
+    sc_memory_context const * ctx,
+    sc_double min_value,
+    sc_double max_value,
+    sc_list ** result_hashes);
+
 /*!
  * @brief Finds sc-link contents containing the specified substring.
  *
@@ -854,6 +910,22 @@ _SC_EXTERN sc_result sc_memory_find_links_by_content_substring_ext(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*! Finds sc-links in the sc-memory that have numeric contents from the closed range.
+ * @param ctx Pointer to the sc-memory context.
+ * @param min_value The minimal value of the range.
+ * @param max_value The maximal value of the range.
+ * @param data Pointer to user-specific data.
+ * @param callback Callback function to be invoked for each matching link address found in order of values.
+ *                The callback function must have the signature: void callback(void * data, sc_addr const link_addr).
+ * @return Returns SC_RESULT_OK if the operation was successful; otherwise, returns an error code.
+ */
+_SC_EXTERN sc_result sc_memory_find_links_by_content_range_ext(
+    sc_memory_context const * ctx,
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr));
+
 /*! Finds sc-links in the sc-memory that have content containing a substring from the provided stream.
  * @param ctx Pointer to the sc-memory context.
  * @param stream Pointer to the stream containing the substring to search for.
@@ -894,6 +966,17 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring_ext(
  */
 _SC_EXTERN sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat);
 
+/*!
+ * @brief Gets count of sc-elements erased from sc-memory since it has been initialized.
+ *
+ * The count is only increased (and wraps around on overflow), so caches of found sc-elements can be checked by it at
+ * once: cached sc-elements still exist if the count hasn't changed since they have been cached.
+ *
+ * @return Returns count of erased sc-elements, or 0 if sc-memory isn't initialized.
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN sc_uint32 sc_memory_get_erased_elements_count();
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
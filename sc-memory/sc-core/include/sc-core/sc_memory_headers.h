@@ -15,5 +15,6 @@
 #include "sc-core/sc_stream.h"
 #include "sc-core/sc_stream_file.h"
 #include "sc-core/sc_stream_memory.h"
+#include "sc-core/sc_stream_mapped_file.h"
 
 #endif
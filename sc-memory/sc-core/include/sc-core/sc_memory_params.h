@@ -21,11 +21,15 @@
 #define DEFAULT_LOG_TYPE "Console"
 #define DEFAULT_LOG_FILE ""
 #define DEFAULT_LOG_LEVEL "Info"
+#define DEFAULT_PROFILE_TRACE_FILE ""
 #define DEFAULT_MAX_STRINGS_CHANNELS 10000
 #define DEFAULT_MAX_STRINGS_CHANNEL_SIZE 100000
 #define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 #define DEFAULT_TERM_SEPARATORS " _"
 #define DEFAULT_SEARCH_BY_SUBSTRING SC_TRUE
+#define DEFAULT_COMPACT_STRINGS SC_TRUE
+#define DEFAULT_COMPACT_STRINGS_PERIOD 3600
+#define DEFAULT_COMPACT_STRINGS_MIN_UNREFERENCED_PERCENT 30
 
 /*! Structure representing parameters for configuring the sc-memory.
  * @note This structure holds various configuration parameters that control the behavior of the sc-memory.
@@ -58,16 +62,29 @@ typedef struct
   sc_char const * log_file;   ///< Path to the log file (if log_type is "File").
   sc_char const * log_level;  ///< Log level (e.g., "Error", "Warning", "Info", "Debug").
 
+  sc_char const * profile_trace_file;  ///< Path to the Chrome trace file of startup and shutdown phases.
+
   sc_char const * init_memory_generated_structure;  ///< Initial sc-memory generated structure system identifier.
   sc_bool init_memory_generated_upload;  ///< Boolean indicating whether to upload the initial generated structure.
 
   sc_bool user_mode;  ///< Boolean indicating whether the sc-memory is in user mode.
 
+  ///< Boolean indicating whether the sc-memory is used by one thread only to build its binaries: sc-elements are laid
+  ///< out into sc-segments without synchronization and sc-events aren't emitted. It can't be used with extensions.
+  ///< By default, it is SC_FALSE.
+  sc_bool offline_build;
+
   sc_uint16 max_strings_channels;        ///< Maximum number of string channels.
   sc_uint32 max_strings_channel_size;    ///< Maximum size of a string channel.
   sc_uint32 max_searchable_string_size;  ///< Maximum size of a searchable string.
   sc_char const * term_separators;       ///< String containing term separators used in string operations.
   sc_bool search_by_substring;           ///< Boolean indicating whether to allow searching by substring.
+
+  ///< Boolean indicating whether to compact strings channels in background. By default, it is SC_TRUE.
+  sc_bool compact_strings;
+  sc_uint32 compact_strings_period;  ///< Period (in seconds) for checking strings channels to compact them.
+  ///< Minimal percent of strings channels size occupied by strings without sc-links to start compaction.
+  sc_uint8 compact_strings_min_unreferenced_percent;
 } sc_memory_params;
 
 _SC_EXTERN void sc_memory_params_clear(sc_memory_params * params);
@@ -113,4 +113,12 @@ _SC_EXTERN sc_bool sc_stream_check_flag(sc_stream const * stream, sc_uint8 flag)
  */
 _SC_EXTERN sc_bool sc_stream_get_data(sc_stream const * stream, sc_char ** data, sc_uint32 * size);
 
+/*! Get all data of stream without copying it
+ * @param stream Stream pointer to view data
+ * @param data Pointer to read-only data of stream. It is valid until stream is freed
+ * @param size Size of data
+ * @return If stream supports data view, then return SC_RESULT_OK; otherwise return SC_RESULT_ERROR
+ */
+_SC_EXTERN sc_result sc_stream_get_view(sc_stream const * stream, sc_char const ** data, sc_uint32 * size);
+
 #endif
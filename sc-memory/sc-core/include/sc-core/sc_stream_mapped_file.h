@@ -0,0 +1,26 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_stream_mapped_file_h_
+#define _sc_stream_mapped_file_h_
+
+#include "sc_stream.h"
+
+/*! Create read-only data stream over file mapped into memory
+ * @param file_name Path to file for streaming
+ * @remarks File data is not copied and isn't encoded. Use sc_stream_get_view function to get file data without
+ * copying. The returned stream pointer should be freed with sc_stream_free function, when done using it.
+ * @return Returns stream pointer if the stream was successfully created, or NULL if an error occurred
+ */
+_SC_EXTERN sc_stream * sc_stream_mapped_file_new(sc_char const * file_name);
+
+/*! Get path to file of mapped file data stream
+ * @param stream Stream pointer to get file path
+ * @return Returns path to mapped file if \p stream is a mapped file data stream, or NULL otherwise
+ */
+_SC_EXTERN sc_char const * sc_stream_mapped_file_get_path(sc_stream const * stream);
+
+#endif
@@ -30,8 +30,9 @@ typedef uint32_t sc_uint32;
 typedef int64_t sc_int64;
 typedef uint64_t sc_uint64;
 
-// Floating-point type
+// Floating-point types
 typedef float sc_float;
+typedef double sc_double;
 
 // Other types
 typedef unsigned long sc_ulong;  // This may vary in size between platforms
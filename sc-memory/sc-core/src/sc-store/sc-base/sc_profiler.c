@@ -0,0 +1,306 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-core/sc_platform.h"
+
+#if SC_IS_PLATFORM_LINUX && !defined(_GNU_SOURCE)
+#  define _GNU_SOURCE  // for RUSAGE_THREAD
+#endif
+
+#include "sc_profiler.h"
+
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_list.h"
+#include "sc-core/sc-container/sc_string.h"
+
+#include "sc_message.h"
+#include "sc_mutex_private.h"
+
+#define SC_PROFILER_PREFIX "[sc-profiler] "
+#define SC_PROFILER_TRACE_END "\n]}\n"
+
+#if defined(RUSAGE_THREAD)
+#  define SC_PROFILER_RUSAGE RUSAGE_THREAD
+#else
+#  define SC_PROFILER_RUSAGE RUSAGE_SELF
+#endif
+
+struct _sc_profiler_phase
+{
+  sc_char * name;
+  sc_uint32 thread_num;
+  gint64 begin_time;      // in microseconds from profiler initialization
+  gint64 begin_cpu_time;  // in microseconds, of thread if platform supports it, otherwise of process
+  gint64 wall_time;       // in microseconds
+  gint64 cpu_time;        // in microseconds
+  sc_uint64 peak_rss;     // in kilobytes
+  sc_bool is_finished;
+};
+
+typedef struct
+{
+  sc_char * trace_file_path;
+  sc_bool is_trace_created;
+  sc_bool has_trace_events;
+  sc_bool is_paused;
+  gint64 start_time;
+  sc_mutex mutex;
+  sc_list * phases;  // phases that aren't reported yet
+  sc_list * threads;  // threads are numbered in order of their first phases
+} sc_profiler;
+
+sc_profiler * profiler = null_ptr;
+
+void _sc_profiler_get_usage(gint64 * cpu_time, sc_uint64 * peak_rss)
+{
+  struct rusage usage;
+  if (getrusage(SC_PROFILER_RUSAGE, &usage) != 0)
+  {
+    *cpu_time = 0;
+    *peak_rss = 0;
+    return;
+  }
+
+  *cpu_time = ((gint64)usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 + usage.ru_utime.tv_usec
+              + usage.ru_stime.tv_usec;
+#if SC_IS_PLATFORM_MAC
+  *peak_rss = (sc_uint64)usage.ru_maxrss / 1024;  // in bytes on macOS
+#else
+  *peak_rss = (sc_uint64)usage.ru_maxrss;
+#endif
+}
+
+sc_uint32 _sc_profiler_get_thread_num()
+{
+  sc_pointer const thread = g_thread_self();
+
+  sc_uint32 thread_num = 0;
+  sc_iterator * it = sc_list_iterator(profiler->threads);
+  while (sc_iterator_next(it))
+  {
+    ++thread_num;
+    if (sc_iterator_get(it) == thread)
+    {
+      sc_iterator_destroy(it);
+      return thread_num;
+    }
+  }
+  sc_iterator_destroy(it);
+
+  sc_list_push_back(profiler->threads, thread);
+  return thread_num + 1;
+}
+
+void _sc_profiler_phase_free(sc_profiler_phase * phase)
+{
+  sc_mem_free(phase->name);
+  sc_mem_free(phase);
+}
+
+void sc_profiler_initialize(sc_char const * trace_file_path)
+{
+  if (profiler != null_ptr)
+    return;
+
+  profiler = sc_mem_new(sc_profiler, 1);
+  if (trace_file_path != null_ptr && *trace_file_path != '\0')
+    sc_str_cpy(profiler->trace_file_path, trace_file_path, sc_str_len(trace_file_path));
+  profiler->start_time = g_get_monotonic_time();
+  sc_mutex_init(&profiler->mutex);
+  sc_list_init(&profiler->phases);
+  sc_list_init(&profiler->threads);
+}
+
+void sc_profiler_shutdown()
+{
+  if (profiler == null_ptr)
+    return;
+
+  sc_iterator * it = sc_list_iterator(profiler->phases);
+  while (sc_iterator_next(it))
+    _sc_profiler_phase_free(sc_iterator_get(it));
+  sc_iterator_destroy(it);
+
+  sc_list_destroy(profiler->phases);
+  sc_list_destroy(profiler->threads);
+  sc_mutex_destroy(&profiler->mutex);
+  sc_mem_free(profiler->trace_file_path);
+  sc_mem_free(profiler);
+  profiler = null_ptr;
+}
+
+void sc_profiler_pause()
+{
+  if (profiler == null_ptr)
+    return;
+
+  sc_mutex_lock(&profiler->mutex);
+  profiler->is_paused = SC_TRUE;
+  sc_mutex_unlock(&profiler->mutex);
+}
+
+void sc_profiler_resume()
+{
+  if (profiler == null_ptr)
+    return;
+
+  sc_mutex_lock(&profiler->mutex);
+  profiler->is_paused = SC_FALSE;
+  sc_mutex_unlock(&profiler->mutex);
+}
+
+sc_profiler_phase * sc_profiler_phase_begin(sc_char const * name)
+{
+  if (profiler == null_ptr)
+    return null_ptr;
+
+  sc_profiler_phase * phase = sc_mem_new(sc_profiler_phase, 1);
+  sc_str_cpy(phase->name, name, sc_str_len(name));
+
+  sc_uint64 peak_rss;
+  _sc_profiler_get_usage(&phase->begin_cpu_time, &peak_rss);
+
+  sc_mutex_lock(&profiler->mutex);
+  if (profiler->is_paused == SC_TRUE)
+  {
+    sc_mutex_unlock(&profiler->mutex);
+    _sc_profiler_phase_free(phase);
+    return null_ptr;
+  }
+
+  phase->thread_num = _sc_profiler_get_thread_num();
+  phase->begin_time = g_get_monotonic_time() - profiler->start_time;
+  sc_list_push_back(profiler->phases, phase);
+  sc_mutex_unlock(&profiler->mutex);
+
+  return phase;
+}
+
+void sc_profiler_phase_end(sc_profiler_phase * phase)
+{
+  if (profiler == null_ptr || phase == null_ptr)
+    return;
+
+  gint64 cpu_time;
+  sc_uint64 peak_rss;
+  _sc_profiler_get_usage(&cpu_time, &peak_rss);
+
+  sc_mutex_lock(&profiler->mutex);
+  phase->wall_time = g_get_monotonic_time() - profiler->start_time - phase->begin_time;
+  phase->cpu_time = cpu_time - phase->begin_cpu_time;
+  phase->peak_rss = peak_rss;
+  phase->is_finished = SC_TRUE;
+  sc_mutex_unlock(&profiler->mutex);
+}
+
+void _sc_profiler_write_json_string(FILE * file, sc_char const * string)
+{
+  fputc('"', file);
+  for (sc_char const * c = string; *c != '\0'; ++c)
+  {
+    if (*c == '"' || *c == '\\')
+      fprintf(file, "\\%c", *c);
+    else if ((sc_uchar)*c < 0x20)
+      fprintf(file, "\\u%04x", (sc_uint32)(sc_uchar)*c);
+    else
+      fputc(*c, file);
+  }
+  fputc('"', file);
+}
+
+void _sc_profiler_write_trace()
+{
+  // finished phases are appended to trace written by previous reports, so trace file is valid after every report
+  FILE * file = fopen(profiler->trace_file_path, profiler->is_trace_created ? "r+" : "w");
+  if (file == null_ptr)
+  {
+    sc_warning(SC_PROFILER_PREFIX "Can't write trace file: %s", profiler->trace_file_path);
+    return;
+  }
+
+  if (profiler->is_trace_created)
+    fseek(file, -(long)(sizeof(SC_PROFILER_TRACE_END) - 1), SEEK_END);
+  else
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+  sc_iterator * it = sc_list_iterator(profiler->phases);
+  while (sc_iterator_next(it))
+  {
+    sc_profiler_phase * phase = sc_iterator_get(it);
+    if (phase->is_finished == SC_FALSE)
+      continue;
+
+    fprintf(file, "%s\n{\"name\":", profiler->has_trace_events ? "," : "");
+    _sc_profiler_write_json_string(file, phase->name);
+    fprintf(
+        file,
+        ",\"cat\":\"sc-memory\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%" PRId64 ",\"dur\":%" PRId64
+        ",\"args\":{\"cpu_time_us\":%" PRId64 ",\"peak_rss_kb\":%" PRIu64 "}}",
+        (sc_int32)getpid(),
+        phase->thread_num,
+        (int64_t)phase->begin_time,
+        (int64_t)phase->wall_time,
+        (int64_t)phase->cpu_time,
+        (uint64_t)phase->peak_rss);
+    profiler->has_trace_events = SC_TRUE;
+  }
+  sc_iterator_destroy(it);
+
+  fprintf(file, SC_PROFILER_TRACE_END);
+  profiler->is_trace_created = SC_TRUE;
+  if (fclose(file) != 0)
+    sc_warning(SC_PROFILER_PREFIX "Can't write trace file: %s", profiler->trace_file_path);
+}
+
+void sc_profiler_report(sc_char const * title)
+{
+  if (profiler == null_ptr)
+    return;
+
+  sc_mutex_lock(&profiler->mutex);
+
+  sc_message(SC_PROFILER_PREFIX "%s:", title);
+  sc_iterator * it = sc_list_iterator(profiler->phases);
+  while (sc_iterator_next(it))
+  {
+    sc_profiler_phase * phase = sc_iterator_get(it);
+    if (phase->is_finished == SC_FALSE)
+      continue;
+
+    sc_message(
+        "\t%s: wall %.3f ms, cpu %.3f ms, peak rss %" PRIu64 " KB",
+        phase->name,
+        phase->wall_time / 1000.0,
+        phase->cpu_time / 1000.0,
+        (uint64_t)phase->peak_rss);
+  }
+  sc_iterator_destroy(it);
+
+  if (profiler->trace_file_path != null_ptr)
+    _sc_profiler_write_trace();
+
+  // reported phases are freed, so profiler doesn't grow while sc-memory works
+  sc_list * unfinished_phases;
+  sc_list_init(&unfinished_phases);
+  it = sc_list_iterator(profiler->phases);
+  while (sc_iterator_next(it))
+  {
+    sc_profiler_phase * phase = sc_iterator_get(it);
+    if (phase->is_finished == SC_TRUE)
+      _sc_profiler_phase_free(phase);
+    else
+      sc_list_push_back(unfinished_phases, phase);
+  }
+  sc_iterator_destroy(it);
+  sc_list_destroy(profiler->phases);
+  profiler->phases = unfinished_phases;
+
+  sc_mutex_unlock(&profiler->mutex);
+}
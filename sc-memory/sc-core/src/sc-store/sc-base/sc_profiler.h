@@ -0,0 +1,57 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_profiler_h_
+#define _sc_profiler_h_
+
+#include "sc-core/sc_types.h"
+
+/*!
+ * Profiler of sc-memory startup and shutdown phases. It records wall time, CPU time and peak resident set size of
+ * process for every phase, logs summary of phases and writes them into file in Chrome trace format, that can be opened
+ * by chrome://tracing or Perfetto. Phases can be nested and they can be recorded by different threads. CPU time is
+ * measured for thread that records phase on Linux and for process on other platforms.
+ *
+ * If profiler isn't initialized or it is paused, then phases aren't recorded.
+ */
+typedef struct _sc_profiler_phase sc_profiler_phase;
+
+/*! Initializes profiler. Profiler that is already initialized isn't changed.
+ * @param trace_file_path A path to file to write phases in Chrome trace format. If it is null_ptr or empty, then phases
+ * are only logged.
+ */
+void sc_profiler_initialize(sc_char const * trace_file_path);
+
+/*! Frees profiler and all recorded phases.
+ */
+void sc_profiler_shutdown();
+
+/*! Pauses profiler, so phases started after it aren't recorded. Phases started before pause are recorded.
+ */
+void sc_profiler_pause();
+
+/*! Resumes profiler paused by `sc_profiler_pause`.
+ */
+void sc_profiler_resume();
+
+/*! Starts phase in current thread.
+ * @param name A name of phase. It is copied.
+ * @returns A pointer to started phase, that should be passed to `sc_profiler_phase_end`. If profiler isn't initialized
+ * or it is paused, then it returns null_ptr.
+ */
+sc_profiler_phase * sc_profiler_phase_begin(sc_char const * name);
+
+/*! Finishes phase.
+ * @param phase A pointer to phase started by `sc_profiler_phase_begin`. It can be null_ptr.
+ */
+void sc_profiler_phase_end(sc_profiler_phase * phase);
+
+/*! Logs summary of phases finished after previous report, appends them into trace file and frees them.
+ * @param title A title of summary.
+ */
+void sc_profiler_report(sc_char const * title);
+
+#endif
@@ -10,9 +10,7 @@
 #include "sc-core/sc-base/sc_allocator.h"
 #include "sc-core/sc-container/sc_string.h"
 
-#define SC_DICTIONARY_NODE_BUCKET_SIZE 16
-#define SC_DICTIONARY_GET_BUCKET_NUM(num) ((num) / SC_DICTIONARY_NODE_BUCKET_SIZE)
-#define SC_DICTIONARY_GET_CHILD_NUM(num) ((num) % SC_DICTIONARY_NODE_BUCKET_SIZE)
+#define SC_DICTIONARY_KEYS_COUNT 256
 
 #define SC_DICTIONARY_NODE_IS_VALID(__node) ((__node) != null_ptr)
 #define SC_DICTIONARY_NODE_IS_NOT_VALID(__node) ((__node) == null_ptr)
@@ -22,21 +20,22 @@ sc_bool sc_dictionary_initialize(
     sc_uint8 children_size,
     void (*char_to_int)(sc_char, sc_uint8 *, sc_uint8 const *))
 {
+  sc_unused(children_size);
+
   *dictionary = sc_mem_new(sc_dictionary, 1);
-  (*dictionary)->size = children_size;
-  (*dictionary)->root = _sc_dictionary_node_initialize(children_size);
+  (*dictionary)->root = _sc_dictionary_node_initialize();
   (*dictionary)->char_to_int = char_to_int;
   sc_monitor_init(&(*dictionary)->monitor);
 
   return SC_TRUE;
 }
 
-inline sc_dictionary_node * _sc_dictionary_node_initialize(sc_uint8 children_size)
+inline sc_dictionary_node * _sc_dictionary_node_initialize()
 {
   sc_dictionary_node * node = sc_mem_new(sc_dictionary_node, 1);
 
-  sc_uint64 const count = children_size / SC_DICTIONARY_NODE_BUCKET_SIZE + 1;
-  node->next = sc_mem_new(sc_dictionary_node **, count);
+  // children container is allocated with the first child
+  node->next = null_ptr;
 
   node->data = null_ptr;
   node->offset = null_ptr;
@@ -59,36 +58,276 @@ void _sc_dictionary_node_destroy(sc_dictionary_node * node)
   sc_mem_free(node);
 }
 
-void _sc_dictionary_up_destroy_node(
-    sc_dictionary const * dictionary,
-    sc_dictionary_node * node,
-    void (*node_clear)(sc_dictionary_node *))
+sc_dictionary_node * _sc_dictionary_node_find_child(sc_dictionary_node const * node, sc_uint8 const key)
 {
-  sc_dictionary_node ** next_bucket = null_ptr;
-  for (sc_uint8 num = 0, prev_bucket_idx = 0; num < dictionary->size; ++num)
+  sc_dictionary_children const * children = node->next;
+  if (children == null_ptr)
+    return null_ptr;
+
+  switch (children->type)
+  {
+  case SC_DICTIONARY_CHILDREN_4:
   {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    if (prev_bucket_idx != bucket_idx)
-      sc_mem_free(next_bucket);
-    prev_bucket_idx = bucket_idx;
+    sc_dictionary_children_4 const * children_4 = (sc_dictionary_children_4 const *)children;
+    for (sc_uint16 i = 0; i < children->count; ++i)
+    {
+      if (children_4->keys[i] == key)
+        return children_4->nodes[i];
+    }
+    return null_ptr;
+  }
 
-    next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
+  case SC_DICTIONARY_CHILDREN_16:
+  {
+    // keys are sorted, so binary search is used
+    sc_dictionary_children_16 const * children_16 = (sc_dictionary_children_16 const *)children;
+    sc_uint16 left = 0;
+    sc_uint16 right = children->count;
+    while (left < right)
+    {
+      sc_uint16 const middle = (left + right) / 2;
+      if (children_16->keys[middle] < key)
+        left = middle + 1;
+      else
+        right = middle;
+    }
+    return left < children->count && children_16->keys[left] == key ? children_16->nodes[left] : null_ptr;
+  }
 
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
-      continue;
+  case SC_DICTIONARY_CHILDREN_48:
+  {
+    sc_dictionary_children_48 const * children_48 = (sc_dictionary_children_48 const *)children;
+    sc_uint8 const index = children_48->indexes[key];
+    return index == 0 ? null_ptr : children_48->nodes[index - 1];
+  }
+
+  default:
+    return ((sc_dictionary_children_256 const *)children)->nodes[key];
+  }
+}
+
+void _sc_dictionary_children_sorted_insert(
+    sc_uint8 * keys,
+    sc_dictionary_node ** nodes,
+    sc_uint16 const count,
+    sc_uint8 const key,
+    sc_dictionary_node * child)
+{
+  sc_uint16 position = count;
+  while (position > 0 && keys[position - 1] > key)
+  {
+    keys[position] = keys[position - 1];
+    nodes[position] = nodes[position - 1];
+    --position;
+  }
+
+  keys[position] = key;
+  nodes[position] = child;
+}
+
+sc_dictionary_children * _sc_dictionary_children_grow(sc_dictionary_children * children)
+{
+  sc_dictionary_children * grown_children = null_ptr;
+
+  switch (children->type)
+  {
+  case SC_DICTIONARY_CHILDREN_4:
+  {
+    sc_dictionary_children_4 * children_4 = (sc_dictionary_children_4 *)children;
+    sc_dictionary_children_16 * children_16 = sc_mem_new(sc_dictionary_children_16, 1);
+    sc_mem_cpy(children_16->keys, children_4->keys, children->count * sizeof(sc_uint8));
+    sc_mem_cpy(children_16->nodes, children_4->nodes, children->count * sizeof(sc_dictionary_node *));
+    grown_children = (sc_dictionary_children *)children_16;
+    grown_children->type = SC_DICTIONARY_CHILDREN_16;
+    break;
+  }
+
+  case SC_DICTIONARY_CHILDREN_16:
+  {
+    sc_dictionary_children_16 * children_16 = (sc_dictionary_children_16 *)children;
+    sc_dictionary_children_48 * children_48 = sc_mem_new(sc_dictionary_children_48, 1);
+    for (sc_uint16 i = 0; i < children->count; ++i)
+    {
+      children_48->indexes[children_16->keys[i]] = i + 1;
+      children_48->nodes[i] = children_16->nodes[i];
+    }
+    grown_children = (sc_dictionary_children *)children_48;
+    grown_children->type = SC_DICTIONARY_CHILDREN_48;
+    break;
+  }
+
+  default:
+  {
+    sc_dictionary_children_48 * children_48 = (sc_dictionary_children_48 *)children;
+    sc_dictionary_children_256 * children_256 = sc_mem_new(sc_dictionary_children_256, 1);
+    for (sc_uint16 key = 0; key < SC_DICTIONARY_KEYS_COUNT; ++key)
+    {
+      sc_uint8 const index = children_48->indexes[key];
+      if (index != 0)
+        children_256->nodes[key] = children_48->nodes[index - 1];
+    }
+    grown_children = (sc_dictionary_children *)children_256;
+    grown_children->type = SC_DICTIONARY_CHILDREN_256;
+    break;
+  }
+  }
+
+  grown_children->count = children->count;
+  sc_mem_free(children);
+
+  return grown_children;
+}
+
+sc_bool _sc_dictionary_children_is_full(sc_dictionary_children const * children)
+{
+  switch (children->type)
+  {
+  case SC_DICTIONARY_CHILDREN_4:
+    return children->count == 4;
+  case SC_DICTIONARY_CHILDREN_16:
+    return children->count == 16;
+  case SC_DICTIONARY_CHILDREN_48:
+    return children->count == 48;
+  default:
+    return SC_FALSE;
+  }
+}
+
+void _sc_dictionary_node_add_child(sc_dictionary_node * node, sc_uint8 const key, sc_dictionary_node * child)
+{
+  if (node->next == null_ptr)
+  {
+    node->next = (sc_dictionary_children *)sc_mem_new(sc_dictionary_children_4, 1);
+    node->next->type = SC_DICTIONARY_CHILDREN_4;
+  }
+  else if (_sc_dictionary_children_is_full(node->next))
+    node->next = _sc_dictionary_children_grow(node->next);
+
+  sc_dictionary_children * children = node->next;
+  switch (children->type)
+  {
+  case SC_DICTIONARY_CHILDREN_4:
+  {
+    sc_dictionary_children_4 * children_4 = (sc_dictionary_children_4 *)children;
+    _sc_dictionary_children_sorted_insert(children_4->keys, children_4->nodes, children->count, key, child);
+    break;
+  }
+
+  case SC_DICTIONARY_CHILDREN_16:
+  {
+    sc_dictionary_children_16 * children_16 = (sc_dictionary_children_16 *)children;
+    _sc_dictionary_children_sorted_insert(children_16->keys, children_16->nodes, children->count, key, child);
+    break;
+  }
+
+  case SC_DICTIONARY_CHILDREN_48:
+  {
+    sc_dictionary_children_48 * children_48 = (sc_dictionary_children_48 *)children;
+    children_48->nodes[children->count] = child;
+    children_48->indexes[key] = children->count + 1;
+    break;
+  }
+
+  default:
+    ((sc_dictionary_children_256 *)children)->nodes[key] = child;
+    break;
+  }
+
+  ++children->count;
+}
+
+void _sc_dictionary_node_replace_child(sc_dictionary_node * node, sc_uint8 const key, sc_dictionary_node * child)
+{
+  sc_dictionary_children * children = node->next;
+
+  switch (children->type)
+  {
+  case SC_DICTIONARY_CHILDREN_4:
+  case SC_DICTIONARY_CHILDREN_16:
+  {
+    sc_uint8 * keys = children->type == SC_DICTIONARY_CHILDREN_4 ? ((sc_dictionary_children_4 *)children)->keys
+                                                                 : ((sc_dictionary_children_16 *)children)->keys;
+    sc_dictionary_node ** nodes = children->type == SC_DICTIONARY_CHILDREN_4
+                                      ? ((sc_dictionary_children_4 *)children)->nodes
+                                      : ((sc_dictionary_children_16 *)children)->nodes;
+    for (sc_uint16 i = 0; i < children->count; ++i)
+    {
+      if (keys[i] == key)
+      {
+        nodes[i] = child;
+        break;
+      }
+    }
+    break;
+  }
+
+  case SC_DICTIONARY_CHILDREN_48:
+  {
+    sc_dictionary_children_48 * children_48 = (sc_dictionary_children_48 *)children;
+    children_48->nodes[children_48->indexes[key] - 1] = child;
+    break;
+  }
+
+  default:
+    ((sc_dictionary_children_256 *)children)->nodes[key] = child;
+    break;
+  }
+}
+
+sc_dictionary_node * _sc_dictionary_node_next_child(sc_dictionary_node const * node, sc_uint16 * position)
+{
+  sc_dictionary_children const * children = node->next;
+  if (children == null_ptr)
+    return null_ptr;
 
-    _sc_dictionary_up_destroy_node(dictionary, next, node_clear);
+  switch (children->type)
+  {
+  case SC_DICTIONARY_CHILDREN_4:
+    return *position < children->count ? ((sc_dictionary_children_4 const *)children)->nodes[(*position)++] : null_ptr;
+
+  case SC_DICTIONARY_CHILDREN_16:
+    return *position < children->count ? ((sc_dictionary_children_16 const *)children)->nodes[(*position)++]
+                                       : null_ptr;
+
+  case SC_DICTIONARY_CHILDREN_48:
+  {
+    // children are visited in order of keys, not in order of appending
+    sc_dictionary_children_48 const * children_48 = (sc_dictionary_children_48 const *)children;
+    while (*position < SC_DICTIONARY_KEYS_COUNT)
+    {
+      sc_uint8 const index = children_48->indexes[(*position)++];
+      if (index != 0)
+        return children_48->nodes[index - 1];
+    }
+    return null_ptr;
+  }
+
+  default:
+  {
+    sc_dictionary_children_256 const * children_256 = (sc_dictionary_children_256 const *)children;
+    while (*position < SC_DICTIONARY_KEYS_COUNT)
+    {
+      sc_dictionary_node * next = children_256->nodes[(*position)++];
+      if (SC_DICTIONARY_NODE_IS_VALID(next))
+        return next;
+    }
+    return null_ptr;
+  }
+  }
+}
+
+void _sc_dictionary_up_destroy_node(sc_dictionary_node * node, void (*node_clear)(sc_dictionary_node *))
+{
+  sc_uint16 position = 0;
+  sc_dictionary_node * next;
+  while ((next = _sc_dictionary_node_next_child(node, &position)) != null_ptr)
+  {
+    _sc_dictionary_up_destroy_node(next, node_clear);
 
     if (node_clear != null_ptr)
       node_clear(next);
     _sc_dictionary_node_destroy(next);
   }
-
-  sc_mem_free(next_bucket);
 }
 
 sc_bool sc_dictionary_destroy(sc_dictionary * dictionary, void (*node_clear)(sc_dictionary_node *))
@@ -96,7 +335,7 @@ sc_bool sc_dictionary_destroy(sc_dictionary * dictionary, void (*node_clear)(sc_
   if (dictionary == null_ptr)
     return SC_FALSE;
 
-  _sc_dictionary_up_destroy_node(dictionary, dictionary->root, node_clear);
+  _sc_dictionary_up_destroy_node(dictionary->root, node_clear);
 
   if (node_clear != null_ptr)
     node_clear(dictionary->root);
@@ -117,95 +356,62 @@ inline sc_dictionary_node * _sc_dictionary_get_next_node(
   sc_uint8 num;
   dictionary->char_to_int(ch, &num, &node->mask);
 
-  sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-  sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-
-  return node->next == null_ptr ? null_ptr
-                                : (node->next[bucket_idx] == null_ptr ? null_ptr : node->next[bucket_idx][child_idx]);
+  return _sc_dictionary_node_find_child(node, num);
 }
 
 sc_dictionary_node * sc_dictionary_append_to_node(sc_dictionary * dictionary, sc_char const * string, sc_uint32 size)
 {
   sc_dictionary_node * node = dictionary->root;
-  sc_char * string_ptr = (sc_char *)&*string;
 
   sc_uint32 i = 0;
-  sc_uint32 saved_offset_size = size;
   while (i < size)
   {
     sc_uint8 num;
-    dictionary->char_to_int(*string_ptr, &num, &node->mask);
-    sc_uint64 bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_uint64 child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
+    dictionary->char_to_int(string[i], &num, &node->mask);
 
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx]))
-      node->next[bucket_idx] = sc_mem_new(sc_dictionary_node *, SC_DICTIONARY_NODE_BUCKET_SIZE);
+    sc_dictionary_node * next = _sc_dictionary_node_find_child(node, num);
 
     // define prefix
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx][child_idx]))
+    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
     {
-      node->next[bucket_idx][child_idx] = _sc_dictionary_node_initialize(dictionary->size);
-
-      sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
+      sc_dictionary_node * temp = _sc_dictionary_node_initialize();
 
       temp->offset_size = size - i;
-      sc_str_cpy(temp->offset, string_ptr, temp->offset_size);
+      sc_str_cpy(temp->offset, string + i, temp->offset_size);
 
-      node = temp;
+      _sc_dictionary_node_add_child(node, num, temp);
 
+      node = temp;
       break;
     }
-    // visit next substring
-    else if (node->next[bucket_idx][child_idx]->offset != null_ptr)
-    {
-      sc_dictionary_node * moving = node->next[bucket_idx][child_idx];
-
-      sc_uint32 j = 0;
-      for (; i < size && j < moving->offset_size && moving->offset[j] == *string_ptr; ++i, ++j, ++string_ptr)
-        ;
-
-      if (j != moving->offset_size)
-      {
-        saved_offset_size = moving->offset_size;
-
-        node->next[bucket_idx][child_idx] = _sc_dictionary_node_initialize(dictionary->size);
-
-        sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
-
-        temp->offset_size = j;
-        sc_str_cpy(temp->offset, moving->offset, temp->offset_size);
-      }
-      node = node->next[bucket_idx][child_idx];
-
-      // insert intermediate node for prefix end branching
-      if (j < moving->offset_size)
-      {
-        sc_char * offset_ptr = &*(moving->offset + j);
 
-        dictionary->char_to_int(*offset_ptr, &num, &node->mask);
-        bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-        child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
+    // visit next substring
+    sc_uint32 j = 0;
+    for (; i + j < size && j < next->offset_size && next->offset[j] == string[i + j]; ++j)
+      ;
 
-        sc_char * moving_offset_copy = moving->offset;
+    i += j;
+    if (j == next->offset_size)
+    {
+      node = next;
+      continue;
+    }
 
-        if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx]))
-          node->next[bucket_idx] = sc_mem_new(sc_dictionary_node *, SC_DICTIONARY_NODE_BUCKET_SIZE);
+    // insert intermediate node for prefix end branching, next node keeps its data and address
+    sc_dictionary_node * temp = _sc_dictionary_node_initialize();
+    temp->offset_size = j;
+    sc_str_cpy(temp->offset, next->offset, temp->offset_size);
+    _sc_dictionary_node_replace_child(node, num, temp);
 
-        node->next[bucket_idx][child_idx] = &*moving;
+    sc_char * next_offset = next->offset;
+    next->offset_size -= j;
+    sc_str_cpy(next->offset, next_offset + j, next->offset_size);
+    sc_mem_free(next_offset);
 
-        sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
+    dictionary->char_to_int(next->offset[0], &num, &temp->mask);
+    _sc_dictionary_node_add_child(temp, num, next);
 
-        temp->offset_size = saved_offset_size - j;
-        sc_str_cpy(temp->offset, offset_ptr, temp->offset_size);
-        sc_mem_free(moving_offset_copy);
-      }
-    }
-    else
-    {
-      node = node->next[bucket_idx][child_idx];
-      ++string_ptr;
-      ++i;
-    }
+    node = temp;
   }
 
   return node;
@@ -238,21 +444,15 @@ sc_dictionary_node const * sc_dictionary_get_last_node_from_node(
   while (i < string_size)
   {
     sc_dictionary_node * next = _sc_dictionary_get_next_node(dictionary, node, string[i]);
-    if (SC_DICTIONARY_NODE_IS_VALID(next)
-        && (sc_str_has_prefix(string + i, next->offset) || sc_str_cmp(string + i, next->offset)))
-    {
-      node = next;
-      i += node->offset_size;
-    }
-    else
+    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next) || next->offset_size > string_size - i
+        || !sc_str_n_cmp(string + i, next->offset, next->offset_size))
       break;
+
+    node = next;
+    i += node->offset_size;
   }
 
-  // check suffixes matching
-  sc_dictionary_node const * result_node = null_ptr;
-  if (i == string_size
-      && (node->offset == null_ptr || sc_str_cmp(node->offset, string + (string_size - node->offset_size))))
-    result_node = node;
+  sc_dictionary_node const * result_node = i == string_size ? node : null_ptr;
 
   sc_monitor_release_read(&dictionary->monitor);
 
@@ -296,41 +496,32 @@ sc_bool _sc_dictionary_get_by_key_prefix(
   while (i < string_size)
   {
     sc_dictionary_node * next = _sc_dictionary_get_next_node(dictionary, node, string[i]);
-    if (SC_DICTIONARY_NODE_IS_VALID(next)
-        && (sc_str_has_prefix(string + i, next->offset) || sc_str_cmp(string + i, next->offset)))
-    {
-      node = next;
-      i += node->offset_size;
-    }
-    else
-      break;
-  }
-
-  if (i == string_size)
-    callable(node, dest);
-
-  for (sc_uint8 num = 0; num < dictionary->size; ++num)
-  {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_dictionary_node ** next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
-
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
     if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
-      continue;
+      return SC_TRUE;
 
-    if (i == string_size || sc_str_has_prefix(next->offset, string + i))
+    sc_uint32 const rest_size = string_size - i;
+    // string ends inside substring of next node, so all strings of next node have string as prefix
+    if (next->offset_size > rest_size)
     {
+      if (!sc_str_n_cmp(next->offset, string + i, rest_size))
+        return SC_TRUE;
+
       if (!callable(next, dest))
         return SC_FALSE;
 
-      if (!sc_dictionary_visit_down_node_from_node(dictionary, next, callable, dest))
-        return SC_FALSE;
+      return sc_dictionary_visit_down_node_from_node(dictionary, next, callable, dest);
     }
+
+    if (!sc_str_n_cmp(next->offset, string + i, next->offset_size))
+      return SC_TRUE;
+
+    node = next;
+    i += node->offset_size;
   }
-  return SC_TRUE;
+
+  callable(node, dest);
+
+  return sc_dictionary_visit_down_node_from_node(dictionary, node, callable, dest);
 }
 
 sc_bool sc_dictionary_get_by_key_prefix(
@@ -352,18 +543,10 @@ sc_bool sc_dictionary_visit_down_node_from_node(
     sc_bool (*callable)(sc_dictionary_node *, void **),
     void ** dest)
 {
-  for (sc_uint8 num = 0; num < dictionary->size; ++num)
+  sc_uint16 position = 0;
+  sc_dictionary_node * next;
+  while ((next = _sc_dictionary_node_next_child(node, &position)) != null_ptr)
   {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_dictionary_node ** next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
-
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
-      continue;
-
     if (!callable(next, dest))
       return SC_FALSE;
 
@@ -391,18 +574,10 @@ sc_bool sc_dictionary_visit_up_node_from_node(
     sc_bool (*callable)(sc_dictionary_node *, void **),
     void ** dest)
 {
-  for (sc_uint8 num = 0; num < dictionary->size; ++num)
+  sc_uint16 position = 0;
+  sc_dictionary_node * next;
+  while ((next = _sc_dictionary_node_next_child(node, &position)) != null_ptr)
   {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_dictionary_node ** next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
-
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
-      continue;
-
     if (!sc_dictionary_visit_up_node_from_node(dictionary, next, callable, dest))
       return SC_FALSE;
 
@@ -423,3 +598,44 @@ sc_bool sc_dictionary_visit_up_nodes(
   sc_monitor_release_read(&dictionary->monitor);
   return status;
 }
+
+sc_uint64 _sc_dictionary_node_get_memory_size(sc_dictionary_node const * node)
+{
+  sc_uint64 size = sizeof(sc_dictionary_node);
+  if (node->offset != null_ptr)
+    size += node->offset_size + 1;
+
+  if (node->next == null_ptr)
+    return size;
+
+  switch (node->next->type)
+  {
+  case SC_DICTIONARY_CHILDREN_4:
+    size += sizeof(sc_dictionary_children_4);
+    break;
+  case SC_DICTIONARY_CHILDREN_16:
+    size += sizeof(sc_dictionary_children_16);
+    break;
+  case SC_DICTIONARY_CHILDREN_48:
+    size += sizeof(sc_dictionary_children_48);
+    break;
+  default:
+    size += sizeof(sc_dictionary_children_256);
+    break;
+  }
+
+  sc_uint16 position = 0;
+  sc_dictionary_node * next;
+  while ((next = _sc_dictionary_node_next_child(node, &position)) != null_ptr)
+    size += _sc_dictionary_node_get_memory_size(next);
+
+  return size;
+}
+
+sc_uint64 sc_dictionary_get_memory_size(sc_dictionary * dictionary)
+{
+  sc_monitor_acquire_read(&dictionary->monitor);
+  sc_uint64 const size = sizeof(sc_dictionary) + _sc_dictionary_node_get_memory_size(dictionary->root);
+  sc_monitor_release_read(&dictionary->monitor);
+  return size;
+}
@@ -14,32 +14,91 @@
 
 #include "sc-store/sc-base/sc_monitor_private.h"
 
+//! Types of sc-dictionary node children containers, each type is named by its maximal children count
+typedef enum _sc_dictionary_children_type
+{
+  SC_DICTIONARY_CHILDREN_4 = 0,
+  SC_DICTIONARY_CHILDREN_16 = 1,
+  SC_DICTIONARY_CHILDREN_48 = 2,
+  SC_DICTIONARY_CHILDREN_256 = 3,
+} sc_dictionary_children_type;
+
+//! A header of sc-dictionary node children container, it grows with children count
+typedef struct _sc_dictionary_children
+{
+  sc_uint8 type;    // type of children container
+  sc_uint16 count;  // count of children in container
+} sc_dictionary_children;
+
+//! A sc-dictionary node children container with sorted keys for up to 4 children
+typedef struct _sc_dictionary_children_4
+{
+  sc_dictionary_children header;
+  sc_uint8 keys[4];
+  struct _sc_dictionary_node * nodes[4];
+} sc_dictionary_children_4;
+
+//! A sc-dictionary node children container with sorted keys for up to 16 children
+typedef struct _sc_dictionary_children_16
+{
+  sc_dictionary_children header;
+  sc_uint8 keys[16];
+  struct _sc_dictionary_node * nodes[16];
+} sc_dictionary_children_16;
+
+//! A sc-dictionary node children container with indexes of children by keys for up to 48 children
+typedef struct _sc_dictionary_children_48
+{
+  sc_dictionary_children header;
+  sc_uint8 indexes[256];  // child index + 1 by key, 0 if child doesn't exist
+  struct _sc_dictionary_node * nodes[48];
+} sc_dictionary_children_48;
+
+//! A sc-dictionary node children container with children by keys
+typedef struct _sc_dictionary_children_256
+{
+  sc_dictionary_children header;
+  struct _sc_dictionary_node * nodes[256];
+} sc_dictionary_children_256;
+
 //! A sc-dictionary structure node to store prefixes
 typedef struct _sc_dictionary_node
 {
-  struct _sc_dictionary_node *** next;  // a pointer to sc-dictionary node children pointers
-  sc_char * offset;                     // a pointer to substring of node string
-  sc_uint32 offset_size;                // size to substring of node string
-  void * data;                          // storing data
-  sc_uint8 mask;                        // mask for rights checking and memory optimization
+  sc_dictionary_children * next;  // a pointer to sc-dictionary node children container, null for leaf nodes
+  sc_char * offset;               // a pointer to substring of node string
+  sc_uint32 offset_size;          // size to substring of node string
+  void * data;                    // storing data
+  sc_uint8 mask;                  // mask for rights checking and memory optimization
 } sc_dictionary_node;
 
 //! A sc-dictionary structure node to store pairs of <string, object> type
 typedef struct _sc_dictionary
 {
   sc_dictionary_node * root;  // sc-dictionary tree root node
-  sc_uint8 size;              // default sc-dictionary node children size
   void (*char_to_int)(sc_char, sc_uint8 *, sc_uint8 const *);
   sc_monitor monitor;
 } sc_dictionary;
 
-sc_dictionary_node * _sc_dictionary_node_initialize(sc_uint8 children_size);
+sc_dictionary_node * _sc_dictionary_node_initialize();
 
 sc_dictionary_node * _sc_dictionary_get_next_node(
     sc_dictionary const * dictionary,
     sc_dictionary_node const * node,
     sc_char ch);
 
+/*! Gets next child of sc-dictionary node in order of children keys.
+ * @param node A sc-dictionary node
+ * @param[in, out] position A position of child to start search from, it should be 0 for the first child
+ * @returns Returns A child of sc-dictionary node, or null_ptr if there are no more children
+ */
+sc_dictionary_node * _sc_dictionary_node_next_child(sc_dictionary_node const * node, sc_uint16 * position);
+
+/*! Calculates memory size allocated for sc-dictionary nodes, their children containers and substrings.
+ * @param dictionary A sc-dictionary pointer
+ * @returns Returns Size of allocated memory in bytes
+ */
+sc_uint64 sc_dictionary_get_memory_size(sc_dictionary * dictionary);
+
 /*! Appends a string to a sc-dictionary by a common prefix with another string started in sc-dictionary node, if such
  * exists.
  * @param dictionary A sc-dictionary pointer
@@ -9,6 +9,8 @@
 
 #include "sc_event_queue.h"
 
+#include "sc_memory_context_manager.h"
+
 #include "sc-core/sc_event_subscription.h"
 #include "sc-core/sc_types.h"
 
@@ -44,6 +46,13 @@ struct _sc_event_subscription
  */
 sc_result sc_event_notify_element_deleted(sc_addr addr);
 
+/*! Notify about deletion of sc-elements. Subscriptions table is locked once for all sc-elements.
+ * @param addrs An array of sc-addresses of deleted sc-elements
+ * @param count A count of deleted sc-elements
+ * @remarks This function destroys all events for deleted sc-elements.
+ */
+sc_result sc_event_notify_elements_deleted(sc_addr const * addrs, sc_uint32 count);
+
 /*! Emits event with \p type for sc-element \p subscription_addr with argument \p arg.
  * If \ctx is in a pending mode, then event will be pend for emit
  * @param ctx A pointer to context, that emits event
@@ -68,6 +77,46 @@ sc_result sc_event_emit(
     sc_event_do_after_callback callback,
     sc_addr event_addr);
 
+/*! Structure representing parameters for emitting a sc-event.
+ * @note This structure holds the parameters required for emitting a sc-event in pending events buffer of memory
+ * context or in batch of events.
+ */
+struct _sc_event_emit_params
+{
+  sc_addr subscription_addr;      ///< sc-address representing the subscription associated with the event.
+  sc_event_type event_type_addr;  ///< Type of the event to be emitted.
+  sc_addr connector_addr;         ///< sc-address representing the connector associated with the event.
+  sc_type connector_type;         ///< sc-type of the connector associated with the event.
+  sc_addr other_addr;             ///< sc-address representing the other element associated with the event.
+};
+
+/*! Emits batch of events with common \p callback and \p event_addr. Unlike \p sc_event_emit called for every event,
+ * events blocking and pending modes of \ctx are checked once and subscriptions table is locked once for the whole
+ * batch.
+ * @param ctx A pointer to context, that emits events
+ * @param params An array of emitting events arguments
+ * @param count A count of emitting events
+ * @param callback A pointer function that is executed after the execution of a function that was called on the
+ * initiated event.
+ * @param event_addr An argument of callback.
+ * @return If at least one event is emitted or pended, then return SC_RESULT_OK; otherwise return SC_RESULT_NO.
+ */
+sc_result sc_event_emit_n(
+    sc_memory_context const * ctx,
+    sc_event_emit_params const * params,
+    sc_uint32 count,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr);
+
+/*! Emits batch of events immediately. Subscriptions of consecutive events of the same sc-element are looked up once.
+ */
+sc_result sc_event_emit_n_impl(
+    sc_memory_context const * ctx,
+    sc_event_emit_params const * params,
+    sc_uint32 count,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr);
+
 /*! Emits event immediately
  */
 sc_result sc_event_emit_impl(
@@ -57,6 +57,63 @@ void _sc_event_emission_pool_worker_data_destroy(sc_event * data)
   sc_mem_free(data);
 }
 
+/*! Structure representing sc-memory context cached by worker thread of sc-event emission pool.
+ * @note Worker thread reuses cached context for do-after callbacks of consecutive events of the same user, so it
+ * doesn't resolve and free context for every such event.
+ */
+typedef struct
+{
+  sc_uint32 id;             ///< Identifier of cache in table of cached contexts of manager.
+  sc_uint32 manager_id;     ///< Identifier of sc-event emission manager, for which context is cached.
+  sc_addr user_addr;        ///< A sc-address of user of cached context.
+  sc_memory_context * ctx;  ///< A pointer to cached context.
+} sc_event_worker_context;
+
+//! Counter of generated sc-event emission managers used to identify them
+static gint s_emission_managers_count = 0;
+//! Counter of generated worker threads caches used to identify them
+static gint s_worker_contexts_count = 0;
+//! Context cached by current worker thread, it is freed with worker thread
+static GPrivate s_worker_context = G_PRIVATE_INIT(sc_mem_free);
+
+/*! Function that gets sc-memory context of specified user cached by current worker thread.
+ * @param manager Pointer to the sc_event_emission_manager, which worker thread requests context.
+ * @param user_addr A sc-address of user of context.
+ * @returns Returns a pointer to cached context.
+ * @note If worker thread has cached context of other user, then it is freed and context of specified user is cached.
+ */
+sc_memory_context * _sc_event_emission_pool_worker_get_context(sc_event_emission_manager * manager, sc_addr user_addr)
+{
+  sc_event_worker_context * worker_context = g_private_get(&s_worker_context);
+  if (worker_context == null_ptr)
+  {
+    worker_context = sc_mem_new(sc_event_worker_context, 1);
+    worker_context->id = g_atomic_int_add(&s_worker_contexts_count, 1) + 1;
+    g_private_set(&s_worker_context, worker_context);
+  }
+
+  // context cached for previous manager has been freed with it
+  if (worker_context->manager_id == manager->id && worker_context->ctx != null_ptr)
+  {
+    if (SC_ADDR_IS_EQUAL(worker_context->user_addr, user_addr))
+      return worker_context->ctx;
+
+    sc_monitor_acquire_write(&manager->worker_contexts_monitor);
+    sc_hash_table_remove(manager->worker_contexts, GUINT_TO_POINTER(worker_context->id));
+    sc_monitor_release_write(&manager->worker_contexts_monitor);
+  }
+
+  worker_context->manager_id = manager->id;
+  worker_context->user_addr = user_addr;
+  worker_context->ctx = sc_memory_context_new_ext(user_addr);
+
+  sc_monitor_acquire_write(&manager->worker_contexts_monitor);
+  sc_hash_table_insert(manager->worker_contexts, GUINT_TO_POINTER(worker_context->id), worker_context->ctx);
+  sc_monitor_release_write(&manager->worker_contexts_monitor);
+
+  return worker_context->ctx;
+}
+
 /*! Function that represents the work performed by a worker in the sc-event emission pool.
  * @param data Pointer to the sc_event containing information about the work.
  * @param user_data Pointer to the sc_event_emission_manager managing the sc-event emission.
@@ -103,9 +160,8 @@ destroy:
 {
   if (event->callback != null_ptr)
   {
-    sc_memory_context * ctx = sc_memory_context_new_ext(event->user_addr);
+    sc_memory_context * ctx = _sc_event_emission_pool_worker_get_context(queue, event->user_addr);
     event->callback(ctx, event->event_addr);
-    sc_memory_context_free(ctx);
   }
 
   _sc_event_emission_pool_worker_data_destroy(event);
@@ -133,6 +189,11 @@ void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager,
   (*manager)->running = SC_TRUE;
   sc_monitor_init(&(*manager)->destroy_monitor);
 
+  (*manager)->id = g_atomic_int_add(&s_emission_managers_count, 1) + 1;
+  (*manager)->worker_contexts =
+      sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, (GDestroyNotify)sc_memory_context_free);
+  sc_monitor_init(&(*manager)->worker_contexts_monitor);
+
   sc_monitor_init(&(*manager)->pool_monitor);
   (*manager)->thread_pool = g_thread_pool_new(
       _sc_event_emission_pool_worker,
@@ -173,6 +234,15 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
     manager->thread_pool = null_ptr;
   }
 
+  // all workers are finished, so contexts cached by them can be freed
+  sc_monitor_acquire_write(&manager->worker_contexts_monitor);
+  if (manager->worker_contexts != null_ptr)
+  {
+    sc_hash_table_destroy(manager->worker_contexts);
+    manager->worker_contexts = null_ptr;
+  }
+  sc_monitor_release_write(&manager->worker_contexts_monitor);
+
   while (!sc_queue_empty(&manager->deletable_events_subscriptions))
   {
     sc_event_subscription * event_subscription = sc_queue_pop(&manager->deletable_events_subscriptions);
@@ -183,6 +253,7 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
 
   sc_monitor_release_write(&manager->pool_monitor);
 
+  sc_monitor_destroy(&manager->worker_contexts_monitor);
   sc_monitor_destroy(&manager->pool_monitor);
   sc_monitor_destroy(&manager->destroy_monitor);
   sc_mem_free(manager);
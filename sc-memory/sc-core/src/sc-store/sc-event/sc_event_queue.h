@@ -32,6 +32,10 @@ typedef struct
   sc_monitor destroy_monitor;               ///< Monitor for synchronizing access to the destruction process.
   GThreadPool * thread_pool;                ///< Thread pool used for worker threads processing events.
   sc_monitor pool_monitor;                  ///< Monitor for synchronizing access to the thread pool.
+  sc_uint32 id;                             ///< Unique identifier of the manager.
+  sc_hash_table * worker_contexts;          ///< Table of sc-memory contexts cached by worker threads, it owns their
+                                            ///< references.
+  sc_monitor worker_contexts_monitor;       ///< Monitor for synchronizing access to the table of cached contexts.
 } sc_event_emission_manager;
 
 /*! Function that initializes an sc-event emission manager.
@@ -14,6 +14,7 @@
 
 #  include "sc-store/sc-container/sc_dictionary_private.h"
 #  include "sc-store/sc-container/sc_struct_node.h"
+#  include "sc-store/sc-container/sc_hash_table.h"
 
 #  include "sc_file_system.h"
 #  include "sc_io.h"
@@ -21,12 +22,58 @@
 #  define DEFAULT_STRING_INT_SIZE 20
 #  define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 
+#  define SC_FS_STRINGS_CHANNEL_PREFIX "strings"
+#  define SC_FS_COMPACTED_STRINGS_CHANNEL_PREFIX "compacted_strings"
+#  define SC_FS_COMPACTED_EXT ".compacted"
+#  define SC_FS_TMP_EXT ".tmp"
+// version 2 marks file paths by the highest bit of stored string size, strings of version 1 are read by version 2
+#  define SC_FS_STRINGS_FORMAT_VERSION 2
+
 typedef struct
 {
   sc_list * link_hashes;
   sc_uint64 string_offset;
 } sc_link_hash_content;
 
+typedef struct
+{
+  sc_io_channel ** channels;          // compacted strings channels
+  sc_uint64 last_string_offset;       // last offset of string in compacted strings channels
+  sc_hash_table * string_offsets;     // old string offsets and new ones, both are incremented to be non-null
+  sc_hash_table * string_sizes;       // new string offsets incremented to be non-null and sizes of their strings
+  sc_uint64 referenced_strings_size;  // size of compacted strings that have sc-links
+  sc_hash_table * late_string_offsets;  // old offsets of strings compacted while terms index was written, incremented
+} sc_strings_compaction;
+
+//! Strings offsets of term borrowed from terms index and terms dictionaries, valid while compaction monitor is held
+typedef struct
+{
+  sc_uint64 const * index_string_offsets;  // strings offsets in mapped terms index
+  sc_uint64 index_string_offsets_count;
+  sc_struct_node const * nodes[2];  // next items of lists with strings offsets being merged and added after merge
+  sc_struct_node const * ends[2];   // end items of these lists
+} sc_term_string_offsets;
+
+void _sc_dictionary_fs_memory_get_strings_channel_path(
+    sc_dictionary_fs_memory const * memory,
+    sc_char const * strings_prefix,
+    sc_uint64 const idx,
+    sc_char ** strings_path)
+{
+  sc_char strings_channel_number[DEFAULT_STRING_INT_SIZE];
+  {
+    sc_uint64 strings_channel_number_size;
+    sc_int_to_str_int(idx + 1, strings_channel_number, strings_channel_number_size);
+    (void)strings_channel_number_size;
+  }
+  sc_char * strings_channel_name;
+  {
+    sc_str_concat(strings_prefix, strings_channel_number, strings_channel_name);
+  }
+  sc_fs_concat_path_ext(memory->path, strings_channel_name, SC_FS_EXT, strings_path);
+  sc_mem_free(strings_channel_name);
+}
+
 sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
     sc_dictionary_fs_memory * memory,
     sc_uint64 strings_offset,
@@ -58,20 +105,8 @@ sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
     sc_io_channel_flush(memory->strings_channels[idx - 1], null_ptr);
   sc_monitor_release_read(&memory->monitor);
 
-  sc_char strings_channel_number[DEFAULT_STRING_INT_SIZE];
-  {
-    sc_uint64 strings_channel_number_size;
-    sc_int_to_str_int(idx + 1, strings_channel_number, strings_channel_number_size);
-    (void)strings_channel_number_size;
-  }
-  static sc_char const * strings_postfix = "strings";
-  sc_char * strings_channel_name;
-  {
-    sc_str_concat(strings_postfix, strings_channel_number, strings_channel_name);
-  }
   sc_char * strings_path;
-  sc_fs_concat_path_ext(memory->path, strings_channel_name, SC_FS_EXT, &strings_path);
-  sc_mem_free(strings_channel_name);
+  _sc_dictionary_fs_memory_get_strings_channel_path(memory, SC_FS_STRINGS_CHANNEL_PREFIX, idx, &strings_path);
 
   sc_bool is_path = sc_fs_is_file(strings_path);
 
@@ -101,6 +136,102 @@ sc_uint64 _sc_dictionary_fs_memory_normalize_offset(sc_dictionary_fs_memory cons
   return strings_offset - memory->max_strings_channel_size * channel_idx;
 }
 
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset_ext(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_bool const is_size_only,
+    sc_char ** string,
+    sc_uint64 * string_size,
+    sc_bool * is_file_path)
+{
+  sc_monitor * channel_monitor;
+  sc_io_channel * strings_channel =
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+  if (strings_channel == null_ptr)
+  {
+    sc_fs_memory_error("Path `%s` doesn't exist", "path");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  // read string with size from fs-memory
+  sc_uint64 read_bytes;
+  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
+  sc_monitor_acquire_write(channel_monitor);
+  sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
+  {
+    if (sc_io_channel_read_chars(strings_channel, (sc_char *)string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != read_bytes)
+    {
+      if (string != null_ptr)
+        *string = null_ptr;
+      goto error;
+    }
+
+    // file paths are stored with marked size to distinguish them from strings
+    if (is_file_path != null_ptr)
+      *is_file_path = (*string_size & SC_FS_FILE_PATH_STRING_FLAG) == SC_FS_FILE_PATH_STRING_FLAG;
+    *string_size &= ~SC_FS_FILE_PATH_STRING_FLAG;
+
+    if (is_size_only)
+      goto result;
+
+    *string = sc_mem_new(sc_char, *string_size + 1);
+    if (sc_io_channel_read_chars(strings_channel, *string, *string_size, &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || *string_size != read_bytes)
+    {
+      sc_mem_free(*string);
+      *string = null_ptr;
+      goto error;
+    }
+  }
+
+result:
+  sc_monitor_release_write(channel_monitor);
+  return SC_FS_MEMORY_OK;
+
+error:
+  sc_monitor_release_write(channel_monitor);
+  return SC_FS_MEMORY_READ_ERROR;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_char ** string)
+{
+  sc_uint64 string_size;
+  return _sc_dictionary_fs_memory_read_string_by_offset_ext(
+      memory, string_offset, SC_FALSE, string, &string_size, null_ptr);
+}
+
+void _sc_dictionary_fs_memory_count_unreferenced_string(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_size,
+    sc_bool const is_unreferenced)
+{
+  sc_uint64 const size = sizeof(sc_uint64) + string_size;
+
+  sc_monitor_acquire_write(&memory->monitor);
+  if (is_unreferenced)
+    memory->unreferenced_strings_size += size;
+  else
+    memory->unreferenced_strings_size -= sc_min(size, memory->unreferenced_strings_size);
+  sc_monitor_release_write(&memory->monitor);
+}
+
+void _sc_dictionary_fs_memory_release_string(sc_dictionary_fs_memory * memory, sc_uint64 const string_offset)
+{
+  sc_uint64 string_size;
+  if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+          memory, string_offset, SC_TRUE, null_ptr, &string_size, null_ptr)
+      != SC_FS_MEMORY_OK)
+    return;
+
+  _sc_dictionary_fs_memory_count_unreferenced_string(memory, string_size, SC_TRUE);
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
     sc_dictionary_fs_memory ** memory,
     sc_memory_params const * params)
@@ -138,9 +269,13 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
       (*memory)->max_searchable_string_size = sc_boundary(params->max_searchable_string_size, 10, 100000);
       (*memory)->term_separators = params->term_separators;
       (*memory)->search_by_substring = params->search_by_substring;
+      (*memory)->min_unreferenced_strings_percent = sc_min(params->compact_strings_min_unreferenced_percent, 100);
     }
     {
+      (*memory)->terms_string_offsets_index = null_ptr;
       _sc_uchar_dictionary_initialize(&(*memory)->terms_string_offsets_dictionary);
+      (*memory)->merged_terms_string_offsets_dictionary = null_ptr;
+      sc_monitor_init(&(*memory)->save_monitor);
       static sc_char const * term_string_offsets = "term_string_offsets" SC_FS_EXT;
       sc_fs_concat_path((*memory)->path, term_string_offsets, &(*memory)->terms_string_offsets_path);
 
@@ -149,6 +284,19 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
       (*memory)->last_string_offset = 0;
       sc_monitor_init(&(*memory)->monitor);
       sc_monitor_init(&(*memory)->resolve_string_offset_monitor);
+
+      sc_monitor_init(&(*memory)->compaction_monitor);
+      (*memory)->is_compacting = SC_FALSE;
+      (*memory)->unreferenced_strings_size = 0;
+      (*memory)->strings_save_id = 0;
+      static sc_char const * strings_meta = "strings_meta" SC_FS_EXT;
+      sc_fs_concat_path((*memory)->path, strings_meta, &(*memory)->strings_meta_path);
+    }
+
+    {
+      (*memory)->numeric_index = sc_fs_memory_numeric_index_new();
+      static sc_char const * numeric_index = "numeric_index" SC_FS_EXT;
+      sc_fs_concat_path((*memory)->path, numeric_index, &(*memory)->numeric_index_path);
     }
 
     _sc_number_dictionary_initialize(&(*memory)->link_hashes_string_offsets_dictionary);
@@ -168,6 +316,7 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
   sc_message("\tMax strings channel size: %d", (*memory)->max_strings_channel_size);
   sc_message("\tMax searchable string size: %d", (*memory)->max_searchable_string_size);
   sc_message("\tTerm separators: \"%s\"", (*memory)->term_separators);
+  sc_message("\tMin unreferenced strings percent to compact: %d", (*memory)->min_unreferenced_strings_percent);
 
   sc_fs_memory_info("Successfully initialized");
 
@@ -205,7 +354,10 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
     sc_mem_free(memory->path);
 
     {
+      sc_fs_memory_terms_index_unmap(memory->terms_string_offsets_index);
       sc_dictionary_destroy(memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+      sc_dictionary_destroy(memory->merged_terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+      sc_monitor_destroy(&memory->save_monitor);
       sc_mem_free(memory->terms_string_offsets_path);
 
       for (sc_uint64 i = 0; i < memory->max_strings_channels && memory->strings_channels[i] != null_ptr; ++i)
@@ -216,8 +368,13 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
       _sc_monitor_table_destroy(&memory->strings_channels_monitors_table);
       sc_monitor_destroy(&memory->monitor);
       sc_monitor_destroy(&memory->resolve_string_offset_monitor);
+      sc_monitor_destroy(&memory->compaction_monitor);
+      sc_mem_free(memory->strings_meta_path);
     }
 
+    sc_fs_memory_numeric_index_destroy(memory->numeric_index);
+    sc_mem_free(memory->numeric_index_path);
+
     sc_dictionary_destroy(memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_string_node_clear);
     sc_dictionary_destroy(memory->string_offsets_link_hashes_dictionary, _sc_dictionary_fs_memory_link_node_clear);
     sc_mem_free(memory->string_offsets_link_hashes_path);
@@ -256,8 +413,15 @@ sc_bool _sc_addr_hash_compare(void * addr_hash, void * other_addr_hash)
 void _sc_dictionary_fs_memory_append_link_string_unique(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash const link_hash,
-    sc_uint64 const string_offset)
+    sc_uint64 const string_offset,
+    sc_uint64 * released_string_offset,
+    sc_bool * is_string_revived)
 {
+  if (released_string_offset != null_ptr)
+    *released_string_offset = INVALID_STRING_OFFSET;
+  if (is_string_revived != null_ptr)
+    *is_string_revived = SC_FALSE;
+
   sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
   sc_uint64 link_hash_str_size;
   sc_bool is_content_new;
@@ -287,11 +451,18 @@ void _sc_dictionary_fs_memory_append_link_string_unique(
       sc_dictionary_append(
           memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size, link_hashes);
     }
+    // string has no sc-links, but it is linked again before compaction
+    else if (link_hashes->size == 0 && is_string_revived != null_ptr)
+      *is_string_revived = SC_TRUE;
   }
 
   {
     if (!is_content_new && content->link_hashes != link_hashes)
+    {
       sc_list_remove_if(content->link_hashes, (sc_addr_hash_to_sc_pointer)link_hash, _sc_addr_hash_compare);
+      if (content->link_hashes->size == 0 && released_string_offset != null_ptr)
+        *released_string_offset = content->string_offset - 1;
+    }
 
     if (content->link_hashes != link_hashes)
     {
@@ -302,32 +473,83 @@ void _sc_dictionary_fs_memory_append_link_string_unique(
   }
 }
 
-sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term(
+void _sc_term_string_offsets_set_list(sc_term_string_offsets * string_offsets, sc_uint8 i, sc_list const * list)
+{
+  // the first list item is a term
+  string_offsets->nodes[i] = list == null_ptr || list->begin == null_ptr ? null_ptr : list->begin->next;
+  string_offsets->ends[i] = list == null_ptr ? null_ptr : list->end;
+}
+
+void _sc_term_string_offsets_init_by_list(sc_term_string_offsets * string_offsets, sc_list const * list)
+{
+  string_offsets->index_string_offsets = null_ptr;
+  string_offsets->index_string_offsets_count = 0;
+  _sc_term_string_offsets_set_list(string_offsets, 0, list);
+  _sc_term_string_offsets_set_list(string_offsets, 1, null_ptr);
+}
+
+sc_bool _sc_term_string_offsets_next(sc_term_string_offsets * string_offsets, sc_uint64 * string_offset)
+{
+  if (string_offsets->index_string_offsets_count != 0)
+  {
+    *string_offset = *string_offsets->index_string_offsets++;
+    --string_offsets->index_string_offsets_count;
+    return SC_TRUE;
+  }
+
+  for (sc_uint8 i = 0; i < 2; ++i)
+  {
+    if (string_offsets->nodes[i] == null_ptr || string_offsets->nodes[i] == string_offsets->ends[i])
+      continue;
+
+    *string_offset = (sc_uint64)string_offsets->nodes[i]->data;
+    string_offsets->nodes[i] = string_offsets->nodes[i]->next;
+    return SC_TRUE;
+  }
+
+  return SC_FALSE;
+}
+
+/*! Gets strings offsets of term without copying them.
+ * @returns SC_TRUE, if term is found.
+ */
+sc_bool _sc_dictionary_fs_memory_get_string_offsets_by_term(
     sc_dictionary_fs_memory const * memory,
-    sc_char const * term)
+    sc_char const * term,
+    sc_term_string_offsets * string_offsets)
 {
   sc_uint64 const term_size = sc_str_len(term);
-  return sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, term, term_size);
+
+  // term strings offsets are saved in terms index, being merged into it and added after it is saved
+  sc_bool is_found = sc_fs_memory_terms_index_get_string_offsets(
+      memory->terms_string_offsets_index,
+      term,
+      term_size,
+      &string_offsets->index_string_offsets,
+      &string_offsets->index_string_offsets_count);
+
+  sc_list const * merged_string_offsets = null_ptr;
+  if (memory->merged_terms_string_offsets_dictionary != null_ptr)
+    merged_string_offsets = sc_dictionary_get_by_key(memory->merged_terms_string_offsets_dictionary, term, term_size);
+  sc_list const * new_string_offsets =
+      sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, term, term_size);
+
+  _sc_term_string_offsets_set_list(string_offsets, 0, merged_string_offsets);
+  _sc_term_string_offsets_set_list(string_offsets, 1, new_string_offsets);
+
+  return is_found || merged_string_offsets != null_ptr || new_string_offsets != null_ptr;
 }
 
 sc_dictionary_fs_memory_status _sc_dictionary_node_fs_memory_get_string_offset_by_string(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
     sc_uint64 const string_size,
-    sc_list const * string_offsets,
+    sc_term_string_offsets * string_offsets,
     sc_uint64 * found_string_offset)
 {
-  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
-  if (!sc_iterator_next(string_offset_it))
-  {
-    sc_iterator_destroy(string_offset_it);
-    return SC_FS_MEMORY_READ_ERROR;
-  }
-
-  while (sc_iterator_next(string_offset_it))
+  sc_uint64 string_offset;
+  while (_sc_term_string_offsets_next(string_offsets, &string_offset))
   {
-    sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
-
     // read string with size from fs-memory
     sc_uint64 read_bytes;
     sc_monitor * channel_monitor;
@@ -375,11 +597,9 @@ sc_dictionary_fs_memory_status _sc_dictionary_node_fs_memory_get_string_offset_b
     break;
   }
 
-  sc_iterator_destroy(string_offset_it);
   return SC_FS_MEMORY_OK;
 
 error:
-  sc_iterator_destroy(string_offset_it);
   return SC_FS_MEMORY_READ_ERROR;
 }
 
@@ -389,11 +609,11 @@ sc_uint64 _sc_dictionary_fs_memory_get_string_offset_by_string(
     sc_uint64 const string_size,
     sc_char const * term)
 {
-  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
-
   sc_uint64 string_offset = INVALID_STRING_OFFSET;
-  _sc_dictionary_node_fs_memory_get_string_offset_by_string(
-      memory, string, string_size, string_offsets, &string_offset);
+  sc_term_string_offsets string_offsets;
+  if (_sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term, &string_offsets))
+    _sc_dictionary_node_fs_memory_get_string_offset_by_string(
+        memory, string, string_size, &string_offsets, &string_offset);
   return string_offset;
 }
 
@@ -404,6 +624,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     sc_uint64 const string_size,
     sc_list const * string_terms,
     sc_bool is_searchable_string,
+    sc_bool is_file_path,
     sc_uint64 * string_offset,
     sc_bool * is_not_exist)
 {
@@ -433,10 +654,12 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, *string_offset);
     sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
 
+    sc_uint64 const stored_string_size = is_file_path ? (string_size | SC_FS_FILE_PATH_STRING_FLAG) : string_size;
     sc_uint64 written_bytes = 0;
-    if (sc_io_channel_write_chars(strings_channel, &string_size, sizeof(string_size), &written_bytes, null_ptr)
+    if (sc_io_channel_write_chars(
+            strings_channel, &stored_string_size, sizeof(stored_string_size), &written_bytes, null_ptr)
             != SC_FS_IO_STATUS_NORMAL
-        || sizeof(string_size) != written_bytes)
+        || sizeof(stored_string_size) != written_bytes)
     {
       sc_fs_memory_error("Error while attribute `size` writing");
       goto write_error;
@@ -502,20 +725,18 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string(
   return sc_dictionary_fs_memory_link_string_ext(memory, link_hash, string, string_size, SC_TRUE);
 }
 
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_link_string(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash const link_hash,
     sc_char const * string,
     sc_uint64 const string_size,
-    sc_bool is_searchable_string)
+    sc_bool is_searchable_string,
+    sc_bool const is_file_path)
 {
-  if (memory == null_ptr)
-  {
-    sc_fs_memory_info("Memory is empty to link string");
-    return SC_FS_MEMORY_NO;
-  }
+  sc_monitor_acquire_read(&memory->compaction_monitor);
 
-  is_searchable_string &= string_size < memory->max_searchable_string_size;
+  // file paths aren't searchable, they are resolved to file contents by sc-storage
+  is_searchable_string &= !is_file_path && string_size < memory->max_searchable_string_size;
   sc_list * string_terms = null_ptr;
   // don't divide into terms big strings if you don't need to search them
   if (is_searchable_string)
@@ -524,25 +745,80 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
   sc_bool is_not_exist = SC_TRUE;
   sc_uint64 string_offset;
   sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_write_string(
-      memory, link_hash, string, string_size, string_terms, is_searchable_string, &string_offset, &is_not_exist);
+      memory,
+      link_hash,
+      string,
+      string_size,
+      string_terms,
+      is_searchable_string,
+      is_file_path,
+      &string_offset,
+      &is_not_exist);
   if (status != SC_FS_MEMORY_OK)
     goto exit;
 
   // cache string offset and link hash data
+  sc_uint64 released_string_offset;
   {
-    _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+    sc_bool is_string_revived;
+    _sc_dictionary_fs_memory_append_link_string_unique(
+        memory, link_hash, string_offset, &released_string_offset, &is_string_revived);
+    if (is_string_revived)
+      _sc_dictionary_fs_memory_count_unreferenced_string(memory, string_size, SC_FALSE);
   }
 
   if (is_searchable_string && is_not_exist)
     status = _sc_dictionary_fs_memory_write_string_terms_string_offset(memory, string_offset, string_terms);
 
+  // numeric contents are ordered by their values to be found by range
+  if (is_file_path)
+    sc_fs_memory_numeric_index_remove(memory->numeric_index, link_hash);
+  else
+    sc_fs_memory_numeric_index_update(memory->numeric_index, link_hash, string, string_size);
+
+  // previous sc-link string may lose its last sc-link
+  if (released_string_offset != INVALID_STRING_OFFSET)
+    _sc_dictionary_fs_memory_release_string(memory, released_string_offset);
+
 exit:
   sc_list_clear(string_terms);
   sc_list_destroy(string_terms);
+  sc_monitor_release_read(&memory->compaction_monitor);
 
   return status;
 }
 
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_bool is_searchable_string)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to link string");
+    return SC_FS_MEMORY_NO;
+  }
+
+  return _sc_dictionary_fs_memory_link_string(memory, link_hash, string, string_size, is_searchable_string, SC_FALSE);
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_file_path(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_char const * file_path,
+    sc_uint64 const file_path_size)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to link file path");
+    return SC_FS_MEMORY_NO;
+  }
+
+  return _sc_dictionary_fs_memory_link_string(memory, link_hash, file_path, file_path_size, SC_FALSE, SC_TRUE);
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash const link_hash)
@@ -553,6 +829,7 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
     return SC_FS_MEMORY_NO;
   }
 
+  sc_monitor_acquire_read(&memory->compaction_monitor);
   sc_monitor_acquire_write(&memory->monitor);
 
   sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
@@ -560,6 +837,7 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
   sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
 
   // remove link for current string
+  sc_uint64 released_string_offset = INVALID_STRING_OFFSET;
   {
     sc_link_hash_content * link_hash_content =
         sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
@@ -567,6 +845,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
       goto result;
 
     sc_list_remove_if(link_hash_content->link_hashes, (sc_addr_hash_to_sc_pointer)link_hash, _sc_addr_hash_compare);
+    if (link_hash_content->link_hashes->size == 0)
+      released_string_offset = link_hash_content->string_offset - 1;
     sc_mem_free(link_hash_content);
   }
 
@@ -576,75 +856,26 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
 result:
   sc_monitor_release_write(&memory->monitor);
 
-  return SC_FS_MEMORY_OK;
-}
-
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
-    sc_dictionary_fs_memory * memory,
-    sc_uint64 const string_offset,
-    sc_char ** string)
-{
-  sc_monitor * channel_monitor;
-  sc_io_channel * strings_channel =
-      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
-  if (strings_channel == null_ptr)
-  {
-    sc_fs_memory_error("Path `%s` doesn't exist", "path");
-    return SC_FS_MEMORY_READ_ERROR;
-  }
-
-  // read string with size from fs-memory
-  sc_uint64 read_bytes;
-  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
-  sc_monitor_acquire_write(channel_monitor);
-  sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
-  {
-    sc_uint64 string_size;
-    if (sc_io_channel_read_chars(strings_channel, (sc_char *)&string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
-    {
-      *string = null_ptr;
-      goto error;
-    }
+  sc_fs_memory_numeric_index_remove(memory->numeric_index, link_hash);
 
-    *string = sc_mem_new(sc_char, string_size + 1);
-    if (sc_io_channel_read_chars(strings_channel, *string, string_size, &read_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
-        || string_size != read_bytes)
-    {
-      sc_mem_free(*string);
-      *string = null_ptr;
-      goto error;
-    }
-  }
+  // string bytes stay in strings channel until compaction
+  if (released_string_offset != INVALID_STRING_OFFSET)
+    _sc_dictionary_fs_memory_release_string(memory, released_string_offset);
+  sc_monitor_release_read(&memory->compaction_monitor);
 
-  sc_monitor_release_write(channel_monitor);
   return SC_FS_MEMORY_OK;
-
-error:
-  sc_monitor_release_write(channel_monitor);
-  return SC_FS_MEMORY_READ_ERROR;
 }
 
-void _sc_dictionary_fs_memory_read_file(sc_char * file_path, sc_char ** content, sc_uint32 * size)
-{
-  if (sc_fs_is_binary_file(file_path))
-  {
-    sc_char * data;
-    sc_fs_get_file_content(file_path, &data, size);
-    *content = g_base64_encode((sc_uchar *)data, *size);
-    sc_mem_free(data);
-  }
-  else
-    sc_fs_get_file_content(file_path, content, size);
-}
-
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash_ext(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash const link_hash,
     sc_char ** string,
-    sc_uint64 * string_size)
+    sc_uint64 * string_size,
+    sc_bool * is_file_path)
 {
+  if (is_file_path != null_ptr)
+    *is_file_path = SC_FALSE;
+
   if (memory == null_ptr)
   {
     sc_fs_memory_info("Memory is empty to get string by link hash");
@@ -654,19 +885,23 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
   sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
   sc_uint64 link_hash_str_size;
   sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
+
+  sc_monitor_acquire_read(&memory->compaction_monitor);
   sc_link_hash_content * content =
       sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
 
   if (content == null_ptr)
   {
+    sc_monitor_release_read(&memory->compaction_monitor);
     *string = null_ptr;
     *string_size = 0;
     return SC_FS_MEMORY_NO_STRING;
   }
 
   sc_uint64 const string_offset = (sc_uint64)content->string_offset - 1;
-  sc_dictionary_fs_memory_status const status =
-      _sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, string);
+  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_read_string_by_offset_ext(
+      memory, string_offset, SC_FALSE, string, string_size, is_file_path);
+  sc_monitor_release_read(&memory->compaction_monitor);
   if (status != SC_FS_MEMORY_OK)
   {
     *string = null_ptr;
@@ -674,39 +909,32 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     return SC_FS_MEMORY_READ_ERROR;
   }
 
-  if ((sc_str_find(*string, ".") || sc_str_find(*string, "/")) && sc_fs_is_file(*string))
-  {
-    sc_char * file_path = *string;
-    sc_uint32 size;
-    _sc_dictionary_fs_memory_read_file(file_path, string, &size);
-    *string_size = size;
-    sc_mem_free(file_path);
-  }
-
-  *string_size = sc_str_len(*string);
-
   return SC_FS_MEMORY_OK;
 }
 
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_char ** string,
+    sc_uint64 * string_size)
+{
+  return sc_dictionary_fs_memory_get_string_by_link_hash_ext(memory, link_hash, string, string_size, null_ptr);
+}
+
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
     sc_uint64 const string_size,
     sc_bool const is_substring,
     sc_bool const to_search_as_prefix,
-    sc_list const * string_offsets,
+    sc_term_string_offsets * string_offsets,
     void * data,
     void (*callback)(void * data, sc_addr const link_addr))
 {
-  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
-  if (!sc_iterator_next(string_offset_it))
-    return SC_FS_MEMORY_NO_STRING;
-
   sc_monitor * channel_monitor;
-  while (sc_iterator_next(string_offset_it))
+  sc_uint64 string_offset;
+  while (_sc_term_string_offsets_next(string_offsets, &string_offset))
   {
-    sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
-
     sc_io_channel * strings_channel =
         _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
     if (strings_channel == null_ptr)
@@ -777,16 +1005,30 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
     }
     sc_iterator_destroy(data_it);
   }
-  sc_iterator_destroy(string_offset_it);
 
   return SC_FS_MEMORY_OK;
 
 error:
   sc_monitor_release_write(channel_monitor);
-  sc_iterator_destroy(string_offset_it);
   return SC_FS_MEMORY_READ_ERROR;
 }
 
+void _sc_dictionary_fs_memory_push_linked_string_offset(
+    sc_dictionary_fs_memory const * memory,
+    sc_list * string_offsets,
+    sc_uint64 const string_offset)
+{
+  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 string_offset_str_size;
+  sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
+
+  // skip strings without links
+  sc_list * link_hashes = sc_dictionary_get_by_key(
+      memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
+  if (link_hashes != null_ptr && link_hashes->size != 0)
+    sc_list_push_back(string_offsets, (void *)string_offset);
+}
+
 sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictionary_node * node, void ** arguments)
 {
   if (node->data == null_ptr)
@@ -802,23 +1044,28 @@ sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictiona
   }
 
   while (sc_iterator_next(it))
-  {
-    sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(it);
-    sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-    sc_uint64 string_offset_str_size;
-    sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
-
-    // skip strings without links
-    sc_list * link_hashes = sc_dictionary_get_by_key(
-        memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
-    if (link_hashes != null_ptr && link_hashes->size != 0)
-      sc_list_push_back(string_offsets, (void *)string_offset);
-  }
+    _sc_dictionary_fs_memory_push_linked_string_offset(memory, string_offsets, (sc_uint64)sc_iterator_get(it));
   sc_iterator_destroy(it);
 
   return SC_TRUE;
 }
 
+sc_bool _sc_dictionary_fs_memory_visit_index_string_offsets_by_term_prefix(
+    sc_char const * term,
+    sc_uint64 const term_size,
+    sc_uint64 const * term_string_offsets,
+    sc_uint64 const term_string_offsets_count,
+    void ** arguments)
+{
+  sc_dictionary_fs_memory * memory = arguments[0];
+  sc_list * string_offsets = arguments[1];
+
+  for (sc_uint64 i = 0; i < term_string_offsets_count; ++i)
+    _sc_dictionary_fs_memory_push_linked_string_offset(memory, string_offsets, term_string_offsets[i]);
+
+  return SC_TRUE;
+}
+
 sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(
     sc_dictionary_fs_memory const * memory,
     sc_char const * term)
@@ -832,6 +1079,21 @@ sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(
   arguments[0] = (void *)memory;
   arguments[1] = string_offsets;
 
+  sc_fs_memory_terms_index_visit_by_prefix(
+      memory->terms_string_offsets_index,
+      term,
+      term_size,
+      _sc_dictionary_fs_memory_visit_index_string_offsets_by_term_prefix,
+      arguments);
+
+  if (memory->merged_terms_string_offsets_dictionary != null_ptr)
+    sc_dictionary_get_by_key_prefix(
+        memory->merged_terms_string_offsets_dictionary,
+        term,
+        term_size,
+        _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix,
+        arguments);
+
   sc_dictionary_get_by_key_prefix(
       memory->terms_string_offsets_dictionary,
       term,
@@ -857,19 +1119,28 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
     return SC_FS_MEMORY_NO;
   }
 
+  sc_monitor_acquire_read(&memory->compaction_monitor);
+
   sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
-  sc_list * string_offsets = null_ptr;
+  sc_term_string_offsets string_offsets;
+  sc_list * prefix_string_offsets = null_ptr;
+  sc_bool is_found = SC_TRUE;
   if (is_substring)
-    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term);
+  {
+    prefix_string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term);
+    _sc_term_string_offsets_init_by_list(&string_offsets, prefix_string_offsets);
+  }
   else
-    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
+    is_found = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term, &string_offsets);
   sc_mem_free(term);
 
-  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
-      memory, string, string_size, is_substring, to_search_as_prefix, string_offsets, data, callback);
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_NO_STRING;
+  if (is_found)
+    status = _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
+        memory, string, string_size, is_substring, to_search_as_prefix, &string_offsets, data, callback);
+  sc_list_destroy(prefix_string_offsets);
 
-  if (is_substring)
-    sc_list_destroy(string_offsets);
+  sc_monitor_release_read(&memory->compaction_monitor);
 
   return status;
 }
@@ -908,6 +1179,23 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_substr
       memory, string, string_size, SC_TRUE, SC_FALSE, data, callback);
 }
 
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_number_range(
+    sc_dictionary_fs_memory * memory,
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr))
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to get link hashes by number range");
+    return SC_FS_MEMORY_NO;
+  }
+
+  return sc_fs_memory_numeric_index_get_link_hashes_by_range(
+      memory->numeric_index, min_value, max_value, data, callback);
+}
+
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring_term(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
@@ -1005,6 +1293,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
     return SC_FS_MEMORY_NO;
   }
 
+  sc_monitor_acquire_read(&memory->compaction_monitor);
+
   sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
   sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term);
   sc_mem_free(term);
@@ -1013,6 +1303,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
       memory, string, string_size, to_search_as_prefix, string_offsets, data, callback);
   sc_list_destroy(string_offsets);
 
+  sc_monitor_release_read(&memory->compaction_monitor);
+
   return status;
 }
 
@@ -1078,19 +1370,14 @@ void _sc_dictionary_fs_memory_get_string_offsets_by_terms(
   while (sc_iterator_next(term_it))
   {
     sc_char const * term = sc_iterator_get(term_it);
-    sc_uint64 const term_size = sc_str_len(term);
 
-    sc_list * string_offsets = sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, term, term_size);
-    sc_iterator * string_offsets_it = sc_list_iterator(string_offsets);
-    if (!sc_iterator_next(string_offsets_it))
-    {
-      sc_iterator_destroy(string_offsets_it);
-      return;
-    }
+    sc_term_string_offsets string_offsets;
+    if (_sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term, &string_offsets) == SC_FALSE)
+      continue;
 
-    while (sc_iterator_next(string_offsets_it))
+    sc_uint64 string_offset;
+    while (_sc_term_string_offsets_next(&string_offsets, &string_offset))
     {
-      sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(string_offsets_it);
       sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
       sc_uint64 string_offset_str_size;
       sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
@@ -1098,7 +1385,6 @@ void _sc_dictionary_fs_memory_get_string_offsets_by_terms(
       _sc_dictionary_fs_memory_append(
           *string_offsets_terms_dictionary, string_offset_str, string_offset_str_size, (void *)term);
     }
-    sc_iterator_destroy(string_offsets_it);
   }
   sc_iterator_destroy(term_it);
 }
@@ -1119,6 +1405,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_terms
   if (terms->size == 0)
     return SC_FS_MEMORY_OK;
 
+  sc_monitor_acquire_read((sc_monitor *)&memory->compaction_monitor);
+
   sc_dictionary * string_offsets_terms_dictionary;
   _sc_dictionary_fs_memory_get_string_offsets_by_terms(memory, terms, &string_offsets_terms_dictionary);
 
@@ -1129,6 +1417,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_terms
   sc_dictionary_fs_memory_status const status = sc_dictionary_visit_down_nodes(
       string_offsets_terms_dictionary, _sc_dictionary_fs_memory_get_link_hashes_by_string_offsets, arguments);
   sc_dictionary_destroy(string_offsets_terms_dictionary, _sc_dictionary_fs_memory_node_clear);
+
+  sc_monitor_release_read((sc_monitor *)&memory->compaction_monitor);
   return status;
 }
 
@@ -1193,6 +1483,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_terms(
   if (terms->size == 0)
     return SC_FS_MEMORY_OK;
 
+  sc_monitor_acquire_read((sc_monitor *)&memory->compaction_monitor);
+
   sc_dictionary * term_string_offsets_dictionary;
   _sc_dictionary_fs_memory_get_string_offsets_by_terms(memory, terms, &term_string_offsets_dictionary);
 
@@ -1204,6 +1496,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_terms(
       term_string_offsets_dictionary, _sc_dictionary_fs_memory_get_string_by_string_offsets, arguments);
   sc_dictionary_destroy(term_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
 
+  sc_monitor_release_read((sc_monitor *)&memory->compaction_monitor);
+
   return SC_FS_MEMORY_OK;
 }
 
@@ -1260,9 +1554,29 @@ void _sc_dictionary_fs_memory_read_terms_string_offsets(sc_dictionary_fs_memory
   }
 }
 
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_map_terms_index(sc_dictionary_fs_memory * memory)
+{
+  sc_dictionary_fs_memory_status const status = sc_fs_memory_terms_index_map(
+      memory->terms_string_offsets_path, &memory->terms_string_offsets_index, &memory->last_string_offset);
+  if (status != SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_error("Terms index `%s` is not valid", memory->terms_string_offsets_path);
+    return status;
+  }
+
+  sc_fs_memory_info(
+      "Terms index with %" PRIu64 " terms mapped",
+      sc_fs_memory_terms_index_get_terms_count(memory->terms_string_offsets_index));
+  return SC_FS_MEMORY_OK;
+}
+
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_terms_offsets(sc_dictionary_fs_memory * memory)
 {
   sc_fs_memory_info("Load `term - offsets` dictionary from %s", memory->terms_string_offsets_path);
+  // terms index is queried in place, terms saved in previous format are loaded into dictionary
+  if (sc_fs_memory_terms_index_is_file(memory->terms_string_offsets_path))
+    return _sc_dictionary_fs_memory_map_terms_index(memory);
+
   sc_io_channel * terms_offsets_channel = sc_io_new_read_channel(memory->terms_string_offsets_path, null_ptr);
   if (terms_offsets_channel == null_ptr)
   {
@@ -1315,7 +1629,7 @@ void _sc_dictionary_fs_memory_read_string_offsets_link_hashes(sc_dictionary_fs_m
           || sizeof(sc_addr_hash) != read_bytes)
         break;
 
-      _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+      _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset, null_ptr, null_ptr);
     }
   }
 }
@@ -1340,6 +1654,77 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_string_offsets_link
   return SC_FS_MEMORY_OK;
 }
 
+sc_bool _sc_dictionary_fs_memory_index_link_hash_number(sc_dictionary_node * node, void ** arguments)
+{
+  sc_link_hash_content const * content = node->data;
+  if (content == null_ptr)
+    return SC_TRUE;
+
+  sc_dictionary_fs_memory * memory = arguments[0];
+  sc_hash_table * indexed_string_offsets = arguments[1];
+
+  // sc-links with the same string share list of link hashes, so every string is read once
+  if (sc_hash_table_get(indexed_string_offsets, (sc_pointer)content->string_offset) != null_ptr)
+    return SC_TRUE;
+  sc_hash_table_insert(indexed_string_offsets, (sc_pointer)content->string_offset, (sc_pointer)content->string_offset);
+
+  sc_uint64 const string_offset = content->string_offset - 1;
+  sc_uint64 string_size;
+  sc_bool is_file_path;
+  if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+          memory, string_offset, SC_TRUE, null_ptr, &string_size, &is_file_path)
+          != SC_FS_MEMORY_OK
+      || is_file_path || string_size == 0 || string_size > SC_FS_MEMORY_NUMERIC_INDEX_MAX_STRING_SIZE)
+    return SC_TRUE;
+
+  sc_char * string = null_ptr;
+  if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+          memory, string_offset, SC_FALSE, &string, &string_size, null_ptr)
+      != SC_FS_MEMORY_OK)
+    return SC_TRUE;
+
+  sc_iterator * link_hashes_it = sc_list_iterator(content->link_hashes);
+  while (sc_iterator_next(link_hashes_it))
+  {
+    sc_addr_hash const link_hash = (sc_pointer_to_sc_addr_hash)sc_iterator_get(link_hashes_it);
+    sc_fs_memory_numeric_index_update(memory->numeric_index, link_hash, string, string_size);
+  }
+  sc_iterator_destroy(link_hashes_it);
+  sc_mem_free(string);
+
+  return SC_TRUE;
+}
+
+void _sc_dictionary_fs_memory_build_numeric_index(sc_dictionary_fs_memory * memory)
+{
+  sc_hash_table * indexed_string_offsets = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  void * arguments[2];
+  arguments[0] = memory;
+  arguments[1] = indexed_string_offsets;
+  sc_dictionary_visit_down_nodes(
+      memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_index_link_hash_number, arguments);
+  sc_hash_table_destroy(indexed_string_offsets);
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_numeric_index(sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Load numeric index from %s", memory->numeric_index_path);
+  sc_dictionary_fs_memory_status const status =
+      sc_fs_memory_numeric_index_read(memory->numeric_index_path, memory->strings_save_id, memory->numeric_index);
+  // numeric index is absent in memory saved by previous versions or stale if save was interrupted before strings meta
+  // was written, it is built from sc-links strings
+  if (status != SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_info("Numeric index `%s` is absent or not valid. Build it", memory->numeric_index_path);
+    _sc_dictionary_fs_memory_build_numeric_index(memory);
+  }
+
+  sc_fs_memory_info(
+      "Numeric index with %" PRIu64 " sc-links loaded",
+      sc_fs_memory_numeric_index_get_size(memory->numeric_index));
+  return SC_FS_MEMORY_OK;
+}
+
 sc_fs_memory_status _sc_dictionary_fs_memory_load_deprecated_dictionaries(sc_dictionary_fs_memory * memory)
 {
   sc_char * strings_path;
@@ -1409,186 +1794,446 @@ sc_fs_memory_status _sc_dictionary_fs_memory_load_deprecated_dictionaries(sc_dic
   return SC_FS_MEMORY_OK;
 }
 
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_memory * memory)
+void _sc_dictionary_fs_memory_get_compaction_commit_path(sc_dictionary_fs_memory const * memory, sc_char ** path)
 {
-  if (memory == null_ptr)
-  {
-    sc_fs_memory_info("Memory is empty to load dictionaries");
-    return SC_FS_MEMORY_NO;
-  }
-
-  sc_fs_memory_info("Load sc-fs-memory dictionaries");
-
-  if (_sc_dictionary_fs_memory_load_deprecated_dictionaries(memory) != SC_FS_MEMORY_OK)
-    _sc_dictionary_fs_memory_load_terms_offsets(memory);
-
-  sc_message("\tLast string offset: %" PRIu64, memory->last_string_offset);
-
-  _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
-
-  sc_fs_memory_info("All sc-fs-memory dictionaries loaded");
-
-  return SC_FS_MEMORY_OK;
+  static sc_char const * strings_compaction = "strings_compaction" SC_FS_EXT;
+  sc_fs_concat_path(memory->path, strings_compaction, path);
 }
 
-sc_bool _sc_dictionary_fs_memory_write_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+void _sc_dictionary_fs_memory_get_compacted_path(sc_char const * path, sc_char ** compacted_path)
 {
-  if (node->data == null_ptr)
-    return SC_TRUE;
-
-  sc_io_channel * channel = arguments[0];
+  sc_str_concat(path, SC_FS_COMPACTED_EXT, *compacted_path);
+}
 
-  sc_list * list = node->data;
-  sc_iterator * data_it = sc_list_iterator(list);
+//! Removes files written by compaction that wasn't committed, saved strings channels and dictionaries are kept
+void _sc_dictionary_fs_memory_remove_compacted_files(sc_dictionary_fs_memory const * memory)
+{
+  // compacted strings channels are always created in order of their offsets
+  for (sc_uint64 i = 0; i < memory->max_strings_channels; ++i)
+  {
+    sc_char * strings_path;
+    _sc_dictionary_fs_memory_get_strings_channel_path(memory, SC_FS_COMPACTED_STRINGS_CHANNEL_PREFIX, i, &strings_path);
+    sc_bool const is_removed = sc_fs_remove_file(strings_path);
+    sc_mem_free(strings_path);
+    if (is_removed == SC_FALSE)
+      break;
+  }
 
-  // save term and string offsets in fs-memory
-  sc_uint64 written_bytes = 0;
-  if (sc_iterator_next(data_it))
+  sc_char const * dictionaries_paths[] = {
+      memory->terms_string_offsets_path, memory->string_offsets_link_hashes_path, memory->strings_meta_path};
+  for (sc_uint64 i = 0; i < sizeof(dictionaries_paths) / sizeof(dictionaries_paths[0]); ++i)
   {
-    sc_char * term = sc_iterator_get(data_it);
-    sc_uint64 const term_size = sc_str_len(term);
-    if (sc_io_channel_write_chars(channel, (sc_char *)&term_size, sizeof(sc_uint64), &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != written_bytes)
+    sc_char * compacted_path;
+    _sc_dictionary_fs_memory_get_compacted_path(dictionaries_paths[i], &compacted_path);
+    sc_fs_remove_file(compacted_path);
+    sc_char * tmp_path;
     {
-      sc_fs_memory_error("Error while attribute `term_size` writing");
-      goto error;
+      sc_str_concat(compacted_path, SC_FS_TMP_EXT, tmp_path);
     }
+    sc_fs_remove_file(tmp_path);
+    sc_mem_free(tmp_path);
+    sc_mem_free(compacted_path);
+  }
+}
 
-    if (sc_io_channel_write_chars(channel, (sc_char *)term, term_size, &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || term_size != written_bytes)
+/*! Replaces strings channels and dictionaries with compacted ones. Every file is renamed over the saved one, so every
+ * step can be repeated after crash until commit file is removed.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_replace_compacted_files(
+    sc_dictionary_fs_memory const * memory,
+    sc_uint64 const compacted_channels_count)
+{
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  for (sc_uint64 i = 0; i < memory->max_strings_channels; ++i)
+  {
+    sc_char * compacted_strings_path;
+    _sc_dictionary_fs_memory_get_strings_channel_path(
+        memory, SC_FS_COMPACTED_STRINGS_CHANNEL_PREFIX, i, &compacted_strings_path);
+    sc_char * strings_path;
+    _sc_dictionary_fs_memory_get_strings_channel_path(memory, SC_FS_STRINGS_CHANNEL_PREFIX, i, &strings_path);
+
+    if (sc_fs_is_file(compacted_strings_path))
     {
-      sc_mem_free(term);
-      sc_fs_memory_error("Error while attribute `term` writing");
-      goto error;
+      if (sc_fs_rename_file(compacted_strings_path, strings_path) == SC_FALSE)
+      {
+        sc_fs_memory_error("Compacted strings channel `%s` can't be renamed", compacted_strings_path);
+        status = SC_FS_MEMORY_WRITE_ERROR;
+      }
     }
-
-    sc_uint64 const string_offsets_count = list->size - 1;
-    if (sc_io_channel_write_chars(
-            channel, (sc_char *)&string_offsets_count, sizeof(sc_uint64), &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != written_bytes)
+    else if (
+        i >= compacted_channels_count && sc_fs_is_file(strings_path) && sc_fs_remove_file(strings_path) == SC_FALSE)
     {
-      sc_mem_free(term);
-      sc_fs_memory_error("Error while attribute `string_offsets_count` writing");
-      goto error;
+      sc_fs_memory_error("Strings channel `%s` can't be removed", strings_path);
+      status = SC_FS_MEMORY_WRITE_ERROR;
     }
 
-    while (sc_iterator_next(data_it))
+    sc_mem_free(compacted_strings_path);
+    sc_mem_free(strings_path);
+  }
+
+  sc_char const * dictionaries_paths[] = {
+      memory->terms_string_offsets_path, memory->string_offsets_link_hashes_path, memory->strings_meta_path};
+  for (sc_uint64 i = 0; i < sizeof(dictionaries_paths) / sizeof(dictionaries_paths[0]); ++i)
+  {
+    sc_char * compacted_path;
+    _sc_dictionary_fs_memory_get_compacted_path(dictionaries_paths[i], &compacted_path);
+    if (sc_fs_is_file(compacted_path) && sc_fs_rename_file(compacted_path, dictionaries_paths[i]) == SC_FALSE)
     {
-      sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(data_it);
-      if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(string_offset), &written_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != written_bytes)
-      {
-        sc_mem_free(term);
-        sc_fs_memory_error("Error while attribute `string_offset` writing");
-        goto error;
-      }
+      sc_fs_memory_error("Compacted dictionary `%s` can't be renamed", compacted_path);
+      status = SC_FS_MEMORY_WRITE_ERROR;
     }
+    sc_mem_free(compacted_path);
   }
 
-  sc_iterator_destroy(data_it);
-  return SC_TRUE;
+  sc_fs_sync(memory->path);
+  return status;
+}
 
-error:
+//! Completes compaction interrupted after its commit or removes files of compaction interrupted before it
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_recover_compaction(sc_dictionary_fs_memory const * memory)
 {
-  sc_iterator_destroy(data_it);
-  return SC_FALSE;
-}
+  sc_char * commit_path;
+  _sc_dictionary_fs_memory_get_compaction_commit_path(memory, &commit_path);
+
+  sc_uint64 compacted_channels_count = 0;
+  sc_uint64 read_bytes = 0;
+  sc_io_channel * channel = sc_io_new_read_channel(commit_path, null_ptr);
+  sc_bool is_committed = SC_FALSE;
+  if (channel != null_ptr)
+  {
+    sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+    is_committed = sc_io_channel_read_chars(
+                       channel, (sc_char *)&compacted_channels_count, sizeof(sc_uint64), &read_bytes, null_ptr)
+                       == SC_FS_IO_STATUS_NORMAL
+                   && read_bytes == sizeof(sc_uint64);
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  }
+
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_NO;
+  if (is_committed)
+  {
+    status = _sc_dictionary_fs_memory_replace_compacted_files(memory, compacted_channels_count);
+    if (status == SC_FS_MEMORY_OK)
+    {
+      sc_fs_remove_file(commit_path);
+      sc_fs_sync(memory->path);
+    }
+  }
+  else
+    _sc_dictionary_fs_memory_remove_compacted_files(memory);
+
+  sc_mem_free(commit_path);
+  return status;
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_term_string_offsets(sc_dictionary_fs_memory const * memory)
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_strings_meta(
+    sc_dictionary_fs_memory * memory,
+    sc_uint32 * format_version)
 {
-  sc_io_channel * channel = sc_io_new_write_channel(memory->terms_string_offsets_path, null_ptr);
+  *format_version = SC_FS_STRINGS_FORMAT_VERSION;
+  sc_io_channel * channel = sc_io_new_read_channel(memory->strings_meta_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    // strings channels saved before unreferenced strings were counted are compacted when enough strings are released
+    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->strings_meta_path);
+    *format_version = 1;
+    return SC_FS_MEMORY_NO;
+  }
   sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
 
-  sc_uint64 written_bytes = 0;
-  if (sc_io_channel_write_chars(
-          channel, (sc_char *)&memory->last_string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  sc_uint32 version = 0;
+  sc_uint64 unreferenced_strings_size = 0;
+  sc_uint64 read_bytes = 0;
+  if (sc_io_channel_read_chars(channel, (sc_char *)&version, sizeof(version), &read_bytes, null_ptr)
           != SC_FS_IO_STATUS_NORMAL
-      || sizeof(sc_uint64) != written_bytes)
+      || sizeof(version) != read_bytes
+      || sc_io_channel_read_chars(
+             channel, (sc_char *)&unreferenced_strings_size, sizeof(unreferenced_strings_size), &read_bytes, null_ptr)
+             != SC_FS_IO_STATUS_NORMAL
+      || sizeof(unreferenced_strings_size) != read_bytes)
   {
-    sc_fs_memory_error("Error while attribute `last_string_offset` writing");
-    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
-    return SC_FS_MEMORY_WRITE_ERROR;
+    sc_fs_memory_warning("Strings meta `%s` is corrupted", memory->strings_meta_path);
+    status = SC_FS_MEMORY_NO;
   }
-
-  if (!sc_dictionary_visit_down_nodes(
-          memory->terms_string_offsets_dictionary,
-          _sc_dictionary_fs_memory_write_term_string_offsets,
-          (void **)&channel))
+  else if (version > SC_FS_STRINGS_FORMAT_VERSION)
   {
-    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
-    return SC_FS_MEMORY_WRITE_ERROR;
+    sc_fs_memory_error(
+        "Strings channels format version %u is not supported, max supported version is %u",
+        version,
+        SC_FS_STRINGS_FORMAT_VERSION);
+    status = SC_FS_MEMORY_READ_ERROR;
+  }
+  else
+  {
+    *format_version = version;
+    memory->unreferenced_strings_size = unreferenced_strings_size;
+
+    // strings meta saved by previous versions has no save identifier, numeric index saved with it is rebuilt
+    sc_uint64 strings_save_id = 0;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&strings_save_id, sizeof(strings_save_id), &read_bytes, null_ptr)
+            == SC_FS_IO_STATUS_NORMAL
+        && sizeof(strings_save_id) == read_bytes)
+      memory->strings_save_id = strings_save_id;
   }
 
   sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
-  sc_fs_memory_info("Dictionary `term - offsets` written");
-  return SC_FS_MEMORY_OK;
+  return status;
 }
 
-sc_bool _sc_dictionary_fs_memory_write_string_offsets_link_hashes(sc_dictionary_node * node, void ** arguments)
+sc_bool _sc_dictionary_fs_memory_migrate_file_path(sc_dictionary_node * node, void ** arguments)
 {
-  if (node->data == null_ptr)
-    return SC_TRUE;
-
-  sc_io_channel * channel = arguments[0];
-
   sc_link_hash_content * content = node->data;
-  sc_iterator * data_it = sc_list_iterator(content->link_hashes);
+  if (content == null_ptr)
+    return SC_TRUE;
 
-  sc_uint64 written_bytes = 0;
+  sc_dictionary_fs_memory * memory = arguments[0];
   sc_uint64 const string_offset = content->string_offset - 1;
-  if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
-          != SC_FS_IO_STATUS_NORMAL
-      || sizeof(sc_uint64) != written_bytes)
-  {
-    sc_fs_memory_error("Error while attribute `string_offset` writing");
-    goto error;
-  }
+  sc_char * string;
+  sc_uint64 string_size;
+  sc_bool is_file_path;
+  if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+          memory, string_offset, SC_FALSE, &string, &string_size, &is_file_path)
+      != SC_FS_MEMORY_OK)
+    return SC_TRUE;
 
-  sc_uint64 const link_hashes_count = content->link_hashes->size;
-  if (sc_io_channel_write_chars(channel, (sc_char *)&link_hashes_count, sizeof(sc_uint64), &written_bytes, null_ptr)
-          != SC_FS_IO_STATUS_NORMAL
-      || sizeof(sc_uint64) != written_bytes)
+  // strings of format version 1 were resolved to file contents if they were paths to existing files
+  if (is_file_path == SC_FALSE && (sc_str_find(string, ".") || sc_str_find(string, "/")) && sc_fs_is_file(string))
   {
-    sc_fs_memory_error("Error while attribute `link_hashes_count` writing");
-    goto error;
-  }
+    sc_monitor * channel_monitor;
+    sc_io_channel * strings_channel =
+        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+    sc_uint64 const stored_string_size = string_size | SC_FS_FILE_PATH_STRING_FLAG;
+    sc_uint64 written_bytes = 0;
 
-  while (sc_iterator_next(data_it))
-  {
-    sc_addr_hash const link_hash = (sc_uint64)sc_iterator_get(data_it);
-    if (sc_io_channel_write_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &written_bytes, null_ptr)
+    sc_monitor_acquire_write(channel_monitor);
+    sc_io_channel_seek(
+        strings_channel, _sc_dictionary_fs_memory_normalize_offset(memory, string_offset), SC_FS_IO_SEEK_SET, null_ptr);
+    if (sc_io_channel_write_chars(
+            strings_channel, &stored_string_size, sizeof(stored_string_size), &written_bytes, null_ptr)
             != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_addr_hash) != written_bytes)
-    {
-      sc_fs_memory_error("Error while attribute `link_hash` writing");
-      goto error;
-    }
+        || sizeof(stored_string_size) != written_bytes)
+      sc_fs_memory_error("Error while file path with offset %" PRIu64 " migrating", string_offset);
+    sc_monitor_release_write(channel_monitor);
   }
 
-  sc_iterator_destroy(data_it);
+  sc_mem_free(string);
   return SC_TRUE;
+}
 
-error:
+//! Marks file paths stored as strings by previous format of strings channels, so they are got as file contents
+void _sc_dictionary_fs_memory_migrate_file_paths(sc_dictionary_fs_memory * memory)
 {
-  sc_iterator_destroy(data_it);
-  return SC_FALSE;
-}
+  sc_fs_memory_info("Migrate file paths of strings channels format version 1");
+  void * arguments[1];
+  arguments[0] = memory;
+  sc_dictionary_visit_down_nodes(
+      memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_migrate_file_path, arguments);
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link_hashes(
-    sc_dictionary_fs_memory const * memory)
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_memory * memory)
 {
-  sc_io_channel * channel = sc_io_new_write_channel(memory->string_offsets_link_hashes_path, null_ptr);
-  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
-
-  if (!sc_dictionary_visit_down_nodes(
-          memory->link_hashes_string_offsets_dictionary,
-          _sc_dictionary_fs_memory_write_string_offsets_link_hashes,
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to load dictionaries");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_fs_memory_info("Load sc-fs-memory dictionaries");
+
+  if (_sc_dictionary_fs_memory_recover_compaction(memory) == SC_FS_MEMORY_OK)
+    sc_fs_memory_info("Interrupted strings channels compaction completed");
+
+  // strings channels of newer format can't be read, string sizes and file paths are distinguished by format version
+  sc_uint32 format_version;
+  if (_sc_dictionary_fs_memory_load_strings_meta(memory, &format_version) == SC_FS_MEMORY_READ_ERROR)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  if (_sc_dictionary_fs_memory_load_deprecated_dictionaries(memory) != SC_FS_MEMORY_OK)
+    _sc_dictionary_fs_memory_load_terms_offsets(memory);
+
+  sc_message("\tLast string offset: %" PRIu64, memory->last_string_offset);
+  memory->unreferenced_strings_size = sc_min(memory->unreferenced_strings_size, memory->last_string_offset);
+  sc_message("\tUnreferenced strings size: %" PRIu64, memory->unreferenced_strings_size);
+
+  _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
+  if (format_version < SC_FS_STRINGS_FORMAT_VERSION)
+    _sc_dictionary_fs_memory_migrate_file_paths(memory);
+
+  _sc_dictionary_fs_memory_load_numeric_index(memory);
+
+  sc_fs_memory_info("All sc-fs-memory dictionaries loaded");
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_append_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+{
+  sc_list * term_string_offsets = node->data;
+  if (term_string_offsets == null_ptr)
+    return SC_TRUE;
+
+  sc_dictionary * dictionary = arguments[0];
+
+  sc_iterator * string_offset_it = sc_list_iterator(term_string_offsets);
+  // the first list item is a term
+  if (sc_iterator_next(string_offset_it))
+  {
+    sc_char const * term = sc_iterator_get(string_offset_it);
+    sc_uint64 const term_size = sc_str_len(term);
+    while (sc_iterator_next(string_offset_it))
+      _sc_dictionary_fs_memory_append(dictionary, term, term_size, sc_iterator_get(string_offset_it));
+  }
+  sc_iterator_destroy(string_offset_it);
+
+  return SC_TRUE;
+}
+
+//! Moves terms added after terms index was written into dictionary being merged, new terms go into empty dictionary
+void _sc_dictionary_fs_memory_freeze_terms(sc_dictionary_fs_memory * memory)
+{
+  memory->merged_terms_string_offsets_dictionary = memory->terms_string_offsets_dictionary;
+  _sc_uchar_dictionary_initialize(&memory->terms_string_offsets_dictionary);
+}
+
+//! Returns terms that aren't merged into terms index into dictionary of new terms
+void _sc_dictionary_fs_memory_unfreeze_terms(sc_dictionary_fs_memory * memory)
+{
+  sc_dictionary_visit_down_nodes(
+      memory->merged_terms_string_offsets_dictionary,
+      _sc_dictionary_fs_memory_append_term_string_offsets,
+      (void **)&memory->terms_string_offsets_dictionary);
+  sc_dictionary_destroy(memory->merged_terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+  memory->merged_terms_string_offsets_dictionary = null_ptr;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_terms_index(
+    sc_dictionary_fs_memory const * memory,
+    sc_char const * path,
+    sc_dictionary * terms_dictionary,
+    sc_uint64 const last_string_offset,
+    sc_fs_memory_terms_index ** index)
+{
+  sc_dictionary_fs_memory_status status =
+      sc_fs_memory_terms_index_write(path, last_string_offset, memory->terms_string_offsets_index, terms_dictionary);
+  if (status != SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_error("Error while terms index `%s` writing", path);
+    return status;
+  }
+
+  sc_uint64 saved_last_string_offset;
+  status = sc_fs_memory_terms_index_map(path, index, &saved_last_string_offset);
+  if (status != SC_FS_MEMORY_OK)
+    sc_fs_memory_error("Written terms index `%s` can't be mapped", path);
+
+  return status;
+}
+
+void _sc_dictionary_fs_memory_replace_terms_index(sc_dictionary_fs_memory * memory, sc_fs_memory_terms_index * index)
+{
+  sc_fs_memory_terms_index_unmap(memory->terms_string_offsets_index);
+  memory->terms_string_offsets_index = index;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_term_string_offsets(sc_dictionary_fs_memory * memory)
+{
+  // new terms are added into empty dictionary while saved ones are merged into terms index
+  sc_monitor_acquire_write(&memory->compaction_monitor);
+  sc_uint64 const last_string_offset = memory->last_string_offset;
+  _sc_dictionary_fs_memory_freeze_terms(memory);
+  sc_monitor_release_write(&memory->compaction_monitor);
+
+  // terms index is written while other string operations are not blocked
+  sc_fs_memory_terms_index * index = null_ptr;
+  sc_monitor_acquire_read(&memory->compaction_monitor);
+  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_write_terms_index(
+      memory,
+      memory->terms_string_offsets_path,
+      memory->merged_terms_string_offsets_dictionary,
+      last_string_offset,
+      &index);
+  sc_monitor_release_read(&memory->compaction_monitor);
+
+  sc_monitor_acquire_write(&memory->compaction_monitor);
+  if (status == SC_FS_MEMORY_OK)
+  {
+    _sc_dictionary_fs_memory_replace_terms_index(memory, index);
+    sc_dictionary_destroy(memory->merged_terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+    memory->merged_terms_string_offsets_dictionary = null_ptr;
+  }
+  else
+    _sc_dictionary_fs_memory_unfreeze_terms(memory);
+  sc_monitor_release_write(&memory->compaction_monitor);
+
+  if (status == SC_FS_MEMORY_OK)
+    sc_fs_memory_info("Terms index `term - offsets` written");
+  return status;
+}
+
+sc_bool _sc_dictionary_fs_memory_write_string_offsets_link_hashes(sc_dictionary_node * node, void ** arguments)
+{
+  if (node->data == null_ptr)
+    return SC_TRUE;
+
+  sc_io_channel * channel = arguments[0];
+
+  sc_link_hash_content * content = node->data;
+  sc_iterator * data_it = sc_list_iterator(content->link_hashes);
+
+  sc_uint64 written_bytes = 0;
+  sc_uint64 const string_offset = content->string_offset - 1;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != written_bytes)
+  {
+    sc_fs_memory_error("Error while attribute `string_offset` writing");
+    goto error;
+  }
+
+  sc_uint64 const link_hashes_count = content->link_hashes->size;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&link_hashes_count, sizeof(sc_uint64), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != written_bytes)
+  {
+    sc_fs_memory_error("Error while attribute `link_hashes_count` writing");
+    goto error;
+  }
+
+  while (sc_iterator_next(data_it))
+  {
+    sc_addr_hash const link_hash = (sc_uint64)sc_iterator_get(data_it);
+    if (sc_io_channel_write_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &written_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_addr_hash) != written_bytes)
+    {
+      sc_fs_memory_error("Error while attribute `link_hash` writing");
+      goto error;
+    }
+  }
+
+  sc_iterator_destroy(data_it);
+  return SC_TRUE;
+
+error:
+{
+  sc_iterator_destroy(data_it);
+  return SC_FALSE;
+}
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link_hashes(
+    sc_dictionary_fs_memory const * memory,
+    sc_char const * path)
+{
+  sc_io_channel * channel = sc_io_new_write_channel(path, null_ptr);
+  if (channel == null_ptr)
+    return SC_FS_MEMORY_WRONG_PATH;
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  if (!sc_dictionary_visit_down_nodes(
+          memory->link_hashes_string_offsets_dictionary,
+          _sc_dictionary_fs_memory_write_string_offsets_link_hashes,
           (void **)&channel))
   {
     sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
@@ -1600,7 +2245,62 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link
   return SC_FS_MEMORY_OK;
 }
 
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_memory const * memory)
+sc_bool _sc_dictionary_fs_memory_write_file(sc_char const * path, void const * data, sc_uint64 const size)
+{
+  sc_char * tmp_path;
+  {
+    sc_str_concat(path, SC_FS_TMP_EXT, tmp_path);
+  }
+
+  sc_io_channel * channel = sc_io_new_write_channel(tmp_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_mem_free(tmp_path);
+    return SC_FALSE;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_uint64 written_bytes = 0;
+  sc_bool const is_written =
+      sc_io_channel_write_chars(channel, data, size, &written_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+      && written_bytes == size;
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+
+  // file is replaced only with its content flushed to disk
+  sc_bool const result = is_written && sc_fs_sync(tmp_path) && sc_fs_rename_file(tmp_path, path);
+  if (result == SC_FALSE)
+    sc_fs_remove_file(tmp_path);
+  sc_mem_free(tmp_path);
+  return result;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_strings_meta(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * path)
+{
+  sc_uint8 data[sizeof(sc_uint32) + sizeof(sc_uint64) + sizeof(sc_uint64)];
+  sc_uint32 const version = SC_FS_STRINGS_FORMAT_VERSION;
+  sc_mem_cpy(data, &version, sizeof(version));
+
+  sc_monitor_acquire_read(&memory->monitor);
+  sc_uint64 const unreferenced_strings_size = memory->unreferenced_strings_size;
+  sc_monitor_release_read(&memory->monitor);
+  sc_mem_cpy(data + sizeof(version), &unreferenced_strings_size, sizeof(unreferenced_strings_size));
+  sc_mem_cpy(
+      data + sizeof(version) + sizeof(unreferenced_strings_size),
+      &memory->strings_save_id,
+      sizeof(memory->strings_save_id));
+
+  if (_sc_dictionary_fs_memory_write_file(path, data, sizeof(data)) == SC_FALSE)
+  {
+    sc_fs_memory_error("Error while strings meta `%s` writing", path);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_memory * memory)
 {
   if (memory == null_ptr)
   {
@@ -1609,11 +2309,26 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_mem
   }
 
   sc_fs_memory_info("Save sc-fs-memory dictionaries");
-  sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_save_term_string_offsets(memory);
-  if (status != SC_FS_MEMORY_OK)
-    return status;
-
-  status = _sc_dictionary_fs_memory_save_string_offsets_link_hashes(memory);
+  sc_monitor_acquire_write(&memory->save_monitor);
+  // numeric index is written first with identifier of this save, strings meta is written last with the same
+  // identifier, so numeric index is rebuilt on load if save is interrupted between them
+  ++memory->strings_save_id;
+  sc_dictionary_fs_memory_status status =
+      sc_fs_memory_numeric_index_write(memory->numeric_index_path, memory->strings_save_id, memory->numeric_index);
+  if (status == SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_info("Numeric index written");
+    status = _sc_dictionary_fs_memory_save_term_string_offsets(memory);
+  }
+  if (status == SC_FS_MEMORY_OK)
+  {
+    sc_monitor_acquire_read(&memory->compaction_monitor);
+    status = _sc_dictionary_fs_memory_save_string_offsets_link_hashes(memory, memory->string_offsets_link_hashes_path);
+    sc_monitor_release_read(&memory->compaction_monitor);
+  }
+  if (status == SC_FS_MEMORY_OK)
+    status = _sc_dictionary_fs_memory_save_strings_meta(memory, memory->strings_meta_path);
+  sc_monitor_release_write(&memory->save_monitor);
   if (status != SC_FS_MEMORY_OK)
     return status;
 
@@ -1623,4 +2338,588 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_mem
   return status;
 }
 
+sc_bool _sc_dictionary_fs_memory_collect_string_offset(sc_dictionary_node * node, void ** arguments)
+{
+  sc_link_hash_content * content = node->data;
+  if (content == null_ptr)
+    return SC_TRUE;
+
+  sc_hash_table * string_offsets = arguments[0];
+  sc_hash_table_insert(string_offsets, (void *)content->string_offset, (void *)content->string_offset);
+  return SC_TRUE;
+}
+
+int _sc_dictionary_fs_memory_compare_string_offsets(void const * string_offset, void const * other_string_offset)
+{
+  sc_uint64 const offset = *(sc_uint64 const *)string_offset;
+  sc_uint64 const other_offset = *(sc_uint64 const *)other_string_offset;
+  return (offset > other_offset) - (offset < other_offset);
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_compact_string(
+    sc_dictionary_fs_memory * memory,
+    sc_strings_compaction * compaction,
+    sc_uint64 const string_offset)
+{
+  sc_char * string;
+  sc_uint64 string_size;
+  sc_bool is_file_path;
+  if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+          memory, string_offset, SC_FALSE, &string, &string_size, &is_file_path)
+      != SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_error("Error while string with offset %" PRIu64 " reading", string_offset);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  sc_uint64 const compacted_string_offset = compaction->last_string_offset;
+  sc_uint64 const idx = compacted_string_offset / memory->max_strings_channel_size;
+  if (idx >= memory->max_strings_channels)
+  {
+    sc_fs_memory_error("Max strings channels is %d. Strings can't be compacted", memory->max_strings_channels);
+    status = SC_FS_MEMORY_WRITE_ERROR;
+    goto result;
+  }
+
+  if (compaction->channels[idx] == null_ptr)
+  {
+    if (idx > 0 && compaction->channels[idx - 1] != null_ptr)
+      sc_io_channel_flush(compaction->channels[idx - 1], null_ptr);
+
+    sc_char * strings_path;
+    _sc_dictionary_fs_memory_get_strings_channel_path(
+        memory, SC_FS_COMPACTED_STRINGS_CHANNEL_PREFIX, idx, &strings_path);
+    compaction->channels[idx] = sc_io_new_write_channel(strings_path, null_ptr);
+    sc_mem_free(strings_path);
+    if (compaction->channels[idx] == null_ptr)
+    {
+      sc_fs_memory_error("Compacted strings channel %" PRIu64 " can't be created", idx + 1);
+      status = SC_FS_MEMORY_WRITE_ERROR;
+      goto result;
+    }
+    sc_io_channel_set_encoding(compaction->channels[idx], null_ptr, null_ptr);
+  }
+
+  sc_io_channel * strings_channel = compaction->channels[idx];
+  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, compacted_string_offset);
+  sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
+
+  sc_uint64 const stored_string_size = is_file_path ? (string_size | SC_FS_FILE_PATH_STRING_FLAG) : string_size;
+  sc_uint64 written_bytes = 0;
+  if (sc_io_channel_write_chars(
+          strings_channel, &stored_string_size, sizeof(stored_string_size), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(stored_string_size) != written_bytes)
+  {
+    sc_fs_memory_error("Error while attribute `size` writing");
+    status = SC_FS_MEMORY_WRITE_ERROR;
+    goto result;
+  }
+
+  if (sc_io_channel_write_chars(strings_channel, string, string_size, &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || string_size != written_bytes)
+  {
+    sc_fs_memory_error("Error while attribute `string` writing");
+    status = SC_FS_MEMORY_WRITE_ERROR;
+    goto result;
+  }
+
+  compaction->last_string_offset += sizeof(string_size) + string_size;
+  sc_hash_table_insert(
+      compaction->string_offsets, (void *)(string_offset + 1), (void *)(compacted_string_offset + 1));
+  sc_hash_table_insert(compaction->string_sizes, (void *)(compacted_string_offset + 1), (void *)string_size);
+
+result:
+  sc_mem_free(string);
+  return status;
+}
+
+sc_bool _sc_dictionary_fs_memory_compact_uncompacted_string(sc_dictionary_node * node, void ** arguments)
+{
+  sc_link_hash_content * content = node->data;
+  if (content == null_ptr)
+    return SC_TRUE;
+
+  sc_dictionary_fs_memory * memory = arguments[0];
+  sc_strings_compaction * compaction = arguments[1];
+  if (sc_hash_table_get(compaction->string_offsets, (void *)content->string_offset) != null_ptr)
+    return SC_TRUE;
+
+  sc_hash_table_insert(
+      compaction->late_string_offsets, (void *)content->string_offset, (void *)content->string_offset);
+  return _sc_dictionary_fs_memory_compact_string(memory, compaction, content->string_offset - 1) == SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_remap_link_hash_content(sc_dictionary_node * node, void ** arguments)
+{
+  sc_link_hash_content * content = node->data;
+  if (content == null_ptr)
+    return SC_TRUE;
+
+  sc_strings_compaction * compaction = arguments[0];
+  sc_dictionary * string_offsets_link_hashes_dictionary = arguments[1];
+
+  content->string_offset = (sc_uint64)sc_hash_table_get(compaction->string_offsets, (void *)content->string_offset);
+
+  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 string_offset_str_size;
+  sc_int_to_str_int(content->string_offset - 1, string_offset_str, string_offset_str_size);
+  // sc-links with the same string share the same list of sc-link hashes
+  if (sc_dictionary_get_by_key(string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size)
+      == null_ptr)
+  {
+    sc_dictionary_append(
+        string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size, content->link_hashes);
+
+    sc_uint64 const string_size =
+        (sc_uint64)sc_hash_table_get(compaction->string_sizes, (void *)content->string_offset);
+    compaction->referenced_strings_size += sizeof(sc_uint64) + string_size;
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_remap_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+{
+  sc_list * string_offsets = node->data;
+  if (string_offsets == null_ptr)
+    return SC_TRUE;
+
+  sc_strings_compaction * compaction = arguments[0];
+
+  sc_list * remapped_string_offsets;
+  sc_list_init(&remapped_string_offsets);
+
+  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
+  // the first list item is a term
+  if (sc_iterator_next(string_offset_it))
+    sc_list_push_back(remapped_string_offsets, sc_iterator_get(string_offset_it));
+
+  while (sc_iterator_next(string_offset_it))
+  {
+    sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
+    sc_uint64 const compacted_string_offset =
+        (sc_uint64)sc_hash_table_get(compaction->string_offsets, (void *)(string_offset + 1));
+    // strings without sc-links are removed from strings channels
+    if (compacted_string_offset != 0)
+      sc_list_push_back(remapped_string_offsets, (void *)(compacted_string_offset - 1));
+  }
+  sc_iterator_destroy(string_offset_it);
+
+  sc_list_destroy(string_offsets);
+  node->data = remapped_string_offsets;
+
+  return SC_TRUE;
+}
+
+sc_uint64 _sc_dictionary_fs_memory_remap_compacted_string_offset(sc_uint64 const string_offset, void * arguments)
+{
+  sc_strings_compaction * compaction = arguments;
+  return (sc_uint64)sc_hash_table_get(compaction->string_offsets, (void *)(string_offset + 1));
+}
+
+void _sc_dictionary_fs_memory_append_late_string_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_strings_compaction * compaction,
+    sc_char const * term,
+    sc_uint64 const term_size,
+    sc_uint64 const string_offset)
+{
+  if (sc_hash_table_get(compaction->late_string_offsets, (void *)(string_offset + 1)) == null_ptr)
+    return;
+
+  sc_uint64 const compacted_string_offset =
+      _sc_dictionary_fs_memory_remap_compacted_string_offset(string_offset, compaction);
+  _sc_dictionary_fs_memory_append(
+      memory->terms_string_offsets_dictionary, term, term_size, (void *)(compacted_string_offset - 1));
+}
+
+sc_bool _sc_dictionary_fs_memory_append_late_index_term_string_offsets(
+    sc_char const * term,
+    sc_uint64 const term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 const string_offsets_count,
+    void ** arguments)
+{
+  for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+    _sc_dictionary_fs_memory_append_late_string_offset(arguments[0], arguments[1], term, term_size, string_offsets[i]);
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_append_late_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+{
+  sc_list * string_offsets = node->data;
+  if (string_offsets == null_ptr)
+    return SC_TRUE;
+
+  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
+  // the first list item is a term
+  sc_iterator_next(string_offset_it);
+  sc_char const * term = sc_iterator_get(string_offset_it);
+  sc_uint64 const term_size = sc_str_len(term);
+  while (sc_iterator_next(string_offset_it))
+    _sc_dictionary_fs_memory_append_late_string_offset(
+        arguments[0], arguments[1], term, term_size, (sc_uint64)sc_iterator_get(string_offset_it));
+  sc_iterator_destroy(string_offset_it);
+
+  return SC_TRUE;
+}
+
+/*! Writes terms index with compacted strings offsets of terms index and frozen terms. It isn't loaded into memory, so
+ * it is written while other string operations are not blocked. Strings compacted after that are added to new terms.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_compacted_terms_index(
+    sc_dictionary_fs_memory * memory,
+    sc_strings_compaction * compaction)
+{
+  sc_char * compacted_path;
+  _sc_dictionary_fs_memory_get_compacted_path(memory->terms_string_offsets_path, &compacted_path);
+
+  sc_monitor_acquire_read(&memory->compaction_monitor);
+  sc_dictionary_fs_memory_status const status = sc_fs_memory_terms_index_write_ext(
+      compacted_path,
+      compaction->last_string_offset,
+      memory->terms_string_offsets_index,
+      memory->merged_terms_string_offsets_dictionary,
+      _sc_dictionary_fs_memory_remap_compacted_string_offset,
+      compaction);
+  sc_monitor_release_read(&memory->compaction_monitor);
+
+  if (status != SC_FS_MEMORY_OK)
+    sc_fs_memory_error("Error while compacted terms index `%s` writing", compacted_path);
+  sc_mem_free(compacted_path);
+  return status;
+}
+
+//! Completes compacted terms index with last string offset and maps it
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_map_compacted_terms_index(
+    sc_dictionary_fs_memory const * memory,
+    sc_strings_compaction const * compaction,
+    sc_fs_memory_terms_index ** index)
+{
+  sc_char * compacted_path;
+  _sc_dictionary_fs_memory_get_compacted_path(memory->terms_string_offsets_path, &compacted_path);
+
+  sc_uint64 saved_last_string_offset;
+  sc_dictionary_fs_memory_status status =
+      sc_fs_memory_terms_index_set_last_string_offset(compacted_path, compaction->last_string_offset);
+  if (status == SC_FS_MEMORY_OK && sc_fs_sync(compacted_path) == SC_FALSE)
+    status = SC_FS_MEMORY_WRITE_ERROR;
+  if (status == SC_FS_MEMORY_OK)
+    status = sc_fs_memory_terms_index_map(compacted_path, index, &saved_last_string_offset);
+
+  if (status != SC_FS_MEMORY_OK)
+    sc_fs_memory_error("Compacted terms index `%s` can't be mapped", compacted_path);
+  sc_mem_free(compacted_path);
+  return status;
+}
+
+void _sc_dictionary_fs_memory_remove_compacted_strings_channels(
+    sc_dictionary_fs_memory * memory,
+    sc_strings_compaction * compaction)
+{
+  for (sc_uint64 i = 0; i < memory->max_strings_channels && compaction->channels[i] != null_ptr; ++i)
+  {
+    sc_io_channel_shutdown(compaction->channels[i], SC_FALSE, null_ptr);
+    compaction->channels[i] = null_ptr;
+  }
+
+  _sc_dictionary_fs_memory_remove_compacted_files(memory);
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_sync_compacted_strings_channels(
+    sc_dictionary_fs_memory * memory,
+    sc_strings_compaction * compaction)
+{
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  for (sc_uint64 i = 0; i < memory->max_strings_channels && compaction->channels[i] != null_ptr; ++i)
+  {
+    sc_io_channel_shutdown(compaction->channels[i], SC_TRUE, null_ptr);
+    compaction->channels[i] = null_ptr;
+
+    sc_char * strings_path;
+    _sc_dictionary_fs_memory_get_strings_channel_path(memory, SC_FS_COMPACTED_STRINGS_CHANNEL_PREFIX, i, &strings_path);
+    if (sc_fs_sync(strings_path) == SC_FALSE)
+    {
+      sc_fs_memory_error("Compacted strings channel `%s` can't be synced", strings_path);
+      status = SC_FS_MEMORY_WRITE_ERROR;
+    }
+    sc_mem_free(strings_path);
+  }
+
+  return status;
+}
+
+//! Writes remapped dictionaries next to saved ones, they replace saved dictionaries with compacted strings channels.
+//! Compacted terms index is written before.
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_compacted_dictionaries(sc_dictionary_fs_memory * memory)
+{
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+
+  sc_char * compacted_path;
+  _sc_dictionary_fs_memory_get_compacted_path(memory->string_offsets_link_hashes_path, &compacted_path);
+  if (_sc_dictionary_fs_memory_save_string_offsets_link_hashes(memory, compacted_path) != SC_FS_MEMORY_OK
+      || sc_fs_sync(compacted_path) == SC_FALSE)
+  {
+    sc_fs_remove_file(compacted_path);
+    status = SC_FS_MEMORY_WRITE_ERROR;
+  }
+  sc_mem_free(compacted_path);
+
+  _sc_dictionary_fs_memory_get_compacted_path(memory->strings_meta_path, &compacted_path);
+  if (_sc_dictionary_fs_memory_save_strings_meta(memory, compacted_path) != SC_FS_MEMORY_OK)
+    status = SC_FS_MEMORY_WRITE_ERROR;
+  sc_mem_free(compacted_path);
+
+  return status;
+}
+
+/*! Replaces strings channels and dictionaries with compacted ones. Commit file is written before the first saved file
+ * is replaced, so compaction interrupted by crash is either completed or discarded on load.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_commit_compaction(
+    sc_dictionary_fs_memory * memory,
+    sc_strings_compaction * compaction)
+{
+  // strings channels can be opened not in order of their offsets
+  for (sc_uint64 i = 0; i < memory->max_strings_channels; ++i)
+  {
+    if (memory->strings_channels[i] == null_ptr)
+      continue;
+
+    sc_io_channel_shutdown(memory->strings_channels[i], SC_TRUE, null_ptr);
+    memory->strings_channels[i] = null_ptr;
+  }
+
+  sc_uint64 const compacted_channels_count =
+      sc_min(compaction->last_string_offset / memory->max_strings_channel_size + 1, memory->max_strings_channels);
+
+  sc_char * commit_path;
+  _sc_dictionary_fs_memory_get_compaction_commit_path(memory, &commit_path);
+  sc_bool const is_committed =
+      _sc_dictionary_fs_memory_write_file(commit_path, &compacted_channels_count, sizeof(compacted_channels_count))
+      && sc_fs_sync(memory->path);
+  if (is_committed == SC_FALSE)
+    sc_fs_memory_error("Compaction commit `%s` can't be written, files are replaced without it", commit_path);
+
+  // offsets are already remapped in memory, so files are replaced even if compaction isn't committed
+  sc_dictionary_fs_memory_status const status =
+      _sc_dictionary_fs_memory_replace_compacted_files(memory, compacted_channels_count);
+  if (is_committed && status == SC_FS_MEMORY_OK)
+  {
+    sc_fs_remove_file(commit_path);
+    sc_fs_sync(memory->path);
+  }
+  sc_mem_free(commit_path);
+
+  for (sc_uint64 i = 0; i < compacted_channels_count; ++i)
+  {
+    sc_char * strings_path;
+    _sc_dictionary_fs_memory_get_strings_channel_path(memory, SC_FS_STRINGS_CHANNEL_PREFIX, i, &strings_path);
+    // open channels eagerly, lazily opened channels are truncated if memory was cleared on initialize
+    if (sc_fs_is_file(strings_path))
+    {
+      memory->strings_channels[i] = sc_io_new_append_channel(strings_path, null_ptr);
+      sc_io_channel_set_encoding(memory->strings_channels[i], null_ptr, null_ptr);
+    }
+    sc_mem_free(strings_path);
+  }
+
+  return status;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_compact_ext(
+    sc_dictionary_fs_memory * memory,
+    sc_uint8 const min_unreferenced_strings_percent)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to compact strings");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_monitor_acquire_write(&memory->monitor);
+  sc_uint64 const strings_size = memory->last_string_offset;
+  sc_uint64 const unreferenced_strings_size = memory->unreferenced_strings_size;
+  sc_bool const is_compactable = memory->is_compacting == SC_FALSE && unreferenced_strings_size != 0
+                                 && unreferenced_strings_size * 100 >= min_unreferenced_strings_percent * strings_size;
+  if (is_compactable)
+    memory->is_compacting = SC_TRUE;
+  sc_monitor_release_write(&memory->monitor);
+
+  if (is_compactable == SC_FALSE)
+    return SC_FS_MEMORY_OK;
+
+  sc_fs_memory_info("Compact strings channels");
+  sc_message("\tUnreferenced strings size: %" PRIu64 " of %" PRIu64, unreferenced_strings_size, strings_size);
+
+  sc_strings_compaction compaction;
+  compaction.channels = (sc_io_channel **)sc_mem_new(sc_io_channel *, memory->max_strings_channels);
+  compaction.last_string_offset = 0;
+  compaction.string_offsets = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  compaction.string_sizes = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  compaction.referenced_strings_size = 0;
+  compaction.late_string_offsets = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+
+  // collect offsets of strings that have sc-links
+  sc_hash_table * string_offsets_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  sc_monitor_acquire_write(&memory->compaction_monitor);
+  sc_dictionary_visit_down_nodes(
+      memory->link_hashes_string_offsets_dictionary,
+      _sc_dictionary_fs_memory_collect_string_offset,
+      (void **)&string_offsets_table);
+  sc_monitor_release_write(&memory->compaction_monitor);
+
+  sc_uint64 const string_offsets_count = sc_hash_table_size(string_offsets_table);
+  sc_uint64 * string_offsets = sc_mem_new(sc_uint64, string_offsets_count + 1);
+  {
+    sc_uint64 i = 0;
+    sc_hash_table_iterator string_offsets_it;
+    sc_pointer key, value;
+    sc_hash_table_iterator_init(&string_offsets_it, string_offsets_table);
+    while (sc_hash_table_iterator_next(&string_offsets_it, &key, &value))
+      string_offsets[i++] = (sc_uint64)key - 1;
+  }
+  sc_hash_table_destroy(string_offsets_table);
+
+  // rewrite strings in order of their offsets, other string operations are not blocked
+  qsort(string_offsets, string_offsets_count, sizeof(sc_uint64), _sc_dictionary_fs_memory_compare_string_offsets);
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  for (sc_uint64 i = 0; i < string_offsets_count && status == SC_FS_MEMORY_OK; ++i)
+    status = _sc_dictionary_fs_memory_compact_string(memory, &compaction, string_offsets[i]);
+  sc_mem_free(string_offsets);
+
+  if (status != SC_FS_MEMORY_OK)
+    goto error;
+
+  // terms index can't be merged by save while it is compacted
+  sc_monitor_acquire_write(&memory->save_monitor);
+  sc_monitor_acquire_write(&memory->compaction_monitor);
+  _sc_dictionary_fs_memory_freeze_terms(memory);
+  sc_monitor_release_write(&memory->compaction_monitor);
+
+  status = _sc_dictionary_fs_memory_write_compacted_terms_index(memory, &compaction);
+
+  sc_fs_memory_terms_index * index = null_ptr;
+  sc_monitor_acquire_write(&memory->compaction_monitor);
+  if (status != SC_FS_MEMORY_OK)
+    goto locked_error;
+
+  {
+    // strings can be linked with sc-links while other strings are compacted
+    void * arguments[2];
+    arguments[0] = memory;
+    arguments[1] = &compaction;
+    if (sc_dictionary_visit_down_nodes(
+            memory->link_hashes_string_offsets_dictionary,
+            _sc_dictionary_fs_memory_compact_uncompacted_string,
+            arguments)
+        == SC_FALSE)
+    {
+      status = SC_FS_MEMORY_WRITE_ERROR;
+      goto locked_error;
+    }
+  }
+
+  // compacted strings channels are flushed to disk before any saved file is replaced with them
+  status = _sc_dictionary_fs_memory_sync_compacted_strings_channels(memory, &compaction);
+  if (status != SC_FS_MEMORY_OK)
+    goto locked_error;
+
+  status = _sc_dictionary_fs_memory_map_compacted_terms_index(memory, &compaction, &index);
+  if (status != SC_FS_MEMORY_OK)
+    goto locked_error;
+
+  {
+    sc_dictionary * string_offsets_link_hashes_dictionary;
+    _sc_number_dictionary_initialize(&string_offsets_link_hashes_dictionary);
+
+    void * arguments[2];
+    arguments[0] = &compaction;
+    arguments[1] = string_offsets_link_hashes_dictionary;
+    sc_dictionary_visit_down_nodes(
+        memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_remap_link_hash_content, arguments);
+
+    sc_dictionary_destroy(
+        memory->string_offsets_link_hashes_dictionary, _sc_dictionary_fs_memory_unreferenced_link_node_clear);
+    memory->string_offsets_link_hashes_dictionary = string_offsets_link_hashes_dictionary;
+
+    // terms added while terms index was written are remapped in place
+    sc_dictionary_visit_down_nodes(
+        memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_remap_term_string_offsets, arguments);
+
+    // strings compacted after terms index was written are missed in it
+    if (sc_hash_table_size(compaction.late_string_offsets) != 0)
+    {
+      arguments[0] = memory;
+      arguments[1] = &compaction;
+      sc_fs_memory_terms_index_visit_by_prefix(
+          memory->terms_string_offsets_index,
+          "",
+          0,
+          _sc_dictionary_fs_memory_append_late_index_term_string_offsets,
+          arguments);
+      sc_dictionary_visit_down_nodes(
+          memory->merged_terms_string_offsets_dictionary,
+          _sc_dictionary_fs_memory_append_late_term_string_offsets,
+          arguments);
+    }
+
+    // mapped terms index keeps its file content after file is renamed
+    _sc_dictionary_fs_memory_replace_terms_index(memory, index);
+    sc_dictionary_destroy(memory->merged_terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+    memory->merged_terms_string_offsets_dictionary = null_ptr;
+  }
+
+  memory->last_string_offset = compaction.last_string_offset;
+  memory->unreferenced_strings_size = compaction.last_string_offset - compaction.referenced_strings_size;
+
+  // dictionaries are saved to be consistent with compacted strings channels, saved numeric index is older than them
+  ++memory->strings_save_id;
+  status = _sc_dictionary_fs_memory_write_compacted_dictionaries(memory);
+  if (_sc_dictionary_fs_memory_commit_compaction(memory, &compaction) != SC_FS_MEMORY_OK)
+    status = SC_FS_MEMORY_WRITE_ERROR;
+  sc_monitor_release_write(&memory->compaction_monitor);
+  sc_monitor_release_write(&memory->save_monitor);
+
+  sc_fs_memory_info("Strings channels compacted");
+  sc_message("\tLast string offset: %" PRIu64 " -> %" PRIu64, strings_size, compaction.last_string_offset);
+  goto result;
+
+locked_error:
+  _sc_dictionary_fs_memory_unfreeze_terms(memory);
+  sc_monitor_release_write(&memory->compaction_monitor);
+  sc_monitor_release_write(&memory->save_monitor);
+
+error:
+  sc_fs_memory_error("Strings channels are not compacted");
+  _sc_dictionary_fs_memory_remove_compacted_strings_channels(memory, &compaction);
+
+result:
+  sc_hash_table_destroy(compaction.late_string_offsets);
+  sc_hash_table_destroy(compaction.string_sizes);
+  sc_hash_table_destroy(compaction.string_offsets);
+  sc_mem_free(compaction.channels);
+
+  sc_monitor_acquire_write(&memory->monitor);
+  memory->is_compacting = SC_FALSE;
+  sc_monitor_release_write(&memory->monitor);
+
+  return status;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_compact(sc_dictionary_fs_memory * memory)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to compact strings");
+    return SC_FS_MEMORY_NO;
+  }
+
+  return sc_dictionary_fs_memory_compact_ext(memory, memory->min_unreferenced_strings_percent);
+}
+
 #endif
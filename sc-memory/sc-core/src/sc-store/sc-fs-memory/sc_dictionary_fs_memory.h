@@ -73,6 +73,20 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
     sc_uint64 string_size,
     sc_bool is_searchable_string);
 
+/*! Appends sc-link hash to file system memory with path to file storing its content.
+ * @param memory A pointer to file memory
+ * @param link_hash An appendable sc-link hash
+ * @param file_path A path to file with sc-link content
+ * @param file_path_size A path to file with sc-link content size
+ * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ * @note File contents aren't copied into file memory and sc-link can't be found by them.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_file_path(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_char const * file_path,
+    sc_uint64 file_path_size);
+
 /*! Removes sc-link content string from file system memory.
  * @param memory A pointer to file memory
  * @param link_hash A sc-link hash
@@ -95,6 +109,21 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     sc_char ** string,
     sc_uint64 * string_size);
 
+/*! Gets sc-link content string with its size by sc-link hash.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param[out] string A sc-link content string
+ * @param[out] string_size A sc-link content string size
+ * @param[out] is_file_path SC_TRUE, if \p string is a path to file with sc-link content. It can be null_ptr.
+ * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash_ext(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_char ** string,
+    sc_uint64 * string_size,
+    sc_bool * is_file_path);
+
 /*! Function that retrieves sc-link hashes by a full string term from the file memory.
  * @param memory Pointer to the file memory.
  * @param string Pointer to the full string term.
@@ -151,6 +180,23 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_substr
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*! Function that retrieves sc-link hashes by their numeric contents from the file memory.
+ * @param memory Pointer to the file memory.
+ * @param min_value Minimal value of the closed range.
+ * @param max_value Maximal value of the closed range.
+ * @param data Pointer to user-specific data.
+ * @param callback Callback function to be invoked for each matching sc-link sc-address found in order of values.
+ *                The callback function must have the signature: void callback(void * data, sc_addr const link_addr).
+ * @returns Returns the memory status indicating the success or failure of the operation.
+ * @note Only sc-links with contents that are numbers are found, they are kept in ordered numeric index.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_number_range(
+    sc_dictionary_fs_memory * memory,
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr));
+
 /*! Function that retrieves sc-link strings by a substring term extension from the file memory.
  * @param memory Pointer to the file memory.
  * @param string Pointer to the substring term.
@@ -213,16 +259,36 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unite_strings_by_terms(
     sc_list const * terms,
     sc_list ** strings);
 
-/*! Load file system memory from file system
+/*! Load file system memory from file system. Terms index is mapped into memory and isn't rebuilt
  * @param memory A pointer to file memory
  * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
  */
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_memory * memory);
 
-/*! Save file system memory to file system
+/*! Save file system memory to file system. Terms added after terms index was saved are merged into it
  * @param memory A pointer to file memory
  * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
  */
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_memory const * memory);
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_memory * memory);
+
+/*! Compacts strings channels of file system memory if size of strings that have no sc-links is not less than specified
+ * percent of all strings size. Strings that have sc-links are rewritten into new strings channels, and all string
+ * offsets are remapped. Terms index is rewritten with remapped offsets without loading it into memory. String
+ * operations are blocked only while offsets in memory are remapped.
+ * @param memory A pointer to file memory
+ * @param min_unreferenced_strings_percent Minimal percent of unreferenced strings size to compact strings channels
+ * @returns SC_FS_MEMORY_OK, if strings channels are compacted or there is nothing to compact, or
+ * SC_FS_MEMORY_WRITE_ERROR if there are reading or writing errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_compact_ext(
+    sc_dictionary_fs_memory * memory,
+    sc_uint8 min_unreferenced_strings_percent);
+
+/*! Compacts strings channels of file system memory with configured minimal percent of unreferenced strings size.
+ * @param memory A pointer to file memory
+ * @returns SC_FS_MEMORY_OK, if strings channels are compacted or there is nothing to compact, or
+ * SC_FS_MEMORY_WRITE_ERROR if there are reading or writing errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_compact(sc_dictionary_fs_memory * memory);
 
 #endif  //_sc_dictionary_fs_memory_h_
@@ -69,6 +69,15 @@ void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node)
   sc_list_destroy(link_hashes);
 }
 
+void _sc_dictionary_fs_memory_unreferenced_link_node_clear(sc_dictionary_node * node)
+{
+  sc_list * link_hashes = node->data;
+  if (link_hashes == null_ptr || link_hashes->size != 0)
+    return;
+
+  sc_list_destroy(link_hashes);
+}
+
 void _sc_dictionary_fs_memory_string_node_clear(sc_dictionary_node * node)
 {
   void * content = node->data;
@@ -88,6 +97,7 @@ sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * p
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params->compact_strings_min_unreferenced_percent = DEFAULT_COMPACT_STRINGS_MIN_UNREFERENCED_PERCENT;
 
   return params;
 }
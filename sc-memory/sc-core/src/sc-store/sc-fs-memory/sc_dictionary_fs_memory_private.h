@@ -18,8 +18,13 @@
 #include "sc-store/sc-base/sc_monitor_table_private.h"
 #include "sc-store/sc-base/sc_message.h"
 
+#include "sc_fs_memory_terms_index.h"
+#include "sc_fs_memory_numeric_index.h"
+
 #define SC_FS_EXT ".scdb"
 #define INVALID_STRING_OFFSET LONG_MAX
+// highest bit of stored string size marks strings that are paths to files with sc-link contents
+#define SC_FS_FILE_PATH_STRING_FLAG ((sc_uint64)1 << 63)
 
 #define SC_FS_MEMORY_PREFIX "[sc-fs-memory] "
 #define sc_fs_memory_info(...) sc_message(SC_FS_MEMORY_PREFIX __VA_ARGS__)
@@ -43,8 +48,21 @@ struct _sc_dictionary_fs_memory
   sc_monitor monitor;
   sc_monitor resolve_string_offset_monitor;
 
-  sc_char * terms_string_offsets_path;              // path to dictionary file with terms and its strings offsets
-  sc_dictionary * terms_string_offsets_dictionary;  // dictionary instance with terms and its strings offsets
+  sc_monitor compaction_monitor;              // excludes all string operations while offsets are remapped
+  sc_bool is_compacting;                      // true while strings channels are compacted
+  sc_uint64 unreferenced_strings_size;        // size of strings in channels that have no sc-links anymore
+  sc_uint8 min_unreferenced_strings_percent;  // percent of unreferenced strings size to compact strings channels
+  sc_char * strings_meta_path;  // path to file with format version of strings channels and unreferenced strings size
+  sc_uint64 strings_save_id;    // identifier of the last save, numeric index saved with other identifier is rebuilt
+
+  sc_char * terms_string_offsets_path;  // path to terms index file with terms and its strings offsets
+  sc_fs_memory_terms_index * terms_string_offsets_index;  // mapped terms index with terms and its strings offsets
+  sc_dictionary * terms_string_offsets_dictionary;  // dictionary with terms and strings offsets not saved in index
+  sc_dictionary * merged_terms_string_offsets_dictionary;  // dictionary with terms being merged into terms index
+  sc_monitor save_monitor;  // excludes concurrent merges of terms into terms index
+
+  sc_char * numeric_index_path;                // path to numeric index file with sc-links ordered by numeric contents
+  sc_fs_memory_numeric_index * numeric_index;  // ordered index of sc-links with numeric contents
 
   sc_char * string_offsets_link_hashes_path;  // path to dictionary file with strings offsets and its link hashes
   sc_dictionary *
@@ -61,6 +79,8 @@ void _sc_dictionary_fs_memory_node_clear(sc_dictionary_node * node);
 
 void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node);
 
+void _sc_dictionary_fs_memory_unreferenced_link_node_clear(sc_dictionary_node * node);
+
 void _sc_dictionary_fs_memory_string_node_clear(sc_dictionary_node * node);
 
 sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * path, sc_bool clear);
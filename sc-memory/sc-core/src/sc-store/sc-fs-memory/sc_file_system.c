@@ -6,6 +6,9 @@
 
 #include "sc_file_system.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <glib.h>
 #include <glib/gstdio.h>
 
@@ -87,6 +90,17 @@ sc_bool sc_fs_is_file(sc_char const * path)
   return g_file_test(path, G_FILE_TEST_IS_REGULAR);
 }
 
+sc_bool sc_fs_sync(sc_char const * path)
+{
+  sc_int32 const fd = open(path, O_RDONLY);
+  if (fd == -1)
+    return SC_FALSE;
+
+  sc_bool const result = fsync(fd) == 0;
+  close(fd);
+  return result;
+}
+
 sc_bool sc_fs_is_binary_file(sc_char const * file_path)
 {
   sc_char command_prefix[] = SC_FS_FILE_COMMAND;
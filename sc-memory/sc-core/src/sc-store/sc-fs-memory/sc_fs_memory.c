@@ -12,9 +12,15 @@
 
 #include "sc-store/sc_segment.h"
 #include "sc-store/sc_storage_private.h"
+#include "sc-store/sc_system_identifier_index.h"
+#include "sc-store/sc-base/sc_profiler.h"
 
 #include "sc_io.h"
 
+#include "sc-core/sc-container/sc_string.h"
+
+#define SC_FS_MEMORY_SNAPSHOT_EXT ".snapshot"
+
 sc_fs_memory_manager * manager;
 
 sc_fs_memory_status sc_fs_memory_initialize_ext(sc_memory_params const * params)
@@ -31,6 +37,8 @@ sc_fs_memory_status sc_fs_memory_initialize_ext(sc_memory_params const * params)
 
   static sc_char const * segments_postfix = "segments" SC_FS_EXT;
   sc_fs_concat_path(manager->path, segments_postfix, &manager->segments_path);
+  static sc_char const * system_identifiers_postfix = "system_identifiers" SC_FS_EXT;
+  sc_fs_concat_path(manager->path, system_identifiers_postfix, &manager->system_identifiers_path);
 
   if (manager->initialize(&manager->fs_memory, params) != SC_FS_MEMORY_OK)
     return SC_FS_MEMORY_NO;
@@ -41,6 +49,9 @@ sc_fs_memory_status sc_fs_memory_initialize_ext(sc_memory_params const * params)
     sc_fs_memory_info("Clear sc-memory segments");
     if (sc_fs_remove_file(manager->segments_path) == SC_FALSE)
       sc_fs_memory_info("Can't remove segments file: %s", manager->segments_path);
+    if (sc_fs_is_file(manager->system_identifiers_path)
+        && sc_fs_remove_file(manager->system_identifiers_path) == SC_FALSE)
+      sc_fs_memory_info("Can't remove system identifiers file: %s", manager->system_identifiers_path);
   }
 
   return SC_FS_MEMORY_OK;
@@ -58,6 +69,7 @@ sc_fs_memory_status sc_fs_memory_shutdown()
 {
   sc_fs_memory_status const result = manager->shutdown(manager->fs_memory);
   sc_mem_free(manager->segments_path);
+  sc_mem_free(manager->system_identifiers_path);
   sc_mem_free(manager);
   return result;
 }
@@ -90,6 +102,33 @@ sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
   return result;
 }
 
+sc_fs_memory_status sc_fs_memory_link_file_path(
+    sc_addr_hash const link_hash,
+    sc_char const * file_path,
+    sc_uint32 const file_path_size)
+{
+  if (manager == null_ptr || manager->link_file_path == null_ptr)
+    return SC_FS_MEMORY_NO;
+
+  return manager->link_file_path(manager->fs_memory, link_hash, file_path, file_path_size);
+}
+
+sc_fs_memory_status sc_fs_memory_get_string_by_link_hash_ext(
+    sc_addr_hash const link_hash,
+    sc_char ** string,
+    sc_uint32 * string_size,
+    sc_bool * is_file_path)
+{
+  if (manager == null_ptr || manager->get_string_by_link_hash_ext == null_ptr)
+    return SC_FS_MEMORY_NO;
+
+  sc_uint64 size;
+  sc_fs_memory_status result =
+      manager->get_string_by_link_hash_ext(manager->fs_memory, link_hash, string, &size, is_file_path);
+  *string_size = size;
+  return result;
+}
+
 sc_fs_memory_status sc_fs_memory_get_link_hashes_by_string(
     sc_char const * string,
     sc_uint32 const string_size,
@@ -110,6 +149,18 @@ sc_fs_memory_status sc_fs_memory_get_link_hashes_by_substring(
       manager->fs_memory, substring, substring_size, max_length_to_search_as_prefix, data, callback);
 }
 
+sc_fs_memory_status sc_fs_memory_get_link_hashes_by_number_range(
+    sc_double const min_value,
+    sc_double const max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr))
+{
+  if (manager == null_ptr || manager->get_link_hashes_by_number_range == null_ptr)
+    return SC_FS_MEMORY_NO;
+
+  return manager->get_link_hashes_by_number_range(manager->fs_memory, min_value, max_value, data, callback);
+}
+
 sc_fs_memory_status sc_fs_memory_get_strings_by_substring(
     sc_char const * substring,
     sc_uint32 const substring_size,
@@ -277,11 +328,31 @@ error:
 
 sc_fs_memory_status sc_fs_memory_load(sc_storage * storage)
 {
-  if (_sc_fs_memory_load_sc_memory_segments(storage) != SC_FS_MEMORY_OK)
+  sc_profiler_phase * phase = sc_profiler_phase_begin("Segments loading");
+  sc_fs_memory_status const segments_status = _sc_fs_memory_load_sc_memory_segments(storage);
+  sc_profiler_phase_end(phase);
+  if (segments_status != SC_FS_MEMORY_OK)
     return SC_FS_MEMORY_READ_ERROR;
-  if (manager->load(manager->fs_memory) != SC_FS_MEMORY_OK)
+
+  phase = sc_profiler_phase_begin("Strings dictionary loading");
+  sc_fs_memory_status const strings_status = manager->load(manager->fs_memory);
+  sc_profiler_phase_end(phase);
+  if (strings_status != SC_FS_MEMORY_OK)
     return SC_FS_MEMORY_READ_ERROR;
 
+  // system identifier index is only cache of sc-memory, it is filled by lookups if it can't be read
+  phase = sc_profiler_phase_begin("System identifiers loading");
+  sc_fs_memory_status const status =
+      sc_system_identifier_index_read(manager->system_identifiers_path, storage->system_identifier_index);
+  sc_profiler_phase_end(phase);
+  if (status == SC_FS_MEMORY_OK)
+    sc_fs_memory_info(
+        "Load %llu system identifiers from %s",
+        (unsigned long long)sc_system_identifier_index_get_size(storage->system_identifier_index),
+        manager->system_identifiers_path);
+  else if (status == SC_FS_MEMORY_READ_ERROR)
+    sc_fs_memory_warning("Can't read system identifiers from %s", manager->system_identifiers_path);
+
   return SC_FS_MEMORY_OK;
 }
 
@@ -422,10 +493,51 @@ sc_fs_memory_status sc_fs_memory_save(sc_storage * storage)
     return SC_FS_MEMORY_NO;
   }
 
-  if (_sc_fs_memory_save_sc_memory_segments(storage) != SC_FS_MEMORY_OK)
-    return SC_FS_MEMORY_WRITE_ERROR;
-  if (manager->save(manager->fs_memory) != SC_FS_MEMORY_OK)
-    return SC_FS_MEMORY_WRITE_ERROR;
+  // previous system identifier index mustn't be loaded with new segments if saving is interrupted
+  if (sc_fs_is_file(manager->system_identifiers_path))
+    sc_fs_remove_file(manager->system_identifiers_path);
 
+  // system identifier index is snapshotted before segments, so fivers indexed after erasing of their sc-elements
+  // during saving aren't saved, fivers of sc-elements erased during saving are checked on lookup after loading
+  sc_char * system_identifiers_snapshot_path;
+  sc_str_concat(manager->system_identifiers_path, SC_FS_MEMORY_SNAPSHOT_EXT, system_identifiers_snapshot_path);
+
+  sc_profiler_phase * phase = sc_profiler_phase_begin("System identifiers saving");
+  sc_fs_memory_status const system_identifiers_status =
+      sc_system_identifier_index_write(system_identifiers_snapshot_path, storage->system_identifier_index);
+  sc_profiler_phase_end(phase);
+
+  phase = sc_profiler_phase_begin("Segments saving");
+  sc_fs_memory_status const segments_status = _sc_fs_memory_save_sc_memory_segments(storage);
+  sc_profiler_phase_end(phase);
+  if (segments_status != SC_FS_MEMORY_OK)
+    goto error;
+
+  phase = sc_profiler_phase_begin("Strings dictionary saving");
+  sc_fs_memory_status const strings_status = manager->save(manager->fs_memory);
+  sc_profiler_phase_end(phase);
+  if (strings_status != SC_FS_MEMORY_OK)
+    goto error;
+
+  // snapshot becomes system identifier index only after segments it is taken with are saved
+  if (system_identifiers_status != SC_FS_MEMORY_OK
+      || sc_fs_rename_file(system_identifiers_snapshot_path, manager->system_identifiers_path) == SC_FALSE)
+    sc_fs_memory_warning("Can't save system identifiers to %s", manager->system_identifiers_path);
+
+  sc_mem_free(system_identifiers_snapshot_path);
   return SC_FS_MEMORY_OK;
+
+error:
+  if (sc_fs_is_file(system_identifiers_snapshot_path))
+    sc_fs_remove_file(system_identifiers_snapshot_path);
+  sc_mem_free(system_identifiers_snapshot_path);
+  return SC_FS_MEMORY_WRITE_ERROR;
+}
+
+sc_fs_memory_status sc_fs_memory_compact()
+{
+  if (manager == null_ptr || manager->compact == null_ptr)
+    return SC_FS_MEMORY_NO;
+
+  return manager->compact(manager->fs_memory);
 }
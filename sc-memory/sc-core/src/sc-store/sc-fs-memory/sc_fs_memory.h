@@ -23,9 +23,10 @@ typedef struct _sc_dictionary_fs_memory sc_fs_memory;
 
 typedef struct _sc_fs_memory_manager
 {
-  sc_fs_memory * fs_memory;  // file system memory instance
-  sc_char const * path;      // repo path
-  sc_char * segments_path;   // file path to sc-memory segments
+  sc_fs_memory * fs_memory;          // file system memory instance
+  sc_char const * path;              // repo path
+  sc_char * segments_path;           // file path to sc-memory segments
+  sc_char * system_identifiers_path;  // file path to system identifier index
 
   sc_version version;
   sc_fs_memory_header header;
@@ -33,18 +34,29 @@ typedef struct _sc_fs_memory_manager
   sc_fs_memory_status (*initialize)(sc_fs_memory ** memory, sc_memory_params const * params);
   sc_fs_memory_status (*shutdown)(sc_fs_memory * memory);
   sc_fs_memory_status (*load)(sc_fs_memory * memory);
-  sc_fs_memory_status (*save)(sc_fs_memory const * memory);
+  sc_fs_memory_status (*save)(sc_fs_memory * memory);
   sc_fs_memory_status (*link_string)(
       sc_fs_memory * memory,
       sc_addr_hash const link_hash,
       sc_char const * string,
       sc_uint64 const string_size,
       sc_bool is_searchable_string);
+  sc_fs_memory_status (*link_file_path)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_char const * file_path,
+      sc_uint64 const file_path_size);
   sc_fs_memory_status (*get_string_by_link_hash)(
       sc_fs_memory * memory,
       sc_addr_hash const link_hash,
       sc_char ** string,
       sc_uint64 * string_size);
+  sc_fs_memory_status (*get_string_by_link_hash_ext)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_char ** string,
+      sc_uint64 * string_size,
+      sc_bool * is_file_path);
   sc_fs_memory_status (*get_link_hashes_by_string)(
       sc_fs_memory * memory,
       sc_char const * string,
@@ -58,6 +70,12 @@ typedef struct _sc_fs_memory_manager
       sc_uint32 const max_length_to_search_as_prefix,
       void * data,
       void (*callback)(void * data, sc_addr const link_addr));
+  sc_fs_memory_status (*get_link_hashes_by_number_range)(
+      sc_fs_memory * memory,
+      sc_double min_value,
+      sc_double max_value,
+      void * data,
+      void (*callback)(void * data, sc_addr const link_addr));
   sc_fs_memory_status (*get_strings_by_substring)(
       sc_fs_memory * memory,
       sc_char const * substring,
@@ -66,6 +84,7 @@ typedef struct _sc_fs_memory_manager
       void * data,
       void (*callback)(void * data, sc_addr const link_addr, sc_char const * link_content));
   sc_fs_memory_status (*unlink_string)(sc_fs_memory * memory, sc_addr_hash const link_hash);
+  sc_fs_memory_status (*compact)(sc_fs_memory * memory);
 } sc_fs_memory_manager;
 
 /*! Initialize file system memory in specified path.
@@ -107,6 +126,17 @@ sc_fs_memory_status sc_fs_memory_link_string_ext(
     sc_uint32 string_size,
     sc_bool is_searchable_string);
 
+/*! Appends sc-link hash to file system memory with path to file storing its content.
+ * @param link_hash An appendable sc-link hash
+ * @param file_path A path to file with sc-link content
+ * @param file_path_size A path to file with sc-link content size
+ * @returns SC_FS_MEMORY_OK, if are no writing errors.
+ */
+sc_fs_memory_status sc_fs_memory_link_file_path(
+    sc_addr_hash link_hash,
+    sc_char const * file_path,
+    sc_uint32 file_path_size);
+
 /*! Removes sc-link content string from file system memory.
  * @param link_hash A sc-link hash
  * @returns SC_TRUE, if such sc-string content exists.
@@ -124,6 +154,19 @@ sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
     sc_char ** string,
     sc_uint32 * string_size);
 
+/*! Gets sc-link content string with its size by sc-link hash.
+ * @param link_hash A sc-link hash
+ * @param[out] string A sc-link content string or path to file with sc-link content
+ * @param[out] string_size A sc-link content string size
+ * @param[out] is_file_path SC_TRUE, if \p string is a path to file with sc-link content
+ * @returns SC_FS_MEMORY_OK, if sc-link content exists.
+ */
+sc_fs_memory_status sc_fs_memory_get_string_by_link_hash_ext(
+    sc_addr_hash link_hash,
+    sc_char ** string,
+    sc_uint32 * string_size,
+    sc_bool * is_file_path);
+
 /*! Gets sc-link hashes from file system memory by its string content.
  * @param string A sc-links content string
  * @param string_size A sc-links content string size
@@ -150,6 +193,19 @@ sc_fs_memory_status sc_fs_memory_get_link_hashes_by_substring(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*! Gets sc-link hashes from file system memory by their numeric contents in order of values.
+ * @param min_value A minimal value of the closed range
+ * @param max_value A maximal value of the closed range
+ * @param data Data passed into callback
+ * @param callback A callback that is called for every found sc-link
+ * @returns SC_FS_MEMORY_OK, if such sc-link hashes exist.
+ */
+sc_fs_memory_status sc_fs_memory_get_link_hashes_by_number_range(
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr));
+
 /*! Gets sc-strings from file system memory by its substring content.
  * @param substring A sc-strings content substring
  * @param string_size A sc-strings content substring size
@@ -174,4 +230,10 @@ sc_fs_memory_status sc_fs_memory_load(sc_storage * storage);
  */
 sc_fs_memory_status sc_fs_memory_save(sc_storage * storage);
 
+/*! Compact file system memory strings channels, removing strings that have no sc-links
+ * @returns SC_FS_MEMORY_OK, if file system compacted or there is nothing to compact, SC_FS_MEMORY_NO, if file
+ * system memory isn't initialized or can't be compacted, or SC_FS_MEMORY_WRITE_ERROR, if there are writing errors.
+ */
+sc_fs_memory_status sc_fs_memory_compact();
+
 #endif
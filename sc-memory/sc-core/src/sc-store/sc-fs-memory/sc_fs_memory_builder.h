@@ -23,9 +23,13 @@ sc_fs_memory_manager * sc_fs_memory_build()
   manager->link_string = sc_dictionary_fs_memory_link_string_ext;
   manager->get_link_hashes_by_string = sc_dictionary_fs_memory_get_link_hashes_by_string;
   manager->get_link_hashes_by_substring = sc_dictionary_fs_memory_get_link_hashes_by_substring_ext;
+  manager->get_link_hashes_by_number_range = sc_dictionary_fs_memory_get_link_hashes_by_number_range;
   manager->get_strings_by_substring = sc_dictionary_fs_memory_get_strings_by_substring_ext;
+  manager->link_file_path = sc_dictionary_fs_memory_link_file_path;
   manager->get_string_by_link_hash = sc_dictionary_fs_memory_get_string_by_link_hash;
+  manager->get_string_by_link_hash_ext = sc_dictionary_fs_memory_get_string_by_link_hash_ext;
   manager->unlink_string = sc_dictionary_fs_memory_unlink_string;
+  manager->compact = sc_dictionary_fs_memory_compact;
 #endif
 
   return manager;
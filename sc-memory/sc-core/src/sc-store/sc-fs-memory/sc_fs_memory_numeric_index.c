@@ -0,0 +1,539 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_fs_memory_numeric_index.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_list.h"
+#include "sc-core/sc-container/sc_string.h"
+
+#include "sc-store/sc-base/sc_monitor_private.h"
+#include "sc-store/sc-container/sc_hash_table.h"
+
+#include "sc_file_system.h"
+#include "sc_io.h"
+
+#define SC_FS_NUMERIC_INDEX_MAGIC "SCNUMIX"
+#define SC_FS_NUMERIC_INDEX_MAGIC_SIZE 8
+#define SC_FS_NUMERIC_INDEX_VERSION 2
+#define SC_FS_NUMERIC_INDEX_TMP_EXT ".tmp"
+#define SC_FS_NUMERIC_INDEX_DELTA_RUN_SIZE 1024
+#define SC_FS_NUMERIC_INDEX_MAX_RUNS 48
+
+// file starts with header, then entries sorted by values and sc-link hashes
+typedef struct
+{
+  sc_char magic[SC_FS_NUMERIC_INDEX_MAGIC_SIZE];
+  sc_uint32 version;
+  sc_uint32 entry_size;
+  sc_uint64 entries_count;
+  sc_uint64 strings_save_id;  // numeric index is valid only with sc-links strings saved with it
+} sc_fs_memory_numeric_index_header;
+
+typedef struct
+{
+  sc_double value;
+  sc_addr_hash link_hash;
+  sc_uint32 is_removed;  // removed entries stay in runs as tombstones until runs are merged
+} sc_fs_memory_numeric_index_entry;
+
+typedef struct
+{
+  sc_fs_memory_numeric_index_entry * entries;
+  sc_uint64 size;
+  sc_uint64 removed_count;
+} sc_fs_memory_numeric_index_run;
+
+struct _sc_fs_memory_numeric_index
+{
+  // run 0 is delta run, run i holds at most SC_FS_NUMERIC_INDEX_DELTA_RUN_SIZE << i entries
+  sc_fs_memory_numeric_index_run runs[SC_FS_NUMERIC_INDEX_MAX_RUNS];
+  sc_hash_table * link_hash_values;  // sc-link hashes and pointers to their indexed values
+  sc_monitor monitor;
+};
+
+sc_fs_memory_numeric_index * sc_fs_memory_numeric_index_new()
+{
+  sc_fs_memory_numeric_index * index = sc_mem_new(sc_fs_memory_numeric_index, 1);
+  index->runs[0].entries = sc_mem_new(sc_fs_memory_numeric_index_entry, SC_FS_NUMERIC_INDEX_DELTA_RUN_SIZE);
+  index->link_hash_values = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, sc_mem_free);
+  sc_monitor_init(&index->monitor);
+  return index;
+}
+
+void sc_fs_memory_numeric_index_destroy(sc_fs_memory_numeric_index * index)
+{
+  if (index == null_ptr)
+    return;
+
+  for (sc_uint32 i = 0; i < SC_FS_NUMERIC_INDEX_MAX_RUNS; ++i)
+    sc_mem_free(index->runs[i].entries);
+  sc_hash_table_destroy(index->link_hash_values);
+  sc_monitor_destroy(&index->monitor);
+  sc_mem_free(index);
+}
+
+sc_bool sc_fs_memory_numeric_index_parse_string(
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_double * value)
+{
+  if (string == null_ptr || string_size == 0 || string_size > SC_FS_MEMORY_NUMERIC_INDEX_MAX_STRING_SIZE)
+    return SC_FALSE;
+
+  // numbers are written by sc-links without leading spaces, `inf` and `nan` aren't indexed
+  sc_char const first = string[0];
+  if (!(first >= '0' && first <= '9') && first != '-' && first != '+' && first != '.')
+    return SC_FALSE;
+
+  sc_char number[SC_FS_MEMORY_NUMERIC_INDEX_MAX_STRING_SIZE + 1];
+  memcpy(number, string, string_size);
+  number[string_size] = '\0';
+
+  sc_char * end = null_ptr;
+  *value = strtod(number, &end);
+  return end == number + string_size && isfinite(*value);
+}
+
+sc_int32 _sc_fs_memory_numeric_index_compare(
+    sc_fs_memory_numeric_index_entry const * entry,
+    sc_double const value,
+    sc_addr_hash const link_hash)
+{
+  if (entry->value != value)
+    return entry->value < value ? -1 : 1;
+
+  return (entry->link_hash > link_hash) - (entry->link_hash < link_hash);
+}
+
+sc_uint64 _sc_fs_memory_numeric_index_lower_bound(
+    sc_fs_memory_numeric_index_run const * run,
+    sc_double const value,
+    sc_addr_hash const link_hash)
+{
+  sc_uint64 begin = 0;
+  sc_uint64 end = run->size;
+  while (begin < end)
+  {
+    sc_uint64 const middle = begin + (end - begin) / 2;
+    if (_sc_fs_memory_numeric_index_compare(&run->entries[middle], value, link_hash) < 0)
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+
+  return begin;
+}
+
+sc_uint64 _sc_fs_memory_numeric_index_get_run_capacity(sc_uint32 const run)
+{
+  return (sc_uint64)SC_FS_NUMERIC_INDEX_DELTA_RUN_SIZE << run;
+}
+
+//! Merges two sorted runs into new one, tombstones are dropped
+sc_fs_memory_numeric_index_run _sc_fs_memory_numeric_index_merge_runs(
+    sc_fs_memory_numeric_index_run const * run,
+    sc_fs_memory_numeric_index_run const * other_run)
+{
+  sc_fs_memory_numeric_index_run merged_run;
+  merged_run.size = 0;
+  merged_run.removed_count = 0;
+  merged_run.entries = sc_mem_new(
+      sc_fs_memory_numeric_index_entry,
+      (run->size - run->removed_count + other_run->size - other_run->removed_count + 1));
+
+  sc_uint64 i = 0, j = 0;
+  while (i < run->size || j < other_run->size)
+  {
+    sc_fs_memory_numeric_index_entry const * entry;
+    if (j == other_run->size
+        || (i < run->size
+            && _sc_fs_memory_numeric_index_compare(
+                   &run->entries[i], other_run->entries[j].value, other_run->entries[j].link_hash)
+                   < 0))
+      entry = &run->entries[i++];
+    else
+      entry = &other_run->entries[j++];
+
+    if (entry->is_removed == SC_FALSE)
+      merged_run.entries[merged_run.size++] = *entry;
+  }
+
+  return merged_run;
+}
+
+/*! Merges full delta run into runs with growing capacities. Every entry is moved into larger run at most once per run,
+ * so indexing costs O(log N) amortized moves instead of merging all entries every time delta run is full.
+ */
+void _sc_fs_memory_numeric_index_flush_delta_run(sc_fs_memory_numeric_index * index)
+{
+  static sc_fs_memory_numeric_index_run const empty_run = {null_ptr, 0, 0};
+
+  sc_fs_memory_numeric_index_run carry = index->runs[0];
+  sc_bool is_carry_allocated = SC_FALSE;
+  for (sc_uint32 i = 1; i < SC_FS_NUMERIC_INDEX_MAX_RUNS; ++i)
+  {
+    sc_fs_memory_numeric_index_run * run = &index->runs[i];
+
+    sc_fs_memory_numeric_index_run merged_run;
+    if (run->size == 0 && is_carry_allocated)
+      merged_run = carry;
+    else
+    {
+      merged_run = _sc_fs_memory_numeric_index_merge_runs(run, &carry);
+      if (is_carry_allocated)
+        sc_mem_free(carry.entries);
+    }
+    sc_mem_free(run->entries);
+    *run = empty_run;
+
+    if (merged_run.size <= _sc_fs_memory_numeric_index_get_run_capacity(i) || i + 1 == SC_FS_NUMERIC_INDEX_MAX_RUNS)
+    {
+      *run = merged_run;
+      break;
+    }
+
+    carry = merged_run;
+    is_carry_allocated = SC_TRUE;
+  }
+
+  index->runs[0].size = 0;
+}
+
+void _sc_fs_memory_numeric_index_remove_entry(
+    sc_fs_memory_numeric_index * index,
+    sc_addr_hash const link_hash,
+    sc_double const value)
+{
+  for (sc_uint32 i = 0; i < SC_FS_NUMERIC_INDEX_MAX_RUNS; ++i)
+  {
+    sc_fs_memory_numeric_index_run * run = &index->runs[i];
+    sc_uint64 const position = _sc_fs_memory_numeric_index_lower_bound(run, value, link_hash);
+    if (position == run->size || _sc_fs_memory_numeric_index_compare(&run->entries[position], value, link_hash) != 0
+        || run->entries[position].is_removed)
+      continue;
+
+    // delta run is small, so entries are removed from it in place
+    if (i == 0)
+    {
+      memmove(
+          &run->entries[position],
+          &run->entries[position + 1],
+          (run->size - position - 1) * sizeof(sc_fs_memory_numeric_index_entry));
+      --run->size;
+      return;
+    }
+
+    run->entries[position].is_removed = SC_TRUE;
+    ++run->removed_count;
+    // run is compacted when most of its entries are tombstones, so it costs O(1) amortized per remove
+    if (run->removed_count * 2 > run->size)
+    {
+      static sc_fs_memory_numeric_index_run const empty_run = {null_ptr, 0, 0};
+      sc_fs_memory_numeric_index_run const compacted_run = _sc_fs_memory_numeric_index_merge_runs(run, &empty_run);
+      sc_mem_free(run->entries);
+      *run = compacted_run;
+    }
+    return;
+  }
+}
+
+void _sc_fs_memory_numeric_index_append_entry(
+    sc_fs_memory_numeric_index * index,
+    sc_addr_hash const link_hash,
+    sc_double const value)
+{
+  sc_fs_memory_numeric_index_run * delta_run = &index->runs[0];
+  if (delta_run->size == SC_FS_NUMERIC_INDEX_DELTA_RUN_SIZE)
+    _sc_fs_memory_numeric_index_flush_delta_run(index);
+
+  sc_uint64 const position = _sc_fs_memory_numeric_index_lower_bound(delta_run, value, link_hash);
+  memmove(
+      &delta_run->entries[position + 1],
+      &delta_run->entries[position],
+      (delta_run->size - position) * sizeof(sc_fs_memory_numeric_index_entry));
+  delta_run->entries[position] = (sc_fs_memory_numeric_index_entry){value, link_hash, SC_FALSE};
+  ++delta_run->size;
+}
+
+/*! Gets next entry in order of values from all runs and moves runs positions.
+ * @returns A pointer to entry that isn't removed, or null_ptr if all runs are passed.
+ */
+sc_fs_memory_numeric_index_entry const * _sc_fs_memory_numeric_index_next_entry(
+    sc_fs_memory_numeric_index const * index,
+    sc_uint64 * positions)
+{
+  while (SC_TRUE)
+  {
+    sc_uint32 min_run = SC_FS_NUMERIC_INDEX_MAX_RUNS;
+    sc_fs_memory_numeric_index_entry const * min_entry = null_ptr;
+    for (sc_uint32 i = 0; i < SC_FS_NUMERIC_INDEX_MAX_RUNS; ++i)
+    {
+      sc_fs_memory_numeric_index_run const * run = &index->runs[i];
+      if (positions[i] >= run->size)
+        continue;
+
+      sc_fs_memory_numeric_index_entry const * entry = &run->entries[positions[i]];
+      if (min_entry == null_ptr
+          || _sc_fs_memory_numeric_index_compare(entry, min_entry->value, min_entry->link_hash) < 0)
+      {
+        min_run = i;
+        min_entry = entry;
+      }
+    }
+
+    if (min_entry == null_ptr)
+      return null_ptr;
+
+    ++positions[min_run];
+    if (min_entry->is_removed == SC_FALSE)
+      return min_entry;
+  }
+}
+
+void sc_fs_memory_numeric_index_update(
+    sc_fs_memory_numeric_index * index,
+    sc_addr_hash const link_hash,
+    sc_char const * string,
+    sc_uint64 const string_size)
+{
+  sc_double value;
+  if (sc_fs_memory_numeric_index_parse_string(string, string_size, &value) == SC_FALSE)
+  {
+    sc_fs_memory_numeric_index_remove(index, link_hash);
+    return;
+  }
+
+  sc_monitor_acquire_write(&index->monitor);
+
+  sc_double * indexed_value = sc_hash_table_get(index->link_hash_values, (sc_addr_hash_to_sc_pointer)link_hash);
+  if (indexed_value == null_ptr)
+  {
+    indexed_value = sc_mem_new(sc_double, 1);
+    sc_hash_table_insert(index->link_hash_values, (sc_addr_hash_to_sc_pointer)link_hash, indexed_value);
+  }
+  else if (*indexed_value == value)
+    goto result;
+  else
+    _sc_fs_memory_numeric_index_remove_entry(index, link_hash, *indexed_value);
+
+  *indexed_value = value;
+  _sc_fs_memory_numeric_index_append_entry(index, link_hash, value);
+
+result:
+  sc_monitor_release_write(&index->monitor);
+}
+
+void sc_fs_memory_numeric_index_remove(sc_fs_memory_numeric_index * index, sc_addr_hash const link_hash)
+{
+  sc_monitor_acquire_write(&index->monitor);
+
+  sc_double const * indexed_value =
+      sc_hash_table_get(index->link_hash_values, (sc_addr_hash_to_sc_pointer)link_hash);
+  if (indexed_value != null_ptr)
+  {
+    _sc_fs_memory_numeric_index_remove_entry(index, link_hash, *indexed_value);
+    sc_hash_table_remove(index->link_hash_values, (sc_addr_hash_to_sc_pointer)link_hash);
+  }
+
+  sc_monitor_release_write(&index->monitor);
+}
+
+sc_uint64 sc_fs_memory_numeric_index_get_size(sc_fs_memory_numeric_index * index)
+{
+  sc_monitor_acquire_read(&index->monitor);
+  sc_uint64 const size = sc_hash_table_size(index->link_hash_values);
+  sc_monitor_release_read(&index->monitor);
+  return size;
+}
+
+sc_fs_memory_status sc_fs_memory_numeric_index_get_link_hashes_by_range(
+    sc_fs_memory_numeric_index * index,
+    sc_double const min_value,
+    sc_double const max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr))
+{
+  if (!(min_value <= max_value))
+    return SC_FS_MEMORY_NO_STRING;
+
+  sc_list * link_hashes;
+  sc_list_init(&link_hashes);
+
+  sc_monitor_acquire_read(&index->monitor);
+  {
+    sc_uint64 positions[SC_FS_NUMERIC_INDEX_MAX_RUNS];
+    for (sc_uint32 i = 0; i < SC_FS_NUMERIC_INDEX_MAX_RUNS; ++i)
+      positions[i] = _sc_fs_memory_numeric_index_lower_bound(&index->runs[i], min_value, 0);
+
+    sc_fs_memory_numeric_index_entry const * entry;
+    while ((entry = _sc_fs_memory_numeric_index_next_entry(index, positions)) != null_ptr && entry->value <= max_value)
+      sc_list_push_back(link_hashes, (sc_addr_hash_to_sc_pointer)entry->link_hash);
+  }
+  sc_monitor_release_read(&index->monitor);
+
+  sc_fs_memory_status const status = link_hashes->size == 0 ? SC_FS_MEMORY_NO_STRING : SC_FS_MEMORY_OK;
+
+  sc_iterator * link_hashes_it = sc_list_iterator(link_hashes);
+  while (sc_iterator_next(link_hashes_it))
+  {
+    sc_addr_hash const link_hash = (sc_pointer_to_sc_addr_hash)sc_iterator_get(link_hashes_it);
+    sc_addr link_addr;
+    SC_ADDR_LOCAL_FROM_INT(link_hash, link_addr);
+    callback(data, link_addr);
+  }
+  sc_iterator_destroy(link_hashes_it);
+  sc_list_destroy(link_hashes);
+
+  return status;
+}
+
+sc_bool _sc_fs_memory_numeric_index_read_chars(sc_io_channel * channel, void * chars, sc_uint64 const size)
+{
+  sc_uint64 read_bytes = 0;
+  return size == 0
+         || (sc_io_channel_read_chars(channel, chars, size, &read_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+             && read_bytes == size);
+}
+
+sc_bool _sc_fs_memory_numeric_index_write_chars(sc_io_channel * channel, void const * chars, sc_uint64 const size)
+{
+  sc_uint64 written_bytes = 0;
+  return size == 0
+         || (sc_io_channel_write_chars(channel, chars, size, &written_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+             && written_bytes == size);
+}
+
+sc_fs_memory_status sc_fs_memory_numeric_index_read(
+    sc_char const * path,
+    sc_uint64 const strings_save_id,
+    sc_fs_memory_numeric_index * index)
+{
+  sc_io_channel * channel = sc_io_new_read_channel(path, null_ptr);
+  if (channel == null_ptr)
+    return SC_FS_MEMORY_WRONG_PATH;
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_fs_memory_numeric_index_header header;
+  if (_sc_fs_memory_numeric_index_read_chars(channel, &header, sizeof(header)) == SC_FALSE
+      || !sc_str_n_cmp(header.magic, SC_FS_NUMERIC_INDEX_MAGIC, SC_FS_NUMERIC_INDEX_MAGIC_SIZE)
+      || header.version != SC_FS_NUMERIC_INDEX_VERSION
+      || header.entry_size != sizeof(sc_fs_memory_numeric_index_entry)
+      || header.entries_count >= SC_MAXUINT32 / sizeof(sc_fs_memory_numeric_index_entry)
+      || header.strings_save_id != strings_save_id)
+    goto error;
+
+  sc_fs_memory_numeric_index_entry * entries =
+      sc_mem_new(sc_fs_memory_numeric_index_entry, (header.entries_count + 1));
+  if (_sc_fs_memory_numeric_index_read_chars(
+          channel, entries, header.entries_count * sizeof(sc_fs_memory_numeric_index_entry))
+      == SC_FALSE)
+  {
+    sc_mem_free(entries);
+    goto error;
+  }
+  sc_io_channel_shutdown(channel, SC_FALSE, null_ptr);
+
+  // binary search in runs needs entries sorted by values and sc-link hashes without duplicates
+  sc_hash_table * link_hash_values = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, sc_mem_free);
+  for (sc_uint64 i = 0; i < header.entries_count; ++i)
+  {
+    sc_fs_memory_numeric_index_entry * entry = &entries[i];
+    if (!isfinite(entry->value) || entry->is_removed != SC_FALSE
+        || (i != 0 && _sc_fs_memory_numeric_index_compare(&entries[i - 1], entry->value, entry->link_hash) >= 0)
+        || sc_hash_table_get(link_hash_values, (sc_addr_hash_to_sc_pointer)entry->link_hash) != null_ptr)
+    {
+      sc_hash_table_destroy(link_hash_values);
+      sc_mem_free(entries);
+      return SC_FS_MEMORY_READ_ERROR;
+    }
+
+    sc_double * value = sc_mem_new(sc_double, 1);
+    *value = entry->value;
+    sc_hash_table_insert(link_hash_values, (sc_addr_hash_to_sc_pointer)entry->link_hash, value);
+  }
+
+  // saved entries form one run that is placed as the smallest run that can hold them
+  sc_uint32 run = 1;
+  while (run + 1 < SC_FS_NUMERIC_INDEX_MAX_RUNS
+         && _sc_fs_memory_numeric_index_get_run_capacity(run) < header.entries_count)
+    ++run;
+
+  sc_monitor_acquire_write(&index->monitor);
+  for (sc_uint32 i = 1; i < SC_FS_NUMERIC_INDEX_MAX_RUNS; ++i)
+  {
+    sc_mem_free(index->runs[i].entries);
+    index->runs[i] = (sc_fs_memory_numeric_index_run){null_ptr, 0, 0};
+  }
+  index->runs[0].size = 0;
+  index->runs[run] = (sc_fs_memory_numeric_index_run){entries, header.entries_count, 0};
+  sc_hash_table_destroy(index->link_hash_values);
+  index->link_hash_values = link_hash_values;
+  sc_monitor_release_write(&index->monitor);
+
+  return SC_FS_MEMORY_OK;
+
+error:
+  sc_io_channel_shutdown(channel, SC_FALSE, null_ptr);
+  return SC_FS_MEMORY_READ_ERROR;
+}
+
+sc_fs_memory_status sc_fs_memory_numeric_index_write(
+    sc_char const * path,
+    sc_uint64 const strings_save_id,
+    sc_fs_memory_numeric_index * index)
+{
+  sc_char * tmp_path;
+  {
+    sc_str_concat(path, SC_FS_NUMERIC_INDEX_TMP_EXT, tmp_path);
+  }
+
+  sc_io_channel * channel = sc_io_new_write_channel(tmp_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_mem_free(tmp_path);
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_fs_memory_numeric_index_header header;
+  sc_mem_set(&header, 0, sizeof(header));
+  sc_mem_cpy(header.magic, SC_FS_NUMERIC_INDEX_MAGIC, SC_FS_NUMERIC_INDEX_MAGIC_SIZE);
+  header.version = SC_FS_NUMERIC_INDEX_VERSION;
+  header.entry_size = sizeof(sc_fs_memory_numeric_index_entry);
+  header.strings_save_id = strings_save_id;
+
+  // runs are written merged into one without changing them
+  sc_monitor_acquire_read(&index->monitor);
+  for (sc_uint32 i = 0; i < SC_FS_NUMERIC_INDEX_MAX_RUNS; ++i)
+    header.entries_count += index->runs[i].size - index->runs[i].removed_count;
+
+  sc_bool is_written = _sc_fs_memory_numeric_index_write_chars(channel, &header, sizeof(header));
+  {
+    sc_uint64 positions[SC_FS_NUMERIC_INDEX_MAX_RUNS];
+    sc_mem_set(positions, 0, sizeof(positions));
+
+    sc_fs_memory_numeric_index_entry const * entry;
+    while (is_written && (entry = _sc_fs_memory_numeric_index_next_entry(index, positions)) != null_ptr)
+      is_written = _sc_fs_memory_numeric_index_write_chars(channel, entry, sizeof(*entry));
+  }
+  sc_monitor_release_read(&index->monitor);
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+
+  if (is_written == SC_FALSE || sc_fs_rename_file(tmp_path, path) == SC_FALSE)
+  {
+    sc_fs_remove_file(tmp_path);
+    sc_mem_free(tmp_path);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  sc_mem_free(tmp_path);
+  return SC_FS_MEMORY_OK;
+}
@@ -0,0 +1,106 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_fs_memory_numeric_index_h_
+#define _sc_fs_memory_numeric_index_h_
+
+#include "sc-core/sc_types.h"
+
+#include "sc_fs_memory_status.h"
+
+//! Maximal size of sc-link content string that can be indexed as number
+#define SC_FS_MEMORY_NUMERIC_INDEX_MAX_STRING_SIZE 64
+
+/*!
+ * Numeric index keeps sc-links with numeric contents ordered by their values. It consists of sorted runs with growing
+ * capacities: the small delta run with recently indexed sc-links and larger runs it is merged into when it is full.
+ * Sc-links removed from larger runs are marked as removed and dropped when runs are merged.
+ */
+typedef struct _sc_fs_memory_numeric_index sc_fs_memory_numeric_index;
+
+/*! Creates empty numeric index.
+ * @returns A pointer to created numeric index.
+ */
+sc_fs_memory_numeric_index * sc_fs_memory_numeric_index_new();
+
+/*! Frees numeric index.
+ * @param index A pointer to numeric index. It can be null_ptr.
+ */
+void sc_fs_memory_numeric_index_destroy(sc_fs_memory_numeric_index * index);
+
+/*! Parses sc-link content string as number. Whole string must be a finite decimal or hexadecimal number.
+ * @param string A sc-link content string. It needn't be null-terminated.
+ * @param string_size A size of sc-link content string.
+ * @param[out] value A pointer to parsed number.
+ * @returns SC_TRUE, if string is a number.
+ */
+sc_bool sc_fs_memory_numeric_index_parse_string(sc_char const * string, sc_uint64 string_size, sc_double * value);
+
+/*! Indexes sc-link by its content string. If string isn't a number, sc-link is removed from numeric index.
+ * @param index A pointer to numeric index.
+ * @param link_hash A sc-link hash.
+ * @param string A sc-link content string. It needn't be null-terminated.
+ * @param string_size A size of sc-link content string.
+ */
+void sc_fs_memory_numeric_index_update(
+    sc_fs_memory_numeric_index * index,
+    sc_addr_hash link_hash,
+    sc_char const * string,
+    sc_uint64 string_size);
+
+/*! Removes sc-link from numeric index.
+ * @param index A pointer to numeric index.
+ * @param link_hash A sc-link hash.
+ */
+void sc_fs_memory_numeric_index_remove(sc_fs_memory_numeric_index * index, sc_addr_hash link_hash);
+
+/*! Gets count of indexed sc-links.
+ * @param index A pointer to numeric index.
+ * @returns Count of sc-links with numeric contents.
+ */
+sc_uint64 sc_fs_memory_numeric_index_get_size(sc_fs_memory_numeric_index * index);
+
+/*! Gets sc-links with numeric contents from closed range ordered by their values. Sc-links are collected under index
+ * lock, callback is called for them after lock is released.
+ * @param index A pointer to numeric index.
+ * @param min_value A minimal value of range.
+ * @param max_value A maximal value of range.
+ * @param data Data passed into callback.
+ * @param callback A callback that is called for every found sc-link.
+ * @returns SC_FS_MEMORY_OK, if sc-links are found; SC_FS_MEMORY_NO_STRING, if there are no such sc-links.
+ */
+sc_fs_memory_status sc_fs_memory_numeric_index_get_link_hashes_by_range(
+    sc_fs_memory_numeric_index * index,
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr));
+
+/*! Reads numeric index from file.
+ * @param path A path to numeric index file.
+ * @param strings_save_id An identifier of save of sc-links strings that numeric index must be written with.
+ * @param index A pointer to empty numeric index.
+ * @returns SC_FS_MEMORY_OK, if numeric index is read; SC_FS_MEMORY_WRONG_PATH, if file can't be opened;
+ * SC_FS_MEMORY_READ_ERROR, if file is not valid numeric index, it is written with other save of sc-links strings or
+ * its entries aren't sorted and unique.
+ */
+sc_fs_memory_status sc_fs_memory_numeric_index_read(
+    sc_char const * path,
+    sc_uint64 strings_save_id,
+    sc_fs_memory_numeric_index * index);
+
+/*! Writes numeric index to temporary file that replaces file by specified path.
+ * @param path A path to numeric index file.
+ * @param strings_save_id An identifier of save of sc-links strings that numeric index is written with.
+ * @param index A pointer to numeric index.
+ * @returns SC_FS_MEMORY_OK, if numeric index is written.
+ */
+sc_fs_memory_status sc_fs_memory_numeric_index_write(
+    sc_char const * path,
+    sc_uint64 strings_save_id,
+    sc_fs_memory_numeric_index * index);
+
+#endif
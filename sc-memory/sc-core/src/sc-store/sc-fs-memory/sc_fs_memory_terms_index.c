@@ -0,0 +1,560 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_fs_memory_terms_index.h"
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_list.h"
+#include "sc-core/sc-container/sc_string.h"
+
+#include "sc-store/sc-container/sc_dictionary_private.h"
+#include "sc-store/sc-container/sc_struct_node.h"
+
+#include "sc_file_system.h"
+#include "sc_io.h"
+
+#define SC_FS_TERMS_INDEX_MAGIC "SCTERMS"
+#define SC_FS_TERMS_INDEX_MAGIC_SIZE 8
+#define SC_FS_TERMS_INDEX_VERSION 1
+#define SC_FS_TERMS_INDEX_TMP_EXT ".tmp"
+
+// file starts with header, then entries of terms sorted in byte order, then strings offsets of all terms, then terms
+typedef struct
+{
+  sc_char magic[SC_FS_TERMS_INDEX_MAGIC_SIZE];
+  sc_uint32 version;
+  sc_uint32 entry_size;
+  sc_uint64 last_string_offset;
+  sc_uint64 terms_count;
+  sc_uint64 string_offsets_count;
+  sc_uint64 terms_size;
+} sc_fs_memory_terms_index_header;
+
+typedef struct
+{
+  sc_uint64 term_offset;           // offset of term in terms section
+  sc_uint64 term_size;             // size of term
+  sc_uint64 string_offsets_begin;  // index of first term string offset in strings offsets section
+  sc_uint64 string_offsets_count;  // count of term strings offsets
+} sc_fs_memory_terms_index_entry;
+
+struct _sc_fs_memory_terms_index
+{
+  void * data;  // pointer to mapped terms index file
+  sc_uint64 size;
+  sc_fs_memory_terms_index_header const * header;
+  sc_fs_memory_terms_index_entry const * entries;
+  sc_uint64 const * string_offsets;
+  sc_char const * terms;
+};
+
+// term of merged terms index, its strings offsets are taken from mapped terms index and from dictionary
+typedef struct
+{
+  sc_char const * term;
+  sc_uint64 term_size;
+  sc_uint64 const * index_string_offsets;
+  sc_uint64 index_string_offsets_count;
+  sc_list const * dictionary_string_offsets;  // list with term and its strings offsets
+} sc_fs_memory_terms_index_item;
+
+sc_int32 _sc_fs_memory_terms_index_compare_terms(
+    sc_char const * term,
+    sc_uint64 const term_size,
+    sc_char const * other_term,
+    sc_uint64 const other_term_size)
+{
+  sc_int32 const result = memcmp(term, other_term, sc_min(term_size, other_term_size));
+  if (result != 0)
+    return result;
+
+  return (term_size > other_term_size) - (term_size < other_term_size);
+}
+
+sc_bool sc_fs_memory_terms_index_is_file(sc_char const * path)
+{
+  sc_int32 const fd = open(path, O_RDONLY);
+  if (fd == -1)
+    return SC_FALSE;
+
+  sc_char magic[SC_FS_TERMS_INDEX_MAGIC_SIZE];
+  sc_bool const result =
+      read(fd, magic, SC_FS_TERMS_INDEX_MAGIC_SIZE) == SC_FS_TERMS_INDEX_MAGIC_SIZE
+      && sc_str_n_cmp(magic, SC_FS_TERMS_INDEX_MAGIC, SC_FS_TERMS_INDEX_MAGIC_SIZE);
+  close(fd);
+  return result;
+}
+
+sc_fs_memory_status sc_fs_memory_terms_index_map(
+    sc_char const * path,
+    sc_fs_memory_terms_index ** index,
+    sc_uint64 * last_string_offset)
+{
+  *index = null_ptr;
+
+  sc_int32 const fd = open(path, O_RDONLY);
+  if (fd == -1)
+    return SC_FS_MEMORY_WRONG_PATH;
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || (sc_uint64)file_stat.st_size < sizeof(sc_fs_memory_terms_index_header))
+  {
+    close(fd);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_uint64 const size = (sc_uint64)file_stat.st_size;
+  void * data = mmap(null_ptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // mapping stays valid after file descriptor is closed
+  close(fd);
+  if (data == MAP_FAILED)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  sc_fs_memory_terms_index_header const * header = data;
+  sc_uint64 const entries_size = header->terms_count * sizeof(sc_fs_memory_terms_index_entry);
+  sc_uint64 const string_offsets_size = header->string_offsets_count * sizeof(sc_uint64);
+  if (!sc_str_n_cmp(header->magic, SC_FS_TERMS_INDEX_MAGIC, SC_FS_TERMS_INDEX_MAGIC_SIZE)
+      || header->version != SC_FS_TERMS_INDEX_VERSION || header->entry_size != sizeof(sc_fs_memory_terms_index_entry)
+      || entries_size / sizeof(sc_fs_memory_terms_index_entry) != header->terms_count
+      || string_offsets_size / sizeof(sc_uint64) != header->string_offsets_count
+      || sizeof(sc_fs_memory_terms_index_header) + entries_size + string_offsets_size + header->terms_size != size)
+  {
+    munmap(data, size);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  *index = sc_mem_new(sc_fs_memory_terms_index, 1);
+  (*index)->data = data;
+  (*index)->size = size;
+  (*index)->header = header;
+  (*index)->entries = (sc_fs_memory_terms_index_entry const *)(header + 1);
+  (*index)->string_offsets = (sc_uint64 const *)((*index)->entries + header->terms_count);
+  (*index)->terms = (sc_char const *)((*index)->string_offsets + header->string_offsets_count);
+  *last_string_offset = header->last_string_offset;
+
+  return SC_FS_MEMORY_OK;
+}
+
+void sc_fs_memory_terms_index_unmap(sc_fs_memory_terms_index * index)
+{
+  if (index == null_ptr)
+    return;
+
+  munmap(index->data, index->size);
+  sc_mem_free(index);
+}
+
+sc_uint64 sc_fs_memory_terms_index_get_terms_count(sc_fs_memory_terms_index const * index)
+{
+  return index == null_ptr ? 0 : index->header->terms_count;
+}
+
+//! Finds first entry which term isn't less than specified one
+sc_uint64 _sc_fs_memory_terms_index_lower_bound(
+    sc_fs_memory_terms_index const * index,
+    sc_char const * term,
+    sc_uint64 const term_size)
+{
+  sc_uint64 begin = 0;
+  sc_uint64 end = index->header->terms_count;
+  while (begin < end)
+  {
+    sc_uint64 const middle = begin + (end - begin) / 2;
+    sc_fs_memory_terms_index_entry const * entry = &index->entries[middle];
+    if (_sc_fs_memory_terms_index_compare_terms(
+            index->terms + entry->term_offset, entry->term_size, term, term_size)
+        < 0)
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+
+  return begin;
+}
+
+sc_bool sc_fs_memory_terms_index_get_string_offsets(
+    sc_fs_memory_terms_index const * index,
+    sc_char const * term,
+    sc_uint64 const term_size,
+    sc_uint64 const ** string_offsets,
+    sc_uint64 * string_offsets_count)
+{
+  *string_offsets = null_ptr;
+  *string_offsets_count = 0;
+  if (index == null_ptr)
+    return SC_FALSE;
+
+  sc_uint64 const position = _sc_fs_memory_terms_index_lower_bound(index, term, term_size);
+  if (position == index->header->terms_count)
+    return SC_FALSE;
+
+  sc_fs_memory_terms_index_entry const * entry = &index->entries[position];
+  if (entry->term_size != term_size || !sc_str_n_cmp(index->terms + entry->term_offset, term, term_size))
+    return SC_FALSE;
+
+  *string_offsets = index->string_offsets + entry->string_offsets_begin;
+  *string_offsets_count = entry->string_offsets_count;
+  return SC_TRUE;
+}
+
+sc_bool sc_fs_memory_terms_index_visit_by_prefix(
+    sc_fs_memory_terms_index const * index,
+    sc_char const * prefix,
+    sc_uint64 const prefix_size,
+    sc_bool (*callable)(
+        sc_char const * term,
+        sc_uint64 term_size,
+        sc_uint64 const * string_offsets,
+        sc_uint64 string_offsets_count,
+        void ** arguments),
+    void ** arguments)
+{
+  if (index == null_ptr)
+    return SC_TRUE;
+
+  // terms with the same prefix are placed one after another
+  for (sc_uint64 i = _sc_fs_memory_terms_index_lower_bound(index, prefix, prefix_size);
+       i < index->header->terms_count;
+       ++i)
+  {
+    sc_fs_memory_terms_index_entry const * entry = &index->entries[i];
+    sc_char const * term = index->terms + entry->term_offset;
+    if (entry->term_size < prefix_size || !sc_str_n_cmp(term, prefix, prefix_size))
+      break;
+
+    if (callable(
+            term,
+            entry->term_size,
+            index->string_offsets + entry->string_offsets_begin,
+            entry->string_offsets_count,
+            arguments)
+        == SC_FALSE)
+      return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_fs_memory_terms_index_collect_dictionary_terms(sc_dictionary_node * node, void ** arguments)
+{
+  // the first list item is term, terms without strings offsets aren't written
+  sc_list * list = node->data;
+  if (list == null_ptr || list->size < 2)
+    return SC_TRUE;
+
+  sc_fs_memory_terms_index_item * items = arguments[0];
+  sc_uint64 * items_count = arguments[1];
+
+  sc_fs_memory_terms_index_item * item = &items[(*items_count)++];
+  item->term = list->begin->data;
+  item->term_size = sc_str_len(item->term);
+  item->dictionary_string_offsets = list;
+  return SC_TRUE;
+}
+
+sc_bool _sc_fs_memory_terms_index_count_dictionary_terms(sc_dictionary_node * node, void ** arguments)
+{
+  sc_list * list = node->data;
+  if (list != null_ptr && list->size >= 2)
+    ++*(sc_uint64 *)arguments;
+  return SC_TRUE;
+}
+
+int _sc_fs_memory_terms_index_compare_items(void const * item, void const * other_item)
+{
+  sc_fs_memory_terms_index_item const * term_item = item;
+  sc_fs_memory_terms_index_item const * other_term_item = other_item;
+  return _sc_fs_memory_terms_index_compare_terms(
+      term_item->term, term_item->term_size, other_term_item->term, other_term_item->term_size);
+}
+
+//! Merges sorted terms of mapped terms index and sorted terms of dictionary
+sc_fs_memory_terms_index_item * _sc_fs_memory_terms_index_merge_items(
+    sc_fs_memory_terms_index const * index,
+    sc_dictionary * terms_dictionary,
+    sc_uint64 * merged_items_count)
+{
+  sc_uint64 dictionary_items_count = 0;
+  if (terms_dictionary != null_ptr)
+    sc_dictionary_visit_down_nodes(
+        terms_dictionary, _sc_fs_memory_terms_index_count_dictionary_terms, (void **)&dictionary_items_count);
+
+  sc_fs_memory_terms_index_item * dictionary_items =
+      sc_mem_new(sc_fs_memory_terms_index_item, (dictionary_items_count + 1));
+  if (dictionary_items_count != 0)
+  {
+    sc_uint64 items_count = 0;
+    void * arguments[2];
+    arguments[0] = dictionary_items;
+    arguments[1] = &items_count;
+    sc_dictionary_visit_down_nodes(terms_dictionary, _sc_fs_memory_terms_index_collect_dictionary_terms, arguments);
+    qsort(
+        dictionary_items,
+        dictionary_items_count,
+        sizeof(sc_fs_memory_terms_index_item),
+        _sc_fs_memory_terms_index_compare_items);
+  }
+
+  sc_uint64 const index_items_count = sc_fs_memory_terms_index_get_terms_count(index);
+  sc_fs_memory_terms_index_item * items =
+      sc_mem_new(sc_fs_memory_terms_index_item, (index_items_count + dictionary_items_count + 1));
+
+  sc_uint64 i = 0, j = 0;
+  *merged_items_count = 0;
+  while (i < index_items_count || j < dictionary_items_count)
+  {
+    sc_fs_memory_terms_index_item * item = &items[(*merged_items_count)++];
+
+    sc_int32 compare_result = i == index_items_count ? 1 : -1;
+    if (i < index_items_count && j < dictionary_items_count)
+    {
+      sc_fs_memory_terms_index_entry const * entry = &index->entries[i];
+      compare_result = _sc_fs_memory_terms_index_compare_terms(
+          index->terms + entry->term_offset,
+          entry->term_size,
+          dictionary_items[j].term,
+          dictionary_items[j].term_size);
+    }
+
+    if (compare_result <= 0)
+    {
+      sc_fs_memory_terms_index_entry const * entry = &index->entries[i++];
+      item->term = index->terms + entry->term_offset;
+      item->term_size = entry->term_size;
+      item->index_string_offsets = index->string_offsets + entry->string_offsets_begin;
+      item->index_string_offsets_count = entry->string_offsets_count;
+    }
+    else
+    {
+      item->term = dictionary_items[j].term;
+      item->term_size = dictionary_items[j].term_size;
+    }
+
+    if (compare_result >= 0)
+      item->dictionary_string_offsets = dictionary_items[j++].dictionary_string_offsets;
+  }
+
+  sc_mem_free(dictionary_items);
+  return items;
+}
+
+sc_bool _sc_fs_memory_terms_index_write_chars(sc_io_channel * channel, void const * chars, sc_uint64 const size)
+{
+  sc_uint64 written_bytes = 0;
+  return size == 0
+         || (sc_io_channel_write_chars(channel, chars, size, &written_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+             && written_bytes == size);
+}
+
+sc_uint64 _sc_fs_memory_terms_index_remap_string_offset(
+    sc_uint64 (*remap_string_offset)(sc_uint64 string_offset, void * arguments),
+    void * arguments,
+    sc_uint64 const string_offset)
+{
+  return remap_string_offset == null_ptr ? string_offset + 1 : remap_string_offset(string_offset, arguments);
+}
+
+/*! Writes remapped strings offsets of term item or only counts them if channel is null_ptr.
+ * @returns SC_FALSE, if strings offsets can't be written.
+ */
+sc_bool _sc_fs_memory_terms_index_write_item_string_offsets(
+    sc_io_channel * channel,
+    sc_fs_memory_terms_index_item const * item,
+    sc_uint64 (*remap_string_offset)(sc_uint64 string_offset, void * arguments),
+    void * arguments,
+    sc_uint64 * string_offsets_count)
+{
+  *string_offsets_count = 0;
+  if (remap_string_offset == null_ptr)
+  {
+    *string_offsets_count = item->index_string_offsets_count;
+    if (channel != null_ptr
+        && !_sc_fs_memory_terms_index_write_chars(
+            channel, item->index_string_offsets, item->index_string_offsets_count * sizeof(sc_uint64)))
+      return SC_FALSE;
+  }
+  else
+  {
+    for (sc_uint64 i = 0; i < item->index_string_offsets_count; ++i)
+    {
+      sc_uint64 const string_offset = _sc_fs_memory_terms_index_remap_string_offset(
+          remap_string_offset, arguments, item->index_string_offsets[i]);
+      if (string_offset == 0)
+        continue;
+
+      ++*string_offsets_count;
+      sc_uint64 const remapped_string_offset = string_offset - 1;
+      if (channel != null_ptr
+          && !_sc_fs_memory_terms_index_write_chars(channel, &remapped_string_offset, sizeof(remapped_string_offset)))
+        return SC_FALSE;
+    }
+  }
+
+  if (item->dictionary_string_offsets == null_ptr)
+    return SC_TRUE;
+
+  sc_iterator * string_offset_it = sc_list_iterator(item->dictionary_string_offsets);
+  // the first list item is term
+  sc_iterator_next(string_offset_it);
+  while (sc_iterator_next(string_offset_it))
+  {
+    sc_uint64 const string_offset = _sc_fs_memory_terms_index_remap_string_offset(
+        remap_string_offset, arguments, (sc_uint64)sc_iterator_get(string_offset_it));
+    if (string_offset == 0)
+      continue;
+
+    ++*string_offsets_count;
+    sc_uint64 const remapped_string_offset = string_offset - 1;
+    if (channel != null_ptr
+        && !_sc_fs_memory_terms_index_write_chars(channel, &remapped_string_offset, sizeof(remapped_string_offset)))
+    {
+      sc_iterator_destroy(string_offset_it);
+      return SC_FALSE;
+    }
+  }
+  sc_iterator_destroy(string_offset_it);
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_fs_memory_terms_index_write_items(
+    sc_io_channel * channel,
+    sc_uint64 const last_string_offset,
+    sc_fs_memory_terms_index_item const * items,
+    sc_uint64 const items_count,
+    sc_uint64 (*remap_string_offset)(sc_uint64 string_offset, void * arguments),
+    void * arguments)
+{
+  sc_fs_memory_terms_index_header header;
+  sc_mem_set(&header, 0, sizeof(header));
+  sc_mem_cpy(header.magic, SC_FS_TERMS_INDEX_MAGIC, SC_FS_TERMS_INDEX_MAGIC_SIZE);
+  header.version = SC_FS_TERMS_INDEX_VERSION;
+  header.entry_size = sizeof(sc_fs_memory_terms_index_entry);
+  header.last_string_offset = last_string_offset;
+
+  // terms which strings offsets are all removed by remapping aren't written
+  sc_uint64 * string_offsets_counts = sc_mem_new(sc_uint64, (items_count + 1));
+  for (sc_uint64 i = 0; i < items_count; ++i)
+  {
+    _sc_fs_memory_terms_index_write_item_string_offsets(
+        null_ptr, &items[i], remap_string_offset, arguments, &string_offsets_counts[i]);
+    if (string_offsets_counts[i] != 0)
+      ++header.terms_count;
+  }
+
+  sc_fs_memory_terms_index_entry * entries = sc_mem_new(sc_fs_memory_terms_index_entry, (header.terms_count + 1));
+  for (sc_uint64 i = 0, j = 0; i < items_count; ++i)
+  {
+    if (string_offsets_counts[i] == 0)
+      continue;
+
+    sc_fs_memory_terms_index_entry * entry = &entries[j++];
+    entry->term_offset = header.terms_size;
+    entry->term_size = items[i].term_size;
+    entry->string_offsets_begin = header.string_offsets_count;
+    entry->string_offsets_count = string_offsets_counts[i];
+
+    header.terms_size += entry->term_size;
+    header.string_offsets_count += entry->string_offsets_count;
+  }
+
+  sc_bool result = _sc_fs_memory_terms_index_write_chars(channel, &header, sizeof(header))
+                   && _sc_fs_memory_terms_index_write_chars(
+                       channel, entries, header.terms_count * sizeof(sc_fs_memory_terms_index_entry));
+  sc_mem_free(entries);
+
+  sc_uint64 string_offsets_count;
+  for (sc_uint64 i = 0; result && i < items_count; ++i)
+  {
+    if (string_offsets_counts[i] != 0)
+      result = _sc_fs_memory_terms_index_write_item_string_offsets(
+          channel, &items[i], remap_string_offset, arguments, &string_offsets_count);
+  }
+
+  for (sc_uint64 i = 0; result && i < items_count; ++i)
+  {
+    if (string_offsets_counts[i] != 0)
+      result = _sc_fs_memory_terms_index_write_chars(channel, items[i].term, items[i].term_size);
+  }
+
+  sc_mem_free(string_offsets_counts);
+  return result;
+}
+
+sc_fs_memory_status sc_fs_memory_terms_index_write(
+    sc_char const * path,
+    sc_uint64 const last_string_offset,
+    sc_fs_memory_terms_index const * index,
+    sc_dictionary * terms_dictionary)
+{
+  return sc_fs_memory_terms_index_write_ext(path, last_string_offset, index, terms_dictionary, null_ptr, null_ptr);
+}
+
+sc_fs_memory_status sc_fs_memory_terms_index_write_ext(
+    sc_char const * path,
+    sc_uint64 const last_string_offset,
+    sc_fs_memory_terms_index const * index,
+    sc_dictionary * terms_dictionary,
+    sc_uint64 (*remap_string_offset)(sc_uint64 string_offset, void * arguments),
+    void * arguments)
+{
+  sc_char * tmp_path;
+  {
+    sc_str_concat(path, SC_FS_TERMS_INDEX_TMP_EXT, tmp_path);
+  }
+
+  sc_io_channel * channel = sc_io_new_write_channel(tmp_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_mem_free(tmp_path);
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_uint64 items_count;
+  sc_fs_memory_terms_index_item * items = _sc_fs_memory_terms_index_merge_items(index, terms_dictionary, &items_count);
+  sc_bool const is_written = _sc_fs_memory_terms_index_write_items(
+      channel, last_string_offset, items, items_count, remap_string_offset, arguments);
+  sc_mem_free(items);
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+
+  // mapped terms index keeps replaced file content
+  if (is_written == SC_FALSE || sc_fs_rename_file(tmp_path, path) == SC_FALSE)
+  {
+    sc_fs_remove_file(tmp_path);
+    sc_mem_free(tmp_path);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  sc_mem_free(tmp_path);
+  return SC_FS_MEMORY_OK;
+}
+
+sc_fs_memory_status sc_fs_memory_terms_index_set_last_string_offset(
+    sc_char const * path,
+    sc_uint64 const last_string_offset)
+{
+  sc_int32 const fd = open(path, O_WRONLY);
+  if (fd == -1)
+    return SC_FS_MEMORY_WRONG_PATH;
+
+  sc_bool const is_written =
+      pwrite(
+          fd,
+          &last_string_offset,
+          sizeof(last_string_offset),
+          offsetof(sc_fs_memory_terms_index_header, last_string_offset))
+      == sizeof(last_string_offset);
+  close(fd);
+  return is_written ? SC_FS_MEMORY_OK : SC_FS_MEMORY_WRITE_ERROR;
+}
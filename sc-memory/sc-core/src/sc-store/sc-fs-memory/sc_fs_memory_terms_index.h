@@ -0,0 +1,129 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_fs_memory_terms_index_h_
+#define _sc_fs_memory_terms_index_h_
+
+#include "sc-core/sc_types.h"
+#include "sc-core/sc-container/sc_dictionary.h"
+
+#include "sc_fs_memory_status.h"
+
+/*!
+ * Terms index is a file with terms sorted in byte order and strings offsets of every term. It is mapped into memory
+ * and queried in place, so it is not rebuilt term by term on sc-fs-memory load.
+ */
+typedef struct _sc_fs_memory_terms_index sc_fs_memory_terms_index;
+
+/*! Checks if file by specified path has terms index format.
+ * @param path A path to file.
+ * @returns SC_TRUE, if file starts with terms index header.
+ */
+sc_bool sc_fs_memory_terms_index_is_file(sc_char const * path);
+
+/*! Maps terms index file into memory. File content is validated, but terms aren't read.
+ * @param path A path to terms index file.
+ * @param[out] index A pointer to mapped terms index.
+ * @param[out] last_string_offset A pointer to last string offset saved with terms index.
+ * @returns SC_FS_MEMORY_OK, if terms index is mapped; SC_FS_MEMORY_WRONG_PATH, if file can't be opened;
+ * SC_FS_MEMORY_READ_ERROR, if file is not valid terms index.
+ */
+sc_fs_memory_status sc_fs_memory_terms_index_map(
+    sc_char const * path,
+    sc_fs_memory_terms_index ** index,
+    sc_uint64 * last_string_offset);
+
+/*! Unmaps terms index from memory and frees it.
+ * @param index A pointer to mapped terms index. It can be null_ptr.
+ */
+void sc_fs_memory_terms_index_unmap(sc_fs_memory_terms_index * index);
+
+/*! Gets count of terms in terms index.
+ * @param index A pointer to mapped terms index. It can be null_ptr.
+ * @returns Count of terms.
+ */
+sc_uint64 sc_fs_memory_terms_index_get_terms_count(sc_fs_memory_terms_index const * index);
+
+/*! Finds strings offsets of term in terms index by binary search.
+ * @param index A pointer to mapped terms index. It can be null_ptr.
+ * @param term A term to find.
+ * @param term_size A size of term.
+ * @param[out] string_offsets A pointer to strings offsets of term, they point into mapped memory.
+ * @param[out] string_offsets_count A pointer to count of strings offsets of term.
+ * @returns SC_TRUE, if term is found.
+ */
+sc_bool sc_fs_memory_terms_index_get_string_offsets(
+    sc_fs_memory_terms_index const * index,
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_uint64 const ** string_offsets,
+    sc_uint64 * string_offsets_count);
+
+/*! Visits terms with specified prefix in byte order.
+ * @param index A pointer to mapped terms index. It can be null_ptr.
+ * @param prefix A terms prefix. Empty prefix visits all terms.
+ * @param prefix_size A size of terms prefix.
+ * @param callable A callback that is called for every term with its strings offsets. Visit stops if it returns
+ * SC_FALSE.
+ * @param arguments Arguments passed into callable.
+ * @returns SC_FALSE, if callable stops visiting.
+ */
+sc_bool sc_fs_memory_terms_index_visit_by_prefix(
+    sc_fs_memory_terms_index const * index,
+    sc_char const * prefix,
+    sc_uint64 prefix_size,
+    sc_bool (*callable)(
+        sc_char const * term,
+        sc_uint64 term_size,
+        sc_uint64 const * string_offsets,
+        sc_uint64 string_offsets_count,
+        void ** arguments),
+    void ** arguments);
+
+/*! Writes terms index merged from mapped terms index and dictionary with new terms. Index is written to temporary
+ * file that replaces file by specified path, so mapped terms index stays valid.
+ * @param path A path to terms index file.
+ * @param last_string_offset A last string offset saved with terms index.
+ * @param index A pointer to mapped terms index. It can be null_ptr.
+ * @param terms_dictionary A pointer to dictionary with terms and lists of term with its strings offsets. It can be
+ * null_ptr.
+ * @returns SC_FS_MEMORY_OK, if terms index is written.
+ */
+sc_fs_memory_status sc_fs_memory_terms_index_write(
+    sc_char const * path,
+    sc_uint64 last_string_offset,
+    sc_fs_memory_terms_index const * index,
+    sc_dictionary * terms_dictionary);
+
+/*! Writes terms index merged from mapped terms index and dictionary with new terms, remapping all their strings
+ * offsets. Terms which strings offsets are all removed aren't written. Mapped terms index is read in place and isn't
+ * loaded into dictionary.
+ * @param path A path to terms index file.
+ * @param last_string_offset A last string offset saved with terms index.
+ * @param index A pointer to mapped terms index. It can be null_ptr.
+ * @param terms_dictionary A pointer to dictionary with terms and lists of term with its strings offsets. It can be
+ * null_ptr.
+ * @param remap_string_offset A callback that returns new string offset incremented by one, or 0 if string is removed.
+ * If it is null_ptr, strings offsets are written as they are.
+ * @param arguments Arguments passed into remap_string_offset.
+ * @returns SC_FS_MEMORY_OK, if terms index is written.
+ */
+sc_fs_memory_status sc_fs_memory_terms_index_write_ext(
+    sc_char const * path,
+    sc_uint64 last_string_offset,
+    sc_fs_memory_terms_index const * index,
+    sc_dictionary * terms_dictionary,
+    sc_uint64 (*remap_string_offset)(sc_uint64 string_offset, void * arguments),
+    void * arguments);
+
+/*! Updates last string offset saved in terms index file. It should be called before terms index file is mapped.
+ * @param path A path to terms index file.
+ * @param last_string_offset A last string offset to save.
+ * @returns SC_FS_MEMORY_OK, if last string offset is written.
+ */
+sc_fs_memory_status sc_fs_memory_terms_index_set_last_string_offset(sc_char const * path, sc_uint64 last_string_offset);
+
+#endif
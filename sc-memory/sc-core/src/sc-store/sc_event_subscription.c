@@ -239,6 +239,11 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
 }
 
 sc_result sc_event_notify_element_deleted(sc_addr element)
+{
+  return sc_event_notify_elements_deleted(&element, 1);
+}
+
+sc_result sc_event_notify_elements_deleted(sc_addr const * elements, sc_uint32 count)
 {
   sc_hash_table_list * element_events_list = null_ptr;
   sc_event_subscription * event_subscription = null_ptr;
@@ -251,18 +256,17 @@ sc_result sc_event_notify_element_deleted(sc_addr element)
     goto result;
 
   // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
-  // lookup for all registered to specified sc-element events
+  // lookup for all registered to specified sc-elements events
   sc_monitor_acquire_write(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
+  for (sc_uint32 i = 0; i < count; ++i)
   {
     element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(element));
-    if (element_events_list != null_ptr)
-      sc_hash_table_remove(subscription_manager->events_table, TABLE_KEY(element));
-  }
+        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(elements[i]));
+    if (element_events_list == null_ptr)
+      continue;
+
+    sc_hash_table_remove(subscription_manager->events_table, TABLE_KEY(elements[i]));
 
-  if (element_events_list != null_ptr)
-  {
     while (element_events_list != null_ptr)
     {
       event_subscription = (sc_event_subscription *)element_events_list->data;
@@ -368,6 +372,96 @@ result:
   return result;
 }
 
+sc_result sc_event_emit_n(
+    sc_memory_context const * ctx,
+    sc_event_emit_params const * params,
+    sc_uint32 count,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr)
+{
+  if (ctx == null_ptr || count == 0)
+    return SC_RESULT_NO;
+
+  if (_sc_memory_context_are_events_blocking(ctx))
+    return SC_RESULT_NO;
+
+  if (_sc_memory_context_are_events_pending(ctx))
+  {
+    for (sc_uint32 i = 0; i < count; ++i)
+      _sc_memory_context_pend_event(
+          ctx,
+          params[i].event_type_addr,
+          params[i].subscription_addr,
+          params[i].connector_addr,
+          params[i].connector_type,
+          params[i].other_addr);
+    return SC_RESULT_OK;
+  }
+
+  return sc_event_emit_n_impl(ctx, params, count, callback, event_addr);
+}
+
+sc_result sc_event_emit_n_impl(
+    sc_memory_context const * ctx,
+    sc_event_emit_params const * params,
+    sc_uint32 count,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr)
+{
+  sc_hash_table_list * element_events_list = null_ptr;
+  sc_hash_table_list * element_events = null_ptr;
+  sc_event_subscription * event_subscription = null_ptr;
+
+  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
+  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
+
+  // if table is empty, then do nothing
+  sc_result result = SC_RESULT_NO;
+  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
+    goto result;
+
+  // lookup for all registered to specified sc-elements events under one lock
+  sc_monitor_acquire_read(&subscription_manager->events_table_monitor);
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_event_emit_params const * event_params = &params[i];
+
+    // subscriptions of sc-element are looked up once for consecutive events of this sc-element
+    if (i == 0 || SC_ADDR_IS_NOT_EQUAL(params[i - 1].subscription_addr, event_params->subscription_addr))
+      element_events = (sc_hash_table_list *)sc_hash_table_get(
+          subscription_manager->events_table, TABLE_KEY(event_params->subscription_addr));
+
+    element_events_list = element_events;
+    while (element_events_list != null_ptr)
+    {
+      event_subscription = (sc_event_subscription *)element_events_list->data;
+
+      if (SC_ADDR_IS_EQUAL(event_subscription->event_type_addr, event_params->event_type_addr)
+          && ((event_subscription->event_element_type & event_params->connector_type)
+              == event_subscription->event_element_type))
+      {
+        _sc_event_emission_manager_add(
+            emission_manager,
+            event_subscription,
+            ctx->user_addr,
+            event_params->connector_addr,
+            event_params->connector_type,
+            event_params->other_addr,
+            callback,
+            event_addr);
+
+        result = SC_RESULT_OK;
+      }
+
+      element_events_list = element_events_list->next;
+    }
+  }
+  sc_monitor_release_read(&subscription_manager->events_table_monitor);
+
+result:
+  return result;
+}
+
 sc_bool sc_event_subscription_is_deletable(sc_event_subscription const * event_subscription)
 {
   return event_subscription->ref_count == SC_EVENT_REQUEST_DESTROY;
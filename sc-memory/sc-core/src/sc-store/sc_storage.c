@@ -9,6 +9,7 @@
 #include "sc-core/sc_event_subscription.h"
 
 #include "sc-core/sc_stream_memory.h"
+#include "sc-core/sc_stream_mapped_file.h"
 #include "sc-core/sc-base/sc_allocator.h"
 #include "sc-core/sc-container/sc_string.h"
 
@@ -35,6 +36,7 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   storage->last_not_engaged_segment_num = 0;
   storage->last_released_segment_num = 0;
   storage->segments = sc_mem_new(sc_segment *, params->max_loaded_segments);
+  storage->is_offline_build = params->offline_build;
   sc_monitor_init(&storage->segments_monitor);
   _sc_monitor_table_init(&storage->addr_monitors_table);
 
@@ -45,10 +47,13 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   sc_message("\tSc-segment elements count: %d", SC_SEGMENT_ELEMENTS_COUNT);
   sc_message("\tSc-storage size: %zd", sizeof(sc_storage));
   sc_message("\tMax segments count: %d", storage->max_segments_count);
+  sc_message("\tOffline build: %s", storage->is_offline_build ? "On" : "Off");
 
   storage->processes_segments_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
   sc_monitor_init(&storage->processes_monitor);
 
+  storage->system_identifier_index = sc_system_identifier_index_new();
+
   sc_result result = SC_TRUE;
   if (params->clear == SC_FALSE)
   {
@@ -117,6 +122,7 @@ error:
   sc_mem_free(storage->segments);
   sc_monitor_destroy(&storage->segments_monitor);
   _sc_monitor_table_destroy(&storage->addr_monitors_table);
+  sc_system_identifier_index_destroy(storage->system_identifier_index);
   sc_mem_free(storage);
   storage = null_ptr;
 
@@ -143,6 +149,11 @@ sc_event_subscription_manager * sc_storage_get_event_subscription_manager()
   return storage ? storage->events_subscription_manager : null_ptr;
 }
 
+sc_system_identifier_index * sc_storage_get_system_identifier_index()
+{
+  return storage ? storage->system_identifier_index : null_ptr;
+}
+
 sc_bool sc_storage_is_element(sc_memory_context const * ctx, sc_addr addr)
 {
   sc_element * el = null_ptr;
@@ -201,6 +212,8 @@ sc_result sc_storage_free_element(sc_addr addr)
     sc_monitor_release_write(&storage->segments_monitor);
   }
 
+  g_atomic_int_inc(&storage->erased_elements_count);
+
   result = SC_RESULT_OK;
 error:
   return result;
@@ -395,12 +408,26 @@ error:
   return element;
 }
 
+sc_element * _sc_storage_get_offline_build_element(sc_addr * addr)
+{
+  // sc-elements are laid out one by one, so sc-segments are filled in the same order as they are saved
+  sc_segment * segment = _sc_storage_get_last_free_segment();
+  if (segment == null_ptr)
+    segment = _sc_storage_get_new_segment();
+  if (segment == null_ptr)
+    return null_ptr;
+
+  sc_addr_offset const element_offset = ++segment->last_engaged_offset;
+  *addr = (sc_addr){segment->num, element_offset};
+  return &segment->elements[element_offset];
+}
+
 sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr)
 {
   *addr = SC_ADDR_EMPTY;
   sc_element * element = null_ptr;
 
-  element = _sc_storage_get_element(addr);
+  element = storage->is_offline_build ? _sc_storage_get_offline_build_element(addr) : _sc_storage_get_element(addr);
   if (element == null_ptr)
   {
     element = _sc_storage_get_released_element(addr);
@@ -460,7 +487,7 @@ end:
   sc_monitor_release_write(&storage->processes_monitor);
 }
 
-sc_result _sc_storage_element_erase(sc_addr addr)
+sc_result _sc_storage_element_detach(sc_addr addr)
 {
   sc_result result;
 
@@ -472,7 +499,7 @@ sc_result _sc_storage_element_erase(sc_addr addr)
   if (result != SC_RESULT_OK || (element->flags.states & SC_STATE_REQUEST_ERASURE) == SC_STATE_REQUEST_ERASURE)
   {
     sc_monitor_release_write(monitor);
-    return result;
+    return result == SC_RESULT_OK ? SC_RESULT_NO : result;
   }
 
   element->flags.states |= SC_STATE_REQUEST_ERASURE;
@@ -480,6 +507,9 @@ sc_result _sc_storage_element_erase(sc_addr addr)
 
   sc_monitor_release_write(monitor);
 
+  if (sc_type_has_subtype(type, sc_type_node_link) || sc_type_has_subtype_in_mask(type, sc_type_connector_mask))
+    sc_system_identifier_index_remove_element(storage->system_identifier_index, addr);
+
   if (sc_type_has_subtype(type, sc_type_node_link))
     sc_fs_memory_unlink_string(SC_ADDR_LOCAL_TO_INT(addr));
   else if (sc_type_has_subtype_in_mask(type, sc_type_connector_mask))
@@ -550,7 +580,7 @@ sc_result _sc_storage_element_erase(sc_addr addr)
         prev_in_arc_from_structure_monitor,
         next_in_arc_from_structure_monitor);
 #else
-    sc_monitor_acquire_write_n(3, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
+    sc_monitor_acquire_write_n(4, prev_out_arc_monitor, next_out_arc_monitor, prev_in_arc_monitor, next_in_arc_monitor);
 #endif
 
     if (SC_ADDR_IS_NOT_EMPTY(prev_out_connector_addr))
@@ -659,31 +689,105 @@ sc_result _sc_storage_element_erase(sc_addr addr)
     sc_monitor_release_write_n(2, beg_monitor, end_monitor);
   }
 
-  sc_monitor_acquire_write(monitor);
-  sc_storage_free_element(addr);
-  sc_monitor_release_write(monitor);
+  return SC_RESULT_OK;
+}
 
-  // erase registered events before deletion
-  sc_event_notify_element_deleted(addr);
+sc_int32 _sc_storage_compare_addrs(void const * a, void const * b)
+{
+  sc_addr_hash const a_hash = SC_ADDR_LOCAL_TO_INT(*(sc_addr const *)a);
+  sc_addr_hash const b_hash = SC_ADDR_LOCAL_TO_INT(*(sc_addr const *)b);
+  return (a_hash > b_hash) - (a_hash < b_hash);
+}
 
-  return result;
+void _sc_storage_free_elements(sc_addr * addrs, sc_uint32 count)
+{
+  // sort sc-elements by segments and offsets to lock every segment once
+  qsort(addrs, count, sizeof(sc_addr), _sc_storage_compare_addrs);
+
+  sc_uint32 i = 0;
+  while (i < count)
+  {
+    sc_addr_seg const segment_num = addrs[i].seg;
+    sc_uint32 segment_end = i;
+    while (segment_end < count && addrs[segment_end].seg == segment_num)
+      ++segment_end;
+
+    sc_monitor_acquire_read(&storage->segments_monitor);
+    sc_segment * segment = storage->segments[segment_num - 1];
+    sc_monitor_release_read(&storage->segments_monitor);
+    if (segment == null_ptr)
+    {
+      i = segment_end;
+      continue;
+    }
+
+    // sc-elements are made not existing under their monitors, but they are released only with segment lock
+    sc_uint32 j;
+    for (j = i; j < segment_end; ++j)
+    {
+      sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addrs[j]);
+      sc_monitor_acquire_write(monitor);
+      segment->elements[addrs[j].offset] = (sc_element){0};
+      sc_monitor_release_write(monitor);
+    }
+
+    sc_monitor_acquire_write(&segment->monitor);
+    sc_addr_offset const last_released_offset = segment->last_released_offset;
+    sc_addr_offset released_offset = last_released_offset;
+    for (j = i; j < segment_end; ++j)
+    {
+      segment->elements[addrs[j].offset] = (sc_element){(sc_element_flags){.type = released_offset}};
+      released_offset = addrs[j].offset;
+    }
+    segment->last_released_offset = released_offset;
+    sc_monitor_release_write(&segment->monitor);
+
+    if (last_released_offset == 0)
+    {
+      sc_monitor_acquire_write(&storage->segments_monitor);
+      segment->elements[0].flags.type = storage->last_released_segment_num;
+      storage->last_released_segment_num = segment->num;
+      sc_monitor_release_write(&storage->segments_monitor);
+    }
+
+    i = segment_end;
+  }
+
+  // erase registered events before deletion
+  sc_event_notify_elements_deleted(addrs, count);
 }
 
 sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
 {
-  sc_result result;
+  return sc_storage_elements_erase(ctx, &addr, 1);
+}
 
-  sc_element * el = null_ptr;
-  result = sc_storage_get_element_by_addr(addr, &el);
-  if (result != SC_RESULT_OK)
-    goto error;
+sc_result sc_storage_elements_erase(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  sc_result result = SC_RESULT_OK;
 
   sc_hash_table * cache_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
 
   sc_queue iter_queue;
   sc_queue_init(&iter_queue);
-  sc_pointer p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr));
-  sc_queue_push(&iter_queue, p_addr);
+  sc_pointer p_addr;
+
+  sc_element * el = null_ptr;
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (sc_storage_get_element_by_addr(addrs[i], &el) != SC_RESULT_OK)
+    {
+      result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+      continue;
+    }
+
+    p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addrs[i]));
+    if (sc_hash_table_get(cache_table, p_addr) != null_ptr)
+      continue;
+
+    sc_hash_table_insert(cache_table, p_addr, el);
+    sc_queue_push(&iter_queue, p_addr);
+  }
 
   sc_queue addrs_with_not_emitted_erase_events;
   sc_queue_init(&addrs_with_not_emitted_erase_events);
@@ -697,8 +801,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
 
     sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, element_addr);
     sc_monitor_acquire_read(monitor);
-    result = sc_storage_get_element_by_addr(element_addr, &el);
-    if (result != SC_RESULT_OK)
+    if (sc_storage_get_element_by_addr(element_addr, &el) != SC_RESULT_OK)
     {
       sc_monitor_release_read(monitor);
       continue;
@@ -708,95 +811,46 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
     sc_addr const begin_addr = el->arc.begin;
     sc_addr const end_addr = el->arc.end;
 
-    sc_result erase_incoming_connector_result = SC_RESULT_NO;
-    sc_result erase_outgoing_connector_result = SC_RESULT_NO;
-    sc_result erase_incoming_arc_result = SC_RESULT_NO;
-    sc_result erase_outgoing_arc_result = SC_RESULT_NO;
-    sc_result erase_element_result = SC_RESULT_NO;
+    sc_result erase_result = SC_RESULT_NO;
 
     if ((el->flags.states & SC_STATE_IS_ERASABLE) != SC_STATE_IS_ERASABLE)
     {
+      // all before erase events of sc-element are emitted as one batch
+      sc_event_emit_params params[5];
+      sc_uint32 params_count = 0;
+
       if ((type & sc_type_connector_mask) != 0)
       {
-        erase_incoming_connector_result = sc_event_emit(
-            ctx,
-            begin_addr,
-            sc_event_before_erase_connector_addr,
-            element_addr,
-            type,
-            end_addr,
-            sc_storage_element_erase,
-            element_addr);
-        erase_outgoing_connector_result = sc_event_emit(
-            ctx,
-            end_addr,
-            sc_event_before_erase_connector_addr,
-            element_addr,
-            type,
-            begin_addr,
-            sc_storage_element_erase,
-            element_addr);
+        params[params_count++] = (sc_event_emit_params){
+            begin_addr, sc_event_before_erase_connector_addr, element_addr, type, end_addr};
+        params[params_count++] = (sc_event_emit_params){
+            end_addr, sc_event_before_erase_connector_addr, element_addr, type, begin_addr};
       }
 
       if (sc_type_has_subtype(type, sc_type_common_edge))
       {
-        erase_incoming_arc_result = sc_event_emit(
-            ctx,
-            begin_addr,
-            sc_event_before_erase_edge_addr,
-            element_addr,
-            type,
-            end_addr,
-            sc_storage_element_erase,
-            element_addr);
-        erase_outgoing_arc_result = sc_event_emit(
-            ctx,
-            end_addr,
-            sc_event_before_erase_edge_addr,
-            element_addr,
-            type,
-            begin_addr,
-            sc_storage_element_erase,
-            element_addr);
+        params[params_count++] =
+            (sc_event_emit_params){begin_addr, sc_event_before_erase_edge_addr, element_addr, type, end_addr};
+        params[params_count++] =
+            (sc_event_emit_params){end_addr, sc_event_before_erase_edge_addr, element_addr, type, begin_addr};
       }
       else if (sc_type_has_subtype_in_mask(type, sc_type_arc_mask))
       {
-        erase_outgoing_arc_result = sc_event_emit(
-            ctx,
-            begin_addr,
-            sc_event_before_erase_outgoing_arc_addr,
-            element_addr,
-            type,
-            end_addr,
-            sc_storage_element_erase,
-            element_addr);
-        erase_incoming_arc_result = sc_event_emit(
-            ctx,
-            end_addr,
-            sc_event_before_erase_incoming_arc_addr,
-            element_addr,
-            type,
-            begin_addr,
-            sc_storage_element_erase,
-            element_addr);
+        params[params_count++] = (sc_event_emit_params){
+            begin_addr, sc_event_before_erase_outgoing_arc_addr, element_addr, type, end_addr};
+        params[params_count++] = (sc_event_emit_params){
+            end_addr, sc_event_before_erase_incoming_arc_addr, element_addr, type, begin_addr};
       }
 
-      erase_element_result = sc_event_emit(
-          ctx,
-          element_addr,
-          sc_event_before_erase_element_addr,
-          SC_ADDR_EMPTY,
-          0,
-          SC_ADDR_EMPTY,
-          sc_storage_element_erase,
-          element_addr);
+      params[params_count++] = (sc_event_emit_params){
+          element_addr, sc_event_before_erase_element_addr, SC_ADDR_EMPTY, 0, SC_ADDR_EMPTY};
+
+      erase_result = sc_event_emit_n(ctx, params, params_count, sc_storage_element_erase, element_addr);
 
       el->flags.states |= SC_STATE_IS_ERASABLE;
     }
 
-    if (erase_incoming_connector_result == SC_RESULT_OK || erase_outgoing_connector_result == SC_RESULT_OK
-        || erase_incoming_arc_result == SC_RESULT_OK || erase_outgoing_arc_result == SC_RESULT_OK
-        || erase_element_result == SC_RESULT_OK)
+    if (erase_result == SC_RESULT_OK)
     {
       sc_monitor_release_read(monitor);
       continue;
@@ -812,8 +866,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
       sc_element * connector = sc_hash_table_get(cache_table, p_addr);
       if (connector == null_ptr)
       {
-        result = sc_storage_get_element_by_addr(connector_addr, &connector);
-        if (result != SC_RESULT_OK)
+        if (sc_storage_get_element_by_addr(connector_addr, &connector) != SC_RESULT_OK)
           break;
 
         sc_hash_table_insert(cache_table, p_addr, connector);
@@ -831,8 +884,7 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
       sc_element * connector = sc_hash_table_get(cache_table, p_addr);
       if (connector == null_ptr)
       {
-        result = sc_storage_get_element_by_addr(connector_addr, &connector);
-        if (result != SC_RESULT_OK)
+        if (sc_storage_get_element_by_addr(connector_addr, &connector) != SC_RESULT_OK)
           break;
 
         sc_hash_table_insert(cache_table, p_addr, connector);
@@ -848,19 +900,24 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
   sc_queue_destroy(&iter_queue);
   sc_hash_table_destroy(cache_table);
 
+  // sc-elements detached by this call are freed in bulk, others are being erased concurrently
+  sc_addr * detached_addrs = sc_mem_new(sc_addr, (addrs_with_not_emitted_erase_events.size + 1));
+  sc_uint32 detached_addrs_count = 0;
   while (!sc_queue_empty(&addrs_with_not_emitted_erase_events))
   {
     sc_addr_hash addr_int = (sc_pointer_to_sc_addr_hash)sc_queue_pop(&addrs_with_not_emitted_erase_events);
+    sc_addr addr;
     addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT(addr_int);
     addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT(addr_int);
 
-    _sc_storage_element_erase(addr);
+    if (_sc_storage_element_detach(addr) == SC_RESULT_OK)
+      detached_addrs[detached_addrs_count++] = addr;
   }
-
   sc_queue_destroy(&addrs_with_not_emitted_erase_events);
 
-  result = SC_RESULT_OK;
-error:
+  _sc_storage_free_elements(detached_addrs, detached_addrs_count);
+  sc_mem_free(detached_addrs);
+
   return result;
 }
 
@@ -937,11 +994,11 @@ void _sc_storage_make_elements_incident_to_arc(
   sc_monitor * first_out_arc_monitor = null_ptr;
   sc_monitor * first_in_arc_monitor = null_ptr;
 
-  if (SC_ADDR_IS_NOT_EQUAL(first_out_connector_addr, beg_addr)
+  if (storage->is_offline_build == SC_FALSE && SC_ADDR_IS_NOT_EQUAL(first_out_connector_addr, beg_addr)
       && SC_ADDR_IS_NOT_EQUAL(first_out_connector_addr, end_addr))
     first_out_arc_monitor =
         sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_out_connector_addr);
-  if (SC_ADDR_IS_NOT_EQUAL(first_in_connector_addr, beg_addr)
+  if (storage->is_offline_build == SC_FALSE && SC_ADDR_IS_NOT_EQUAL(first_in_connector_addr, beg_addr)
       && SC_ADDR_IS_NOT_EQUAL(first_in_connector_addr, end_addr))
     first_in_arc_monitor =
         sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_in_connector_addr);
@@ -994,7 +1051,7 @@ void _sc_storage_update_structure_arcs(
   sc_addr first_in_accessed_connector_addr = end_el->first_in_arc_from_structure;
   sc_monitor * first_in_accessed_arc_monitor = null_ptr;
 
-  if (SC_ADDR_IS_NOT_EQUAL(first_in_accessed_connector_addr, beg_addr)
+  if (storage->is_offline_build == SC_FALSE && SC_ADDR_IS_NOT_EQUAL(first_in_accessed_connector_addr, beg_addr)
       && SC_ADDR_IS_NOT_EQUAL(first_in_accessed_connector_addr, end_addr))
     first_in_accessed_arc_monitor =
         sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_in_accessed_connector_addr);
@@ -1059,8 +1116,13 @@ sc_addr sc_storage_arc_new_ext(
   sc_bool is_not_loop = SC_ADDR_IS_NOT_EQUAL(beg_addr, end_addr);
 
   // try to lock begin and end elements
-  sc_monitor * beg_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, beg_addr);
-  sc_monitor * end_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, end_addr);
+  sc_monitor * beg_monitor = null_ptr;
+  sc_monitor * end_monitor = null_ptr;
+  if (storage->is_offline_build == SC_FALSE)
+  {
+    beg_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, beg_addr);
+    end_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, end_addr);
+  }
   sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
 
   *result = sc_storage_get_element_by_addr(beg_addr, &beg_el);
@@ -1081,7 +1143,10 @@ sc_addr sc_storage_arc_new_ext(
     _sc_storage_update_structure_arcs(connector_addr, arc_el, beg_addr, end_addr, end_el);
 #endif
 
-  // emit events
+  // emit events, if sc-memory binaries aren't built offline
+  if (storage->is_offline_build)
+    goto end;
+
   if (is_edge && is_not_loop)
   {
     sc_event_emit(
@@ -1116,6 +1181,7 @@ sc_addr sc_storage_arc_new_ext(
   sc_event_emit(
       ctx, beg_addr, sc_event_after_generate_connector_addr, connector_addr, type, end_addr, null_ptr, SC_ADDR_EMPTY);
 
+end:
   sc_monitor_release_write_n(2, beg_monitor, end_monitor);
 
   *result = SC_RESULT_OK;
@@ -1388,18 +1454,38 @@ sc_result sc_storage_set_link_content(
 
   sc_element * el = null_ptr;
 
+  // contents of mapped files are stored as paths to these files
+  sc_char const * file_path = sc_stream_mapped_file_get_path(stream);
+
   sc_char * string = null_ptr;
+  sc_char const * string_view = null_ptr;
   sc_uint32 string_size = 0;
-  if (sc_stream_get_data(stream, &string, &string_size) == SC_FALSE)
+  if (file_path != null_ptr)
   {
-    sc_mem_free(string);
-    return SC_RESULT_ERROR_STREAM_IO;
+    string_view = file_path;
+    string_size = sc_str_len(file_path);
   }
+  // not searchable contents needn't be null-terminated, so streams over memory are read without copying
+  else if (is_searchable_string || sc_stream_get_view(stream, &string_view, &string_size) != SC_RESULT_OK)
+  {
+    if (sc_stream_get_data(stream, &string, &string_size) == SC_FALSE)
+    {
+      sc_mem_free(string);
+      return SC_RESULT_ERROR_STREAM_IO;
+    }
 
-  if (string == null_ptr)
+    string_view = string;
+  }
+
+  if (string_view == null_ptr)
+  {
     sc_string_empty(string);
+    string_view = string;
+  }
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor * monitor = storage->is_offline_build
+                              ? null_ptr
+                              : sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
   sc_monitor_acquire_write(monitor);
 
   result = sc_storage_get_element_by_addr(addr, &el);
@@ -1412,15 +1498,22 @@ sc_result sc_storage_set_link_content(
     goto error;
   }
 
-  if (sc_fs_memory_link_string_ext(SC_ADDR_LOCAL_TO_INT(addr), string, string_size, is_searchable_string)
-      != SC_FS_MEMORY_OK)
+  sc_fs_memory_status const fs_memory_status =
+      file_path != null_ptr
+          ? sc_fs_memory_link_file_path(SC_ADDR_LOCAL_TO_INT(addr), string_view, string_size)
+          : sc_fs_memory_link_string_ext(SC_ADDR_LOCAL_TO_INT(addr), string_view, string_size, is_searchable_string);
+  if (fs_memory_status != SC_FS_MEMORY_OK)
   {
     result = SC_RESULT_ERROR_FILE_MEMORY_IO;
     goto error;
   }
 
-  sc_event_emit(
-      ctx, addr, sc_event_before_change_link_content_addr, SC_ADDR_EMPTY, 0, SC_ADDR_EMPTY, null_ptr, SC_ADDR_EMPTY);
+  // sc-link may be system identifier of some sc-element, and it isn't more
+  sc_system_identifier_index_remove_element(storage->system_identifier_index, addr);
+
+  if (storage->is_offline_build == SC_FALSE)
+    sc_event_emit(
+        ctx, addr, sc_event_before_change_link_content_addr, SC_ADDR_EMPTY, 0, SC_ADDR_EMPTY, null_ptr, SC_ADDR_EMPTY);
 
   sc_monitor_release_write(monitor);
   sc_mem_free(string);
@@ -1441,6 +1534,7 @@ sc_result sc_storage_get_link_content(sc_memory_context const * ctx, sc_addr add
   sc_element * el = null_ptr;
   sc_char * string = null_ptr;
   sc_uint32 string_size = 0;
+  sc_bool is_file_path = SC_FALSE;
 
   sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
   sc_monitor_acquire_read(monitor);
@@ -1456,7 +1550,7 @@ sc_result sc_storage_get_link_content(sc_memory_context const * ctx, sc_addr add
   }
 
   sc_fs_memory_status const fs_memory_status =
-      sc_fs_memory_get_string_by_link_hash(SC_ADDR_LOCAL_TO_INT(addr), &string, &string_size);
+      sc_fs_memory_get_string_by_link_hash_ext(SC_ADDR_LOCAL_TO_INT(addr), &string, &string_size, &is_file_path);
   if (fs_memory_status != SC_FS_MEMORY_OK && fs_memory_status != SC_FS_MEMORY_NO_STRING)
   {
     result = SC_RESULT_ERROR_FILE_MEMORY_IO;
@@ -1465,6 +1559,14 @@ sc_result sc_storage_get_link_content(sc_memory_context const * ctx, sc_addr add
 
   sc_monitor_release_read(monitor);
 
+  // file contents are mapped into memory instead of reading them
+  if (is_file_path)
+  {
+    *stream = sc_stream_mapped_file_new(string);
+    sc_mem_free(string);
+    return *stream == null_ptr ? SC_RESULT_ERROR_STREAM_IO : SC_RESULT_OK;
+  }
+
   if (string == null_ptr)
     sc_string_empty(string);
 
@@ -1543,6 +1645,21 @@ error:
   return result;
 }
 
+sc_result sc_storage_find_links_by_content_range(
+    sc_memory_context const * ctx,
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr))
+{
+  sc_fs_memory_status const fs_memory_status =
+      sc_fs_memory_get_link_hashes_by_number_range(min_value, max_value, data, callback);
+  if (fs_memory_status != SC_FS_MEMORY_OK && fs_memory_status != SC_FS_MEMORY_NO_STRING)
+    return SC_RESULT_ERROR_FILE_MEMORY_IO;
+
+  return SC_RESULT_OK;
+}
+
 sc_result sc_storage_find_links_contents_by_content_substring(
     sc_memory_context const * ctx,
     sc_stream const * stream,
@@ -1573,6 +1690,14 @@ error:
   return result;
 }
 
+sc_uint32 sc_storage_get_erased_elements_count()
+{
+  if (storage == null_ptr)
+    return 0;
+
+  return (sc_uint32)g_atomic_int_get(&storage->erased_elements_count);
+}
+
 sc_result sc_storage_get_elements_stat(sc_stat * stat)
 {
   sc_mem_set(stat, 0, sizeof(sc_stat));
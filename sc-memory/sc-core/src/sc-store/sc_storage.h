@@ -114,6 +114,27 @@ void sc_storage_end_new_process();
  */
 sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr);
 
+/*!
+ * @brief Erases sc-elements and all connected sc-elements from the sc-memory.
+ *
+ * This function works like `sc_storage_element_erase` called for every specified sc-element, but it computes
+ * the closure of sc-elements to erase once, emits before erase events of every sc-element as one batch and
+ * frees detached sc-elements grouped by segments, so every segment is locked once.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs An array of sc-addresses of sc-elements to be erased.
+ * @param count A count of sc-addresses in array.
+ *
+ * @return Returns SC_RESULT_OK if the operation executed successfully.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Some of specified sc-addrs are not valid. Other sc-elements are erased.
+ */
+sc_result sc_storage_elements_erase(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count);
+
 /*!
  * @brief Generates a new sc-node with the specified type.
  *
@@ -588,6 +609,33 @@ sc_result sc_storage_find_links_by_content_substring(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*!
+ * @brief Finds sc-links with numeric contents in the specified range.
+ *
+ * This function searches for sc-links with contents that are numbers from the closed
+ * range [min_value; max_value]. Sc-links are found in ordered numeric index and passed
+ * into callback in order of their values.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param min_value The minimal value of the range.
+ * @param max_value The maximal value of the range.
+ * @param data Pointer to user-specific data.
+ * @param callback Callback function to be invoked for each matching sc-link sc-address found.
+ *
+ * @return Returns an sc_result indicating the success or failure of the operation.
+ * Possible result values:
+ * @retval SC_RESULT_OK: The operation was successful.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO: An error occurred during file memory I/O.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_find_links_by_content_range(
+    sc_memory_context const * ctx,
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr));
+
 /*!
  * @brief Finds sc-link contents containing the specified substring.
  *
@@ -636,6 +684,17 @@ sc_result sc_storage_find_links_contents_by_content_substring(
  */
 sc_result sc_storage_get_elements_stat(sc_stat * stat);
 
+/*!
+ * @brief Retrieves count of sc-elements erased from sc-storage since it has been initialized.
+ *
+ * The count is only increased (and wraps around on overflow), so sc-elements found before still exist if the count
+ * hasn't changed since they have been found.
+ *
+ * @return Returns count of erased sc-elements.
+ * @note This function is thread-safe.
+ */
+sc_uint32 sc_storage_get_erased_elements_count();
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
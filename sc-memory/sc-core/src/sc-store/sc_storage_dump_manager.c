@@ -13,6 +13,8 @@
 #include "sc_storage.h"
 #include "sc_memory_private.h"
 
+#include "sc-fs-memory/sc_fs_memory.h"
+
 typedef void (*sc_timed_callback)();
 typedef pthread_t sc_timer;
 
@@ -28,6 +30,7 @@ struct _sc_storage_dump_manager
 {
   sc_dump_info dump_memory_info;
   sc_dump_info dump_memory_statistics_info;
+  sc_dump_info compact_strings_info;
 };
 
 void * _sc_timer_check_periodic(void * arg)
@@ -84,6 +87,12 @@ void _sc_storage_dump_statistics_timer()
   sc_message("Total: %" PRIu64, allElements);
 }
 
+void _sc_storage_compact_strings_timer()
+{
+  sc_memory_info("Compact sc-memory strings by period");
+  sc_fs_memory_compact();
+}
+
 void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_memory_params const * params)
 {
   *manager = sc_mem_new(sc_storage_dump_manager, 1);
@@ -95,6 +104,10 @@ void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_m
       .dump = params->dump_memory_statistics,
       .dump_period = params->dump_memory_statistics_period,
       .timed_dump_callback = _sc_storage_dump_statistics_timer};
+  (*manager)->compact_strings_info = (sc_dump_info){
+      .dump = params->compact_strings,
+      .dump_period = params->compact_strings_period,
+      .timed_dump_callback = _sc_storage_compact_strings_timer};
 
   sc_memory_info("Initialize dump manager");
   sc_memory_info("Sc-memory dump manager configuration");
@@ -102,6 +115,8 @@ void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_m
   sc_message("\tDump memory period: %d seconds", (*manager)->dump_memory_info.dump_period);
   sc_message("\tDump memory statistics: %s", params->dump_memory_statistics ? "On" : "Off");
   sc_message("\tDump memory statistics period: %d seconds", params->dump_memory_statistics_period);
+  sc_message("\tCompact strings: %s", params->compact_strings ? "On" : "Off");
+  sc_message("\tCompact strings period: %d seconds", params->compact_strings_period);
 
   if ((*manager)->dump_memory_info.dump == SC_TRUE)
   {
@@ -115,6 +130,13 @@ void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_m
     (*manager)->dump_memory_statistics_info.dump_timer =
         _sc_storage_dump_manager_create_timer(&(*manager)->dump_memory_statistics_info);
   }
+
+  if ((*manager)->compact_strings_info.dump == SC_TRUE)
+  {
+    sc_memory_info("Set timer for sc-memory strings compactions");
+    (*manager)->compact_strings_info.dump_timer =
+        _sc_storage_dump_manager_create_timer(&(*manager)->compact_strings_info);
+  }
 }
 
 void sc_storage_dump_manager_shutdown(sc_storage_dump_manager * manager)
@@ -132,5 +154,12 @@ void sc_storage_dump_manager_shutdown(sc_storage_dump_manager * manager)
     sc_memory_info("Unset timer for sc-memory statistics dumps");
     _sc_storage_dump_manager_delete_timer(manager->dump_memory_statistics_info.dump_timer);
   }
+
+  if (manager->compact_strings_info.dump == SC_TRUE)
+  {
+    manager->compact_strings_info.dump = SC_FALSE;
+    sc_memory_info("Unset timer for sc-memory strings compactions");
+    _sc_storage_dump_manager_delete_timer(manager->compact_strings_info.dump_timer);
+  }
   sc_mem_free(manager);
 }
@@ -12,6 +12,7 @@
 #include "sc-store/sc-event/sc_event_private.h"
 
 #include "sc-store/sc_storage_dump_manager.h"
+#include "sc-store/sc_system_identifier_index.h"
 
 #include "sc-store/sc-base/sc_monitor_table_private.h"
 
@@ -29,6 +30,9 @@ struct _sc_storage
   sc_storage_dump_manager * dump_manager;
   sc_event_emission_manager * events_emission_manager;
   sc_event_subscription_manager * events_subscription_manager;
+  sc_system_identifier_index * system_identifier_index;
+  sc_bool is_offline_build;
+  sc_int32 erased_elements_count;
 };
 
 struct _sc_storage * sc_storage_get();
@@ -37,6 +41,8 @@ sc_event_emission_manager * sc_storage_get_event_emission_manager();
 
 sc_event_subscription_manager * sc_storage_get_event_subscription_manager();
 
+sc_system_identifier_index * sc_storage_get_system_identifier_index();
+
 sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr);
 
 sc_result sc_storage_get_element_by_addr(sc_addr addr, sc_element ** el);
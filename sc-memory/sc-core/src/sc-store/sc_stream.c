@@ -154,3 +154,16 @@ sc_bool sc_stream_get_data(sc_stream const * stream, sc_char ** data, sc_uint32
 
   return SC_TRUE;
 }
+
+sc_result sc_stream_get_view(sc_stream const * stream, sc_char const ** data, sc_uint32 * size)
+{
+  sc_assert(stream != null_ptr);
+
+  if (sc_stream_check_flag(stream, SC_STREAM_FLAG_READ) == SC_FALSE)
+    return SC_RESULT_ERROR;
+
+  if (stream->view_func == null_ptr)
+    return SC_RESULT_ERROR;
+
+  return stream->view_func(stream, data, size);
+}
@@ -0,0 +1,183 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-core/sc_stream_mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_string.h"
+
+#include "sc-store/sc-base/sc_assert_utils.h"
+#include "sc-store/sc-base/sc_message.h"
+
+#include "sc_stream_private.h"
+
+struct _sc_mapped_file
+{
+  sc_char * path;  // path to mapped file
+  sc_char * data;  // pointer to mapped file data
+  sc_uint32 size;  // size of mapped file data
+  sc_uint32 pos;   // current position
+};
+
+typedef struct _sc_mapped_file sc_mapped_file;
+
+sc_result sc_stream_mapped_file_read(sc_stream const * stream, sc_char * data, sc_uint32 length, sc_uint32 * bytes_read)
+{
+  sc_assert(stream != null_ptr);
+  sc_mapped_file * file = (sc_mapped_file *)stream->handler;
+
+  if (length > (file->size - file->pos))
+    *bytes_read = file->size - file->pos;
+  else
+    *bytes_read = length;
+
+  sc_mem_cpy(data, &(file->data[file->pos]), *bytes_read);
+  file->pos += *bytes_read;
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_mapped_file_seek(sc_stream const * stream, sc_stream_seek_origin origin, sc_uint32 offset)
+{
+  sc_assert(stream != null_ptr);
+  sc_mapped_file * file = (sc_mapped_file *)stream->handler;
+
+  switch (origin)
+  {
+  case SC_STREAM_SEEK_END:
+    if (offset > file->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    file->pos = file->size - offset;
+    break;
+
+  case SC_STREAM_SEEK_CUR:
+    if (offset > (file->size - file->pos))
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    file->pos += offset;
+    break;
+
+  case SC_STREAM_SEEK_SET:
+    if (offset > file->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    file->pos = offset;
+    break;
+  };
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_mapped_file_tell(sc_stream const * stream, sc_uint32 * position)
+{
+  sc_assert(stream != null_ptr);
+  sc_mapped_file * file = (sc_mapped_file *)stream->handler;
+
+  *position = file->pos;
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_mapped_file_view(sc_stream const * stream, sc_char const ** data, sc_uint32 * size)
+{
+  sc_assert(stream != null_ptr);
+  sc_mapped_file * file = (sc_mapped_file *)stream->handler;
+
+  *data = file->data;
+  *size = file->size;
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_mapped_file_free_handler(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_mapped_file * file = (sc_mapped_file *)stream->handler;
+
+  sc_result result = SC_RESULT_OK;
+  if (file->data != null_ptr && munmap(file->data, file->size) != 0)
+    result = SC_RESULT_ERROR;
+
+  sc_mem_free(file->path);
+  sc_mem_free(file);
+
+  return result;
+}
+
+sc_bool sc_stream_mapped_file_eof(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_mapped_file * file = (sc_mapped_file *)stream->handler;
+
+  if (file->pos == file->size)
+    return SC_TRUE;
+
+  return SC_FALSE;
+}
+
+sc_stream * sc_stream_mapped_file_new(sc_char const * file_name)
+{
+  if (file_name == null_ptr)
+    return null_ptr;
+
+  sc_int32 const fd = open(file_name, O_RDONLY);
+  if (fd == -1)
+    return null_ptr;
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || S_ISREG(file_stat.st_mode) == 0 || (sc_uint64)file_stat.st_size > SC_MAXUINT32)
+  {
+    close(fd);
+    return null_ptr;
+  }
+
+  sc_char * data = null_ptr;
+  // empty files can't be mapped
+  if (file_stat.st_size != 0)
+  {
+    data = mmap(null_ptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      sc_message("File `%s` can't be mapped into memory", file_name);
+      close(fd);
+      return null_ptr;
+    }
+  }
+  // mapping stays valid after file descriptor is closed
+  close(fd);
+
+  sc_mapped_file * file = sc_mem_new(sc_mapped_file, 1);
+  sc_str_cpy(file->path, file_name, sc_str_len(file_name));
+  file->data = data;
+  file->size = (sc_uint32)file_stat.st_size;
+  file->pos = 0;
+
+  sc_stream * stream = sc_mem_new(sc_stream, 1);
+
+  stream->flags = SC_STREAM_FLAG_READ | SC_STREAM_FLAG_SEEK | SC_STREAM_FLAG_TELL;
+  stream->handler = file;
+
+  stream->eof_func = &sc_stream_mapped_file_eof;
+  stream->free_func = &sc_stream_mapped_file_free_handler;
+  stream->read_func = &sc_stream_mapped_file_read;
+  stream->seek_func = &sc_stream_mapped_file_seek;
+  stream->tell_func = &sc_stream_mapped_file_tell;
+  stream->view_func = &sc_stream_mapped_file_view;
+  stream->write_func = null_ptr;  // doesn't support writing
+
+  return stream;
+}
+
+sc_char const * sc_stream_mapped_file_get_path(sc_stream const * stream)
+{
+  if (stream == null_ptr || stream->free_func != &sc_stream_mapped_file_free_handler)
+    return null_ptr;
+
+  return ((sc_mapped_file *)stream->handler)->path;
+}
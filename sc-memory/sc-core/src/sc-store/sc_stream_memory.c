@@ -110,6 +110,17 @@ sc_bool sc_stream_memory_eof(sc_stream const * stream)
   return SC_FALSE;
 }
 
+sc_result sc_stream_memory_view(sc_stream const * stream, sc_char const ** data, sc_uint32 * size)
+{
+  sc_assert(stream != null_ptr);
+  sc_memory_buffer * buffer = (sc_memory_buffer *)stream->handler;
+
+  *data = buffer->data;
+  *size = buffer->size;
+
+  return SC_RESULT_OK;
+}
+
 sc_stream * sc_stream_memory_new(sc_char const * buffer, sc_uint buffer_size, sc_uint8 flags, sc_bool data_owner)
 {
   sc_assert(buffer != null_ptr);
@@ -138,6 +149,7 @@ sc_stream * sc_stream_memory_new(sc_char const * buffer, sc_uint buffer_size, sc
   stream->read_func = &sc_stream_memory_read;
   stream->seek_func = &sc_stream_memory_seek;
   stream->tell_func = &sc_stream_memory_tell;
+  stream->view_func = &sc_stream_memory_view;
   stream->write_func = null_ptr;  // doesn't support writing
 
   return stream;
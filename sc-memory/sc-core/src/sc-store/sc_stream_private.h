@@ -32,6 +32,10 @@ typedef sc_result (*fStreamTell)(sc_stream const * stream, sc_uint32 * position)
  */
 typedef sc_bool (*fStreamEof)(sc_stream const * stream);
 
+/*! Pointer to stream view function. This function returns pointer to all stream \i data without copying it.
+ */
+typedef sc_result (*fStreamView)(sc_stream const * stream, sc_char const ** data, sc_uint32 * size);
+
 /*! Pointer to stream handler free function. This function destroys stream handler.
  */
 typedef sc_result (*fStreamFreeHandler)(sc_stream const * stream);
@@ -56,6 +60,8 @@ struct _sc_stream
   fStreamFreeHandler free_func;
   //! Pointer to function to check if stream indicates to the end position
   fStreamEof eof_func;
+  //! Pointer to function that returns stream data without copying (optional)
+  fStreamView view_func;
 };
 
 #endif
@@ -0,0 +1,369 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_system_identifier_index.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_string.h"
+
+#include "sc-store/sc-base/sc_monitor_private.h"
+#include "sc-store/sc-base/sc_mutex_private.h"
+#include "sc-store/sc-container/sc_hash_table.h"
+
+#include "sc-fs-memory/sc_file_system.h"
+#include "sc-fs-memory/sc_io.h"
+
+#define SC_SYSTEM_IDENTIFIER_INDEX_MAGIC "SCIDTFX"
+#define SC_SYSTEM_IDENTIFIER_INDEX_MAGIC_SIZE 8
+#define SC_SYSTEM_IDENTIFIER_INDEX_VERSION 1
+#define SC_SYSTEM_IDENTIFIER_INDEX_TMP_EXT ".tmp"
+#define SC_SYSTEM_IDENTIFIER_INDEX_KEY_BUFFER_SIZE 256
+
+// file starts with header, then every entry is written as its fiver, size of system identifier and its characters
+typedef struct
+{
+  sc_char magic[SC_SYSTEM_IDENTIFIER_INDEX_MAGIC_SIZE];
+  sc_uint32 version;
+  sc_uint32 fiver_size;
+  sc_uint64 entries_count;
+} sc_system_identifier_index_header;
+
+typedef struct
+{
+  sc_system_identifier_fiver fiver;
+  sc_char * idtf;
+  sc_uint32 idtf_size;
+} sc_system_identifier_index_entry;
+
+struct _sc_system_identifier_index
+{
+  sc_hash_table * idtfs_entries;     // system identifiers and their entries
+  sc_hash_table * elements_entries;  // hashes of sc-connectors and sc-links of fivers and their entries
+  sc_monitor monitor;
+  sc_mutex setting_mutex;  // excludes concurrent checks of system identifiers before they are set
+};
+
+void _sc_system_identifier_index_entry_free(sc_pointer data)
+{
+  sc_system_identifier_index_entry * entry = data;
+  sc_mem_free(entry->idtf);
+  sc_mem_free(entry);
+}
+
+sc_system_identifier_index * sc_system_identifier_index_new()
+{
+  sc_system_identifier_index * index = sc_mem_new(sc_system_identifier_index, 1);
+  index->idtfs_entries = sc_hash_table_init(g_str_hash, g_str_equal, null_ptr, _sc_system_identifier_index_entry_free);
+  index->elements_entries = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  sc_monitor_init(&index->monitor);
+  sc_mutex_init(&index->setting_mutex);
+  return index;
+}
+
+void sc_system_identifier_index_destroy(sc_system_identifier_index * index)
+{
+  if (index == null_ptr)
+    return;
+
+  sc_hash_table_destroy(index->elements_entries);
+  sc_hash_table_destroy(index->idtfs_entries);
+  sc_monitor_destroy(&index->monitor);
+  sc_mutex_destroy(&index->setting_mutex);
+  sc_mem_free(index);
+}
+
+void _sc_system_identifier_index_add_element(
+    sc_system_identifier_index * index,
+    sc_addr addr,
+    sc_system_identifier_index_entry * entry)
+{
+  if (SC_ADDR_IS_EMPTY(addr))
+    return;
+
+  sc_hash_table_insert(index->elements_entries, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr)), entry);
+}
+
+void _sc_system_identifier_index_remove_entry(
+    sc_system_identifier_index * index,
+    sc_system_identifier_index_entry * entry)
+{
+  sc_hash_table_remove(index->elements_entries, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(entry->fiver.addr2)));
+  sc_hash_table_remove(index->elements_entries, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(entry->fiver.addr3)));
+  sc_hash_table_remove(index->elements_entries, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(entry->fiver.addr4)));
+  sc_hash_table_remove(index->idtfs_entries, entry->idtf);
+}
+
+// entry owns its system identifier, it is freed with entry
+void _sc_system_identifier_index_insert_entry(
+    sc_system_identifier_index * index,
+    sc_system_identifier_index_entry * entry)
+{
+  sc_system_identifier_index_entry * old_entry = sc_hash_table_get(index->idtfs_entries, entry->idtf);
+  if (old_entry != null_ptr)
+    _sc_system_identifier_index_remove_entry(index, old_entry);
+
+  sc_hash_table_insert(index->idtfs_entries, entry->idtf, entry);
+  _sc_system_identifier_index_add_element(index, entry->fiver.addr2, entry);
+  _sc_system_identifier_index_add_element(index, entry->fiver.addr3, entry);
+  _sc_system_identifier_index_add_element(index, entry->fiver.addr4, entry);
+}
+
+// hash table keys are null-terminated strings, so system identifier is copied if it is not null-terminated
+sc_char * _sc_system_identifier_index_make_key(
+    sc_char buffer[SC_SYSTEM_IDENTIFIER_INDEX_KEY_BUFFER_SIZE],
+    sc_char const * idtf,
+    sc_uint32 idtf_size)
+{
+  sc_char * key = buffer;
+  if (idtf_size >= SC_SYSTEM_IDENTIFIER_INDEX_KEY_BUFFER_SIZE)
+    key = sc_mem_new(sc_char, idtf_size + 1);
+  sc_mem_cpy(key, idtf, idtf_size);
+  key[idtf_size] = '\0';
+  return key;
+}
+
+sc_bool sc_system_identifier_index_get(
+    sc_system_identifier_index * index,
+    sc_char const * idtf,
+    sc_uint32 idtf_size,
+    sc_system_identifier_fiver * fiver)
+{
+  if (index == null_ptr || idtf == null_ptr)
+    return SC_FALSE;
+
+  sc_char buffer[SC_SYSTEM_IDENTIFIER_INDEX_KEY_BUFFER_SIZE];
+  sc_char * key = _sc_system_identifier_index_make_key(buffer, idtf, idtf_size);
+
+  sc_monitor_acquire_read(&index->monitor);
+  sc_system_identifier_index_entry const * entry = sc_hash_table_get(index->idtfs_entries, key);
+  if (entry != null_ptr)
+    *fiver = entry->fiver;
+  sc_monitor_release_read(&index->monitor);
+
+  if (key != buffer)
+    sc_mem_free(key);
+
+  return entry != null_ptr;
+}
+
+void sc_system_identifier_index_add(
+    sc_system_identifier_index * index,
+    sc_char const * idtf,
+    sc_uint32 idtf_size,
+    sc_system_identifier_fiver const * fiver)
+{
+  if (index == null_ptr || idtf == null_ptr)
+    return;
+
+  sc_system_identifier_index_entry * entry = sc_mem_new(sc_system_identifier_index_entry, 1);
+  entry->fiver = *fiver;
+  entry->idtf_size = idtf_size;
+  sc_str_cpy(entry->idtf, idtf, idtf_size);
+
+  sc_monitor_acquire_write(&index->monitor);
+  _sc_system_identifier_index_insert_entry(index, entry);
+  sc_monitor_release_write(&index->monitor);
+}
+
+void sc_system_identifier_index_remove(
+    sc_system_identifier_index * index,
+    sc_char const * idtf,
+    sc_uint32 idtf_size,
+    sc_system_identifier_fiver const * fiver)
+{
+  if (index == null_ptr || idtf == null_ptr)
+    return;
+
+  sc_char buffer[SC_SYSTEM_IDENTIFIER_INDEX_KEY_BUFFER_SIZE];
+  sc_char * key = _sc_system_identifier_index_make_key(buffer, idtf, idtf_size);
+
+  // fiver of system identifier may be replaced by other thread after it is checked, then it is kept
+  sc_monitor_acquire_write(&index->monitor);
+  sc_system_identifier_index_entry * entry = sc_hash_table_get(index->idtfs_entries, key);
+  if (entry != null_ptr && SC_ADDR_IS_EQUAL(entry->fiver.addr1, fiver->addr1)
+      && SC_ADDR_IS_EQUAL(entry->fiver.addr2, fiver->addr2) && SC_ADDR_IS_EQUAL(entry->fiver.addr3, fiver->addr3)
+      && SC_ADDR_IS_EQUAL(entry->fiver.addr4, fiver->addr4) && SC_ADDR_IS_EQUAL(entry->fiver.addr5, fiver->addr5))
+    _sc_system_identifier_index_remove_entry(index, entry);
+  sc_monitor_release_write(&index->monitor);
+
+  if (key != buffer)
+    sc_mem_free(key);
+}
+
+void sc_system_identifier_index_remove_element(sc_system_identifier_index * index, sc_addr addr)
+{
+  if (index == null_ptr)
+    return;
+
+  sc_pointer const key = GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr));
+
+  // most of erased sc-elements are not in fivers, so they are checked without write lock
+  sc_monitor_acquire_read(&index->monitor);
+  sc_bool const is_indexed = sc_hash_table_get(index->elements_entries, key) != null_ptr;
+  sc_monitor_release_read(&index->monitor);
+  if (is_indexed == SC_FALSE)
+    return;
+
+  sc_monitor_acquire_write(&index->monitor);
+  sc_system_identifier_index_entry * entry = sc_hash_table_get(index->elements_entries, key);
+  if (entry != null_ptr)
+    _sc_system_identifier_index_remove_entry(index, entry);
+  sc_monitor_release_write(&index->monitor);
+}
+
+void sc_system_identifier_index_lock_setting(sc_system_identifier_index * index)
+{
+  if (index == null_ptr)
+    return;
+
+  sc_mutex_lock(&index->setting_mutex);
+}
+
+void sc_system_identifier_index_unlock_setting(sc_system_identifier_index * index)
+{
+  if (index == null_ptr)
+    return;
+
+  sc_mutex_unlock(&index->setting_mutex);
+}
+
+sc_uint64 sc_system_identifier_index_get_size(sc_system_identifier_index * index)
+{
+  if (index == null_ptr)
+    return 0;
+
+  sc_monitor_acquire_read(&index->monitor);
+  sc_uint64 const size = sc_hash_table_size(index->idtfs_entries);
+  sc_monitor_release_read(&index->monitor);
+  return size;
+}
+
+sc_bool _sc_system_identifier_index_read_chars(sc_io_channel * channel, void * chars, sc_uint64 const size)
+{
+  sc_uint64 read_bytes = 0;
+  return size == 0
+         || (sc_io_channel_read_chars(channel, chars, size, &read_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+             && read_bytes == size);
+}
+
+sc_bool _sc_system_identifier_index_write_chars(sc_io_channel * channel, void const * chars, sc_uint64 const size)
+{
+  sc_uint64 written_bytes = 0;
+  return size == 0
+         || (sc_io_channel_write_chars(channel, chars, size, &written_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+             && written_bytes == size);
+}
+
+sc_fs_memory_status sc_system_identifier_index_read(sc_char const * path, sc_system_identifier_index * index)
+{
+  if (sc_fs_is_file(path) == SC_FALSE)
+    return SC_FS_MEMORY_WRONG_PATH;
+
+  sc_io_channel * channel = sc_io_new_read_channel(path, null_ptr);
+  if (channel == null_ptr)
+    return SC_FS_MEMORY_WRONG_PATH;
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_system_identifier_index_header header;
+  if (_sc_system_identifier_index_read_chars(channel, &header, sizeof(header)) == SC_FALSE
+      || !sc_str_n_cmp(header.magic, SC_SYSTEM_IDENTIFIER_INDEX_MAGIC, SC_SYSTEM_IDENTIFIER_INDEX_MAGIC_SIZE)
+      || header.version != SC_SYSTEM_IDENTIFIER_INDEX_VERSION
+      || header.fiver_size != sizeof(sc_system_identifier_fiver))
+    goto error;
+
+  // entries are read into new tables, so index isn't changed if file is broken
+  sc_system_identifier_index * read_index = sc_system_identifier_index_new();
+  for (sc_uint64 i = 0; i < header.entries_count; ++i)
+  {
+    sc_system_identifier_index_entry * entry = sc_mem_new(sc_system_identifier_index_entry, 1);
+    if (_sc_system_identifier_index_read_chars(channel, &entry->fiver, sizeof(entry->fiver)) == SC_FALSE
+        || _sc_system_identifier_index_read_chars(channel, &entry->idtf_size, sizeof(entry->idtf_size)) == SC_FALSE)
+    {
+      sc_mem_free(entry);
+      sc_system_identifier_index_destroy(read_index);
+      goto error;
+    }
+
+    entry->idtf = sc_mem_new(sc_char, entry->idtf_size + 1);
+    if (_sc_system_identifier_index_read_chars(channel, entry->idtf, entry->idtf_size) == SC_FALSE)
+    {
+      _sc_system_identifier_index_entry_free(entry);
+      sc_system_identifier_index_destroy(read_index);
+      goto error;
+    }
+
+    _sc_system_identifier_index_insert_entry(read_index, entry);
+  }
+  sc_io_channel_shutdown(channel, SC_FALSE, null_ptr);
+
+  sc_monitor_acquire_write(&index->monitor);
+  sc_hash_table * idtfs_entries = index->idtfs_entries;
+  sc_hash_table * elements_entries = index->elements_entries;
+  index->idtfs_entries = read_index->idtfs_entries;
+  index->elements_entries = read_index->elements_entries;
+  read_index->idtfs_entries = idtfs_entries;
+  read_index->elements_entries = elements_entries;
+  sc_monitor_release_write(&index->monitor);
+
+  sc_system_identifier_index_destroy(read_index);
+  return SC_FS_MEMORY_OK;
+
+error:
+  sc_io_channel_shutdown(channel, SC_FALSE, null_ptr);
+  return SC_FS_MEMORY_READ_ERROR;
+}
+
+sc_fs_memory_status sc_system_identifier_index_write(sc_char const * path, sc_system_identifier_index * index)
+{
+  sc_char * tmp_path;
+  {
+    sc_str_concat(path, SC_SYSTEM_IDENTIFIER_INDEX_TMP_EXT, tmp_path);
+  }
+
+  sc_io_channel * channel = sc_io_new_write_channel(tmp_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_mem_free(tmp_path);
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_monitor_acquire_read(&index->monitor);
+
+  sc_system_identifier_index_header header;
+  sc_mem_set(&header, 0, sizeof(header));
+  sc_mem_cpy(header.magic, SC_SYSTEM_IDENTIFIER_INDEX_MAGIC, SC_SYSTEM_IDENTIFIER_INDEX_MAGIC_SIZE);
+  header.version = SC_SYSTEM_IDENTIFIER_INDEX_VERSION;
+  header.fiver_size = sizeof(sc_system_identifier_fiver);
+  header.entries_count = sc_hash_table_size(index->idtfs_entries);
+
+  sc_bool is_written = _sc_system_identifier_index_write_chars(channel, &header, sizeof(header));
+
+  sc_hash_table_iterator iterator;
+  sc_pointer key;
+  sc_pointer value;
+  sc_hash_table_iterator_init(&iterator, index->idtfs_entries);
+  while (is_written && sc_hash_table_iterator_next(&iterator, &key, &value))
+  {
+    sc_system_identifier_index_entry const * entry = value;
+    is_written = _sc_system_identifier_index_write_chars(channel, &entry->fiver, sizeof(entry->fiver))
+                 && _sc_system_identifier_index_write_chars(channel, &entry->idtf_size, sizeof(entry->idtf_size))
+                 && _sc_system_identifier_index_write_chars(channel, entry->idtf, entry->idtf_size);
+  }
+
+  sc_monitor_release_read(&index->monitor);
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+
+  if (is_written == SC_FALSE || sc_fs_rename_file(tmp_path, path) == SC_FALSE)
+  {
+    sc_fs_remove_file(tmp_path);
+    sc_mem_free(tmp_path);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  sc_mem_free(tmp_path);
+  return SC_FS_MEMORY_OK;
+}
@@ -0,0 +1,107 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_system_identifier_index_h_
+#define _sc_system_identifier_index_h_
+
+#include "sc-core/sc_types.h"
+#include "sc-core/sc_helper.h"
+
+#include "sc-fs-memory/sc_fs_memory_status.h"
+
+/*!
+ * System identifier index maps system identifiers to their fivers, so sc-element is found by system identifier with one
+ * hash table probe. Fivers are also indexed by their sc-connectors and sc-link, so entry is removed when any of them
+ * is erased or sc-link content is changed.
+ */
+typedef struct _sc_system_identifier_index sc_system_identifier_index;
+
+/*! Creates empty system identifier index.
+ * @returns A pointer to created system identifier index.
+ */
+sc_system_identifier_index * sc_system_identifier_index_new();
+
+/*! Frees system identifier index.
+ * @param index A pointer to system identifier index. It can be null_ptr.
+ */
+void sc_system_identifier_index_destroy(sc_system_identifier_index * index);
+
+/*! Finds fiver of system identifier.
+ * @param index A pointer to system identifier index.
+ * @param idtf A system identifier. It needn't be null-terminated.
+ * @param idtf_size A size of system identifier.
+ * @param[out] fiver A pointer to found fiver.
+ * @returns SC_TRUE, if system identifier is indexed.
+ */
+sc_bool sc_system_identifier_index_get(
+    sc_system_identifier_index * index,
+    sc_char const * idtf,
+    sc_uint32 idtf_size,
+    sc_system_identifier_fiver * fiver);
+
+/*! Indexes fiver of system identifier. Previous fiver of this system identifier is replaced.
+ * @param index A pointer to system identifier index.
+ * @param idtf A system identifier. It needn't be null-terminated.
+ * @param idtf_size A size of system identifier.
+ * @param fiver A pointer to fiver of system identifier.
+ */
+void sc_system_identifier_index_add(
+    sc_system_identifier_index * index,
+    sc_char const * idtf,
+    sc_uint32 idtf_size,
+    sc_system_identifier_fiver const * fiver);
+
+/*! Removes fiver of system identifier from index, if it isn't replaced by other fiver.
+ * @param index A pointer to system identifier index.
+ * @param idtf A system identifier. It needn't be null-terminated.
+ * @param idtf_size A size of system identifier.
+ * @param fiver A pointer to fiver of system identifier that is found invalid.
+ */
+void sc_system_identifier_index_remove(
+    sc_system_identifier_index * index,
+    sc_char const * idtf,
+    sc_uint32 idtf_size,
+    sc_system_identifier_fiver const * fiver);
+
+/*! Removes fiver that contains specified sc-connector or sc-link from index.
+ * @param index A pointer to system identifier index.
+ * @param addr A sc-address of erased sc-connector or sc-link, or sc-link which content is changed.
+ */
+void sc_system_identifier_index_remove_element(sc_system_identifier_index * index, sc_addr addr);
+
+/*! Locks setting of system identifiers, so system identifier is checked to be unused and set to sc-element by one
+ * thread at a time. Indexed fivers are still got, added and removed concurrently.
+ * @param index A pointer to system identifier index.
+ */
+void sc_system_identifier_index_lock_setting(sc_system_identifier_index * index);
+
+/*! Unlocks setting of system identifiers locked by sc_system_identifier_index_lock_setting.
+ * @param index A pointer to system identifier index.
+ */
+void sc_system_identifier_index_unlock_setting(sc_system_identifier_index * index);
+
+/*! Gets count of indexed system identifiers.
+ * @param index A pointer to system identifier index.
+ * @returns Count of indexed system identifiers.
+ */
+sc_uint64 sc_system_identifier_index_get_size(sc_system_identifier_index * index);
+
+/*! Reads system identifier index from file, indexed entries are replaced.
+ * @param path A path to system identifier index file.
+ * @param index A pointer to system identifier index.
+ * @returns SC_FS_MEMORY_OK, if index is read; SC_FS_MEMORY_WRONG_PATH, if file is absent; otherwise
+ * SC_FS_MEMORY_READ_ERROR.
+ */
+sc_fs_memory_status sc_system_identifier_index_read(sc_char const * path, sc_system_identifier_index * index);
+
+/*! Writes system identifier index to file atomically.
+ * @param path A path to system identifier index file.
+ * @param index A pointer to system identifier index.
+ * @returns SC_FS_MEMORY_OK, if index is written; otherwise SC_FS_MEMORY_WRITE_ERROR or SC_FS_MEMORY_WRONG_PATH.
+ */
+sc_fs_memory_status sc_system_identifier_index_write(sc_char const * path, sc_system_identifier_index * index);
+
+#endif
@@ -14,8 +14,13 @@
 #include "sc-core/sc-container/sc_string.h"
 
 #include "sc-store/sc-base/sc_message.h"
+#include "sc-store/sc_storage.h"
+#include "sc-store/sc_storage_private.h"
 
 #include "sc_memory_private.h"
+#include "sc_memory_context_manager.h"
+#include "sc_memory_context_private.h"
+#include "sc_memory_context_permissions.h"
 
 sc_char ** keynodes_str = null_ptr;
 sc_addr * sc_keynodes = null_ptr;
@@ -199,6 +204,35 @@ sc_result sc_helper_find_element_by_system_identifier(
   return result;
 }
 
+//! Checks that fiver still connects sc-element with sc-link which content is system identifier
+sc_bool _sc_helper_is_system_identifier_fiver_valid(
+    sc_memory_context const * ctx,
+    sc_char const * data,
+    sc_uint32 len,
+    sc_system_identifier_fiver const * fiver)
+{
+  sc_addr begin_addr;
+  sc_addr end_addr;
+  if (sc_storage_get_arc_info(ctx, fiver->addr2, &begin_addr, &end_addr) != SC_RESULT_OK
+      || SC_ADDR_IS_NOT_EQUAL(begin_addr, fiver->addr1) || SC_ADDR_IS_NOT_EQUAL(end_addr, fiver->addr3))
+    return SC_FALSE;
+
+  if (sc_storage_get_arc_info(ctx, fiver->addr4, &begin_addr, &end_addr) != SC_RESULT_OK
+      || SC_ADDR_IS_NOT_EQUAL(begin_addr, fiver->addr5) || SC_ADDR_IS_NOT_EQUAL(end_addr, fiver->addr2))
+    return SC_FALSE;
+
+  sc_stream * stream;
+  if (sc_storage_get_link_content(ctx, fiver->addr3, &stream) != SC_RESULT_OK)
+    return SC_FALSE;
+
+  sc_char const * content;
+  sc_uint32 content_size;
+  sc_bool const is_valid = sc_stream_get_view(stream, &content, &content_size) == SC_RESULT_OK
+                           && content_size == len && sc_str_n_cmp(content, data, len);
+  sc_stream_free(stream);
+  return is_valid;
+}
+
 sc_result sc_helper_find_element_by_system_identifier_ext(
     sc_memory_context const * ctx,
     sc_char const * data,
@@ -212,6 +246,22 @@ sc_result sc_helper_find_element_by_system_identifier_ext(
   if (result != SC_RESULT_OK)
     goto error;
 
+  // indexed fivers are removed when their sc-elements are erased, but index loaded from repo or filled by lookup
+  // concurrent with erasing may keep fiver which sc-elements are erased or reused, so it is checked
+  sc_system_identifier_index * index = sc_storage_get_system_identifier_index();
+  if (sc_system_identifier_index_get(index, data, len, out_fiver))
+  {
+    if (_sc_helper_is_system_identifier_fiver_valid(ctx, data, len, out_fiver) == SC_FALSE)
+      sc_system_identifier_index_remove(index, data, len, out_fiver);
+    else if (
+        _sc_memory_context_check_local_and_global_permissions(
+            sc_memory_get_context_manager(), ctx, SC_CONTEXT_PERMISSIONS_READ, out_fiver->addr3)
+        == SC_TRUE)
+      return SC_RESULT_OK;
+
+    sc_system_identifier_fiver_make_empty(out_fiver);
+  }
+
   sc_list * found_links;
   stream = sc_stream_memory_new(data, sizeof(sc_char) * len, SC_STREAM_FLAG_READ, SC_FALSE);
 
@@ -247,6 +297,10 @@ sc_result sc_helper_find_element_by_system_identifier_ext(
           sc_iterator5_value(it, 2),
           sc_iterator5_value(it, 3),
           sc_iterator5_value(it, 4)};
+      // sc-elements of fiver may be erased before it is indexed, then it is removed from index after indexing
+      sc_system_identifier_index_add(index, data, len, out_fiver);
+      if (_sc_helper_is_system_identifier_fiver_valid(ctx, data, len, out_fiver) == SC_FALSE)
+        sc_system_identifier_index_remove(index, data, len, out_fiver);
 
       sc_iterator5_free(it);
       sc_iterator_destroy(links_it);
@@ -272,7 +326,8 @@ sc_result sc_helper_set_system_identifier(sc_memory_context * ctx, sc_addr addr,
   return sc_helper_set_system_identifier_ext(ctx, addr, data, len, null_ptr);
 }
 
-sc_result sc_helper_set_system_identifier_ext(
+//! Sets system identifier if it is unused, setting of system identifiers must be locked in system identifier index
+sc_result _sc_helper_set_unused_system_identifier(
     sc_memory_context * ctx,
     sc_addr addr,
     sc_char const * data,
@@ -325,14 +380,32 @@ sc_result sc_helper_set_system_identifier_ext(
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_system_identifier_fiver const fiver = {
+      addr, arc_addr, idtf_addr, arc_to_arc_addr, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]};
+  sc_system_identifier_index_add(sc_storage_get_system_identifier_index(), data, len, &fiver);
+
   if (out_fiver != null_ptr)
-    *out_fiver = (sc_system_identifier_fiver){
-        addr, arc_addr, idtf_addr, arc_to_arc_addr, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]};
+    *out_fiver = fiver;
 
 error:
   return result;
 }
 
+sc_result sc_helper_set_system_identifier_ext(
+    sc_memory_context * ctx,
+    sc_addr addr,
+    sc_char const * data,
+    sc_uint32 len,
+    sc_system_identifier_fiver * out_fiver)
+{
+  // system identifier set by other thread after it is checked to be unused would be duplicated
+  sc_system_identifier_index * index = sc_storage_get_system_identifier_index();
+  sc_system_identifier_index_lock_setting(index);
+  sc_result const result = _sc_helper_set_unused_system_identifier(ctx, addr, data, len, out_fiver);
+  sc_system_identifier_index_unlock_setting(index);
+  return result;
+}
+
 sc_result sc_helper_get_system_identifier_link(sc_memory_context const * ctx, sc_addr el, sc_addr * sys_idtf_addr)
 {
   *sys_idtf_addr = SC_ADDR_EMPTY;
@@ -387,8 +460,19 @@ sc_bool sc_helper_resolve_system_identifier_ext(
     return SC_TRUE;
   }
 
-  *result_addr = sc_memory_node_new(ctx, type);
-  result = sc_helper_set_system_identifier_ext(ctx, *result_addr, system_idtf, string_size, fiver);
+  // sc-element is found again after setting is locked, so threads resolving the same system identifier concurrently
+  // get one sc-element
+  sc_system_identifier_index * index = sc_storage_get_system_identifier_index();
+  sc_system_identifier_index_lock_setting(index);
+  result = sc_helper_find_element_by_system_identifier_ext(ctx, system_idtf, string_size, fiver);
+  if (result == SC_RESULT_OK)
+    *result_addr = fiver->addr1;
+  else if (result == SC_RESULT_NO)
+  {
+    *result_addr = sc_memory_node_new(ctx, type);
+    result = _sc_helper_set_unused_system_identifier(ctx, *result_addr, system_idtf, string_size, fiver);
+  }
+  sc_system_identifier_index_unlock_setting(index);
   if (result != SC_RESULT_OK)
     goto error;
 
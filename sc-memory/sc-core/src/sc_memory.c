@@ -16,6 +16,7 @@
 #include "sc_memory_ext.h"
 #include "sc_memory_context_manager.h"
 #include "sc_memory_context_permissions.h"
+#include "sc-store/sc-base/sc_profiler.h"
 
 #include "sc-core/sc_types.h"
 #include "sc-core/sc-base/sc_allocator.h"
@@ -32,6 +33,10 @@ sc_memory_context * s_memory_default_ctx = null_ptr;
 
 sc_memory_context * sc_memory_initialize(sc_memory_params const * params, sc_memory_context ** context)
 {
+  sc_profiler_initialize(params->profile_trace_file);
+  sc_profiler_phase * startup_phase = sc_profiler_phase_begin("Startup");
+  sc_profiler_phase * phase;
+
   sc_memory_info("Initialize");
 
   sc_char * string = sc_version_string_new(&params->version);
@@ -43,7 +48,19 @@ sc_memory_context * sc_memory_initialize(sc_memory_params const * params, sc_mem
   sc_message("\tLog file: %s", params->log_file);
   sc_message("\tLog level: %s", params->log_level);
 
-  if (sc_storage_initialize(params) != SC_RESULT_OK)
+  // sc-elements are laid out without synchronization during offline build, but agents of extensions can be run in
+  // other threads
+  if (params->offline_build == SC_TRUE && params->extensions != null_ptr)
+  {
+    s_memory_default_ctx = null_ptr;
+    sc_memory_error("Offline build can't be used with extensions");
+    goto error;
+  }
+
+  phase = sc_profiler_phase_begin("Storage initialization");
+  sc_result const storage_result = sc_storage_initialize(params);
+  sc_profiler_phase_end(phase);
+  if (storage_result != SC_RESULT_OK)
   {
     s_memory_default_ctx = null_ptr;
     sc_memory_error("Error while initialize sc-storage");
@@ -54,7 +71,9 @@ sc_memory_context * sc_memory_initialize(sc_memory_params const * params, sc_mem
 
   sc_storage_start_new_process();
 
+  phase = sc_profiler_phase_begin("Context manager initialization");
   _sc_memory_context_manager_initialize(&memory->context_manager, params->user_mode);
+  sc_profiler_phase_end(phase);
 
   if (sc_helper_init(s_memory_default_ctx) != SC_RESULT_OK)
   {
@@ -62,17 +81,23 @@ sc_memory_context * sc_memory_initialize(sc_memory_params const * params, sc_mem
     goto error;
   }
 
+  phase = sc_profiler_phase_begin("Keynodes initialization");
   sc_addr init_memory_generated_structure_addr = SC_ADDR_EMPTY;
   if (params->init_memory_generated_upload)
     sc_helper_resolve_system_identifier(
         s_memory_default_ctx, params->init_memory_generated_structure, &init_memory_generated_structure_addr);
 
-  if (sc_keynodes_initialize(s_memory_default_ctx, init_memory_generated_structure_addr) != SC_RESULT_OK)
+  sc_result const keynodes_result =
+      sc_keynodes_initialize(s_memory_default_ctx, init_memory_generated_structure_addr);
+  sc_profiler_phase_end(phase);
+  if (keynodes_result != SC_RESULT_OK)
     goto error;
 
+  phase = sc_profiler_phase_begin("Users permissions handling");
   _sc_memory_context_assign_context_for_system(memory->context_manager, &memory->myself_addr);
   _sc_memory_context_manager_register_user_events(memory->context_manager);
   _sc_memory_context_handle_all_user_permissions(memory->context_manager);
+  sc_profiler_phase_end(phase);
 
   *context = s_memory_default_ctx;
 
@@ -81,8 +106,11 @@ sc_memory_context * sc_memory_initialize(sc_memory_params const * params, sc_mem
   sc_message("\tInit memory generated structure: %s", params->init_memory_generated_structure);
   sc_message("\tExtensions path: %s", params->extensions);
 
-  if (sc_memory_init_ext(params->extensions, params->enabled_exts, init_memory_generated_structure_addr)
-      != SC_RESULT_OK)
+  phase = sc_profiler_phase_begin("Extensions initialization");
+  sc_result const extensions_result =
+      sc_memory_init_ext(params->extensions, params->enabled_exts, init_memory_generated_structure_addr);
+  sc_profiler_phase_end(phase);
+  if (extensions_result != SC_RESULT_OK)
   {
     sc_memory_error("Error while initialize extensions");
     goto error;
@@ -90,11 +118,18 @@ sc_memory_context * sc_memory_initialize(sc_memory_params const * params, sc_mem
 
   sc_storage_end_new_process();
   sc_memory_info("Successfully initialized");
+  sc_profiler_phase_end(startup_phase);
+  sc_profiler_report("Startup profile");
+  // phases of sc-memory saves aren't recorded until shutdown
+  sc_profiler_pause();
   return s_memory_default_ctx;
 
 error:
   sc_storage_end_new_process();
   sc_memory_info("Initialized with errors");
+  sc_profiler_phase_end(startup_phase);
+  sc_profiler_report("Startup profile");
+  sc_profiler_pause();
   return null_ptr;
 }
 
@@ -127,22 +162,38 @@ sc_result sc_memory_init_ext(
 
 sc_result sc_memory_shutdown(sc_bool save_state)
 {
+  sc_profiler_resume();
+  sc_profiler_phase * shutdown_phase = sc_profiler_phase_begin("Shutdown");
+  sc_profiler_phase * phase;
+  sc_result result = SC_RESULT_OK;
+
   sc_memory_info("Shutdown");
 
   if (memory == null_ptr)
     goto error;
 
+  phase = sc_profiler_phase_begin("Extensions shutdown");
   sc_memory_shutdown_ext();
+  sc_profiler_phase_end(phase);
   sc_helper_shutdown();
 
   _sc_memory_context_manager_unregister_user_events(memory->context_manager);
 
 error:
-  if (sc_storage_shutdown(save_state) != SC_RESULT_OK)
-    return SC_RESULT_ERROR;
+  phase = sc_profiler_phase_begin("Storage shutdown");
+  sc_result const storage_result = sc_storage_shutdown(save_state);
+  sc_profiler_phase_end(phase);
+  if (storage_result != SC_RESULT_OK)
+  {
+    result = SC_RESULT_ERROR;
+    goto end;
+  }
 
   if (memory == null_ptr)
-    return SC_RESULT_ERROR;
+  {
+    result = SC_RESULT_ERROR;
+    goto end;
+  }
 
   _sc_memory_context_manager_shutdown(memory->context_manager);
   memory->context_manager = null_ptr;
@@ -152,7 +203,11 @@ error:
 
   sc_memory_info("Shutdown");
 
-  return SC_RESULT_OK;
+end:
+  sc_profiler_phase_end(shutdown_phase);
+  sc_profiler_report("Shutdown profile");
+  sc_profiler_shutdown();
+  return result;
 }
 
 void sc_memory_shutdown_ext()
@@ -298,6 +353,27 @@ sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr)
   return sc_storage_element_erase(ctx, addr);
 }
 
+sc_result sc_memory_elements_free(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (_sc_memory_context_check_local_and_global_permissions(
+            memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_ERASE, addrs[i])
+        == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS;
+
+    if (_sc_memory_context_check_global_permissions_to_erase_permissions(
+            memory->context_manager, ctx, addrs[i], SC_CONTEXT_PERMISSIONS_TO_ERASE_PERMISSIONS)
+        == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_ERASE_PERMISSIONS;
+  }
+
+  return sc_storage_elements_erase(ctx, addrs, count);
+}
+
 sc_addr sc_memory_node_new(sc_memory_context const * ctx, sc_type type)
 {
   sc_result result;
@@ -573,6 +649,29 @@ sc_result sc_memory_find_links_by_content_substring_ext(
   return sc_storage_find_links_by_content_substring(ctx, stream, max_length_to_search_as_prefix, data, callback);
 }
 
+sc_result sc_memory_find_links_by_content_range(
+    sc_memory_context const * ctx,
+    sc_double min_value,
+    sc_double max_value,
+    sc_list ** result_hashes)
+{
+  sc_list_init(result_hashes);
+  return sc_memory_find_links_by_content_range_ext(ctx, min_value, max_value, *result_hashes, _push_link_hash);
+}
+
+sc_result sc_memory_find_links_by_content_range_ext(
+    sc_memory_context const * ctx,
+    sc_double min_value,
+    sc_double max_value,
+    void * data,
+    void (*callback)(void * data, sc_addr const link_addr))
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  return sc_storage_find_links_by_content_range(ctx, min_value, max_value, data, callback);
+}
+
 void _test_push_link_content(void * data, sc_addr const link_addr, sc_char const * link_content)
 {
   sc_unused(link_addr);
@@ -625,6 +724,11 @@ sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat)
   return sc_storage_get_elements_stat(stat);
 }
 
+sc_uint32 sc_memory_get_erased_elements_count()
+{
+  return sc_storage_get_erased_elements_count();
+}
+
 sc_result sc_memory_save(sc_memory_context const * ctx)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
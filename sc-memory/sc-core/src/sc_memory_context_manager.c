@@ -17,17 +17,8 @@
 #include "sc-store/sc_storage_private.h"
 #include "sc_memory_private.h"
 
-/*! Structure representing parameters for emitting a sc-event.
- * @note This structure holds the parameters required for emitting a sc-event in a memory context.
- */
-struct _sc_event_emit_params
-{
-  sc_addr subscription_addr;      ///< sc-address representing the subscription associated with the event.
-  sc_event_type event_type_addr;  ///< Type of the event to be emitted.
-  sc_addr connector_addr;         ///< sc-address representing the connector associated with the event.
-  sc_type connector_type;         ///< sc-type of the connector associated with the event.
-  sc_addr other_addr;             ///< sc-address representing the other element associated with the event.
-};
+#define SC_CONTEXT_PEND_EVENTS_INITIAL_CAPACITY 64
+#define SC_CONTEXT_PEND_EVENTS_EMIT_BATCH_SIZE 1024
 
 #define SC_CONTEXT_FLAG_PENDING_EVENTS 0x1
 #define SC_CONTEXT_FLAG_BLOCKING_EVENTS 0x2
@@ -39,9 +30,13 @@ void _sc_memory_context_manager_initialize(sc_memory_context_manager ** manager,
   sc_memory_info("Initialize context manager");
 
   *manager = sc_mem_new(sc_memory_context_manager, 1);
-  (*manager)->context_hash_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  for (sc_uint32 i = 0; i < SC_CONTEXT_TABLE_SHARDS_COUNT; ++i)
+  {
+    sc_memory_context_table_shard * shard = &(*manager)->context_table_shards[i];
+    shard->contexts = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+    sc_monitor_init(&shard->monitor);
+  }
   (*manager)->context_count = 0;
-  sc_monitor_init(&(*manager)->context_monitor);
   (*manager)->user_mode = user_mode;
   (*manager)->user_global_permissions = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
   sc_monitor_init(&(*manager)->user_global_permissions_monitor);
@@ -82,21 +77,31 @@ void _sc_memory_context_manager_shutdown(sc_memory_context_manager * manager)
   sc_memory_context_free(s_memory_default_ctx);
   s_memory_default_ctx = null_ptr;
 
-  if (manager->context_hash_table == null_ptr)
+  if (manager->context_table_shards[0].contexts == null_ptr)
     return;
 
-  sc_monitor_acquire_read(&manager->context_monitor);
-  sc_uint32 context_count = sc_hash_table_size(manager->context_hash_table);
-  sc_monitor_release_read(&manager->context_monitor);
+  sc_uint32 context_count = 0;
+  sc_uint32 i;
+  for (i = 0; i < SC_CONTEXT_TABLE_SHARDS_COUNT; ++i)
+  {
+    sc_memory_context_table_shard * shard = &manager->context_table_shards[i];
+    sc_monitor_acquire_read(&shard->monitor);
+    context_count += sc_hash_table_size(shard->contexts);
+    sc_monitor_release_read(&shard->monitor);
+  }
   if (context_count > 0)
     sc_memory_warning("There are %d contexts, wasn't destroyed before sc-memory shutdown", context_count);
 
-  sc_monitor_acquire_write(&manager->context_monitor);
-  sc_hash_table_destroy(manager->context_hash_table);
-  manager->context_hash_table = null_ptr;
-  sc_monitor_release_write(&manager->context_monitor);
+  for (i = 0; i < SC_CONTEXT_TABLE_SHARDS_COUNT; ++i)
+  {
+    sc_memory_context_table_shard * shard = &manager->context_table_shards[i];
+    sc_monitor_acquire_write(&shard->monitor);
+    sc_hash_table_destroy(shard->contexts);
+    shard->contexts = null_ptr;
+    sc_monitor_release_write(&shard->monitor);
 
-  sc_monitor_destroy(&manager->context_monitor);
+    sc_monitor_destroy(&shard->monitor);
+  }
 
   sc_monitor_destroy(&manager->user_global_permissions_monitor);
   sc_hash_table_destroy(manager->user_global_permissions);
@@ -115,36 +120,74 @@ void _sc_memory_context_manager_shutdown(sc_memory_context_manager * manager)
   sc_mem_free(manager);
 }
 
+sc_memory_context_table_shard * _sc_memory_context_manager_get_shard(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr)
+{
+  return &manager->context_table_shards[SC_ADDR_LOCAL_TO_INT(user_addr) % SC_CONTEXT_TABLE_SHARDS_COUNT];
+}
+
+void _sc_memory_context_manager_register_context(sc_memory_context_manager * manager, sc_memory_context * ctx)
+{
+  sc_memory_context_table_shard * shard = _sc_memory_context_manager_get_shard(manager, ctx->user_addr);
+
+  sc_monitor_acquire_write(&shard->monitor);
+  if (shard->contexts != null_ptr)
+    sc_hash_table_insert(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
+  sc_monitor_release_write(&shard->monitor);
+}
+
+void _sc_memory_context_manager_unregister_context(sc_memory_context_manager * manager, sc_memory_context * ctx)
+{
+  sc_memory_context_table_shard * shard = _sc_memory_context_manager_get_shard(manager, ctx->user_addr);
+
+  sc_monitor_acquire_write(&shard->monitor);
+  if (shard->contexts != null_ptr
+      && sc_hash_table_get(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr))) == ctx)
+    sc_hash_table_remove(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
+  sc_monitor_release_write(&shard->monitor);
+}
+
 sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * manager, sc_addr user_addr)
 {
   if (manager == null_ptr)
     return null_ptr;
 
-  sc_memory_context * ctx = sc_mem_new(sc_memory_context, 1);
+  if (SC_ADDR_IS_EMPTY(user_addr))
+    user_addr = _sc_memory_context_manager_generate_guest_user(manager);
 
-  sc_monitor_acquire_write(&manager->context_monitor);
+  sc_memory_context_table_shard * shard = _sc_memory_context_manager_get_shard(manager, user_addr);
 
-  if (manager->context_hash_table == null_ptr)
-    goto error;
+  sc_memory_context * ctx = null_ptr;
 
+  sc_monitor_acquire_write(&shard->monitor);
+
+  if (shard->contexts == null_ptr)
+    goto result;
+
+  // context for the same user might be generated by other thread while this shard was not locked
+  ctx = sc_hash_table_get(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)));
+  if (ctx != null_ptr)
+  {
+    g_atomic_int_inc(&ctx->ref_count);
+    goto result;
+  }
+
+  ctx = sc_mem_new(sc_memory_context, 1);
   sc_monitor_init(&ctx->monitor);
-  ctx->user_addr = SC_ADDR_IS_EMPTY(user_addr) ? _sc_memory_context_manager_generate_guest_user(manager) : user_addr;
-  ctx->ref_count = 0;
+  ctx->user_addr = user_addr;
+  ctx->ref_count = 1;
   ctx->global_permissions = _sc_context_get_user_global_permissions(ctx->user_addr);
   ctx->local_permissions = _sc_context_get_user_local_permissions(ctx->user_addr);
   ctx->pend_events = null_ptr;
+  ctx->pend_events_count = 0;
+  ctx->pend_events_capacity = 0;
 
-  sc_hash_table_insert(
-      manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
-  ++manager->context_count;
-  goto result;
-
-error:
-  sc_mem_free(ctx);
-  ctx = null_ptr;
+  sc_hash_table_insert(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
+  g_atomic_int_inc(&manager->context_count);
 
 result:
-  sc_monitor_release_write(&manager->context_monitor);
+  sc_monitor_release_write(&shard->monitor);
 
   return ctx;
 }
@@ -155,16 +198,17 @@ sc_memory_context * _sc_memory_context_get_impl(sc_memory_context_manager * mana
     return null_ptr;
 
   sc_memory_context * ctx = null_ptr;
+  sc_memory_context_table_shard * shard = _sc_memory_context_manager_get_shard(manager, user_addr);
 
-  sc_monitor_acquire_read(&manager->context_monitor);
+  sc_monitor_acquire_read(&shard->monitor);
 
-  if (manager->context_hash_table == null_ptr)
+  if (shard->contexts == null_ptr)
     goto error;
 
-  ctx = sc_hash_table_get(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)));
+  ctx = sc_hash_table_get(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)));
 
 error:
-  sc_monitor_release_read(&manager->context_monitor);
+  sc_monitor_release_read(&shard->monitor);
 
   return ctx;
 }
@@ -174,16 +218,24 @@ sc_memory_context * _sc_memory_context_resolve_impl(sc_memory_context_manager *
   if (manager == null_ptr)
     return null_ptr;
 
-  sc_memory_context * ctx = _sc_memory_context_get_impl(manager, user_addr);
-  if (ctx == null_ptr)
-    ctx = _sc_memory_context_new_impl(manager, user_addr);
+  sc_memory_context * ctx = null_ptr;
+  if (SC_ADDR_IS_NOT_EMPTY(user_addr))
+  {
+    sc_memory_context_table_shard * shard = _sc_memory_context_manager_get_shard(manager, user_addr);
+
+    // context is referenced under shard lock, so it can't be freed between lookup and referencing
+    sc_monitor_acquire_read(&shard->monitor);
+    if (shard->contexts != null_ptr)
+    {
+      ctx = sc_hash_table_get(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)));
+      if (ctx != null_ptr)
+        g_atomic_int_inc(&ctx->ref_count);
+    }
+    sc_monitor_release_read(&shard->monitor);
+  }
 
   if (ctx == null_ptr)
-    return ctx;
-
-  sc_monitor_acquire_write(&ctx->monitor);
-  ++ctx->ref_count;
-  sc_monitor_release_write(&ctx->monitor);
+    ctx = _sc_memory_context_new_impl(manager, user_addr);
 
   return ctx;
 }
@@ -193,25 +245,36 @@ void _sc_memory_context_free_impl(sc_memory_context_manager * manager, sc_memory
   if (ctx == null_ptr)
     return;
 
-  sc_monitor_acquire_write(&manager->context_monitor);
+  // all references except the last one are dropped without locking
+  sc_int32 ref_count = g_atomic_int_get(&ctx->ref_count);
+  while (ref_count > 1)
+  {
+    if (g_atomic_int_compare_and_exchange(&ctx->ref_count, ref_count, ref_count - 1))
+      return;
+    ref_count = g_atomic_int_get(&ctx->ref_count);
+  }
 
-  if (manager->context_hash_table == null_ptr)
-    goto error;
+  // the last reference is dropped under shard lock, so context can't be resolved while it is being freed
+  sc_memory_context_table_shard * shard =
+      _sc_memory_context_manager_get_shard(manager, _sc_memory_context_get_user_addr(ctx));
 
-  sc_monitor_acquire_write(&ctx->monitor);
-  sc_uint32 ref_count = --ctx->ref_count;
-  sc_monitor_release_write(&ctx->monitor);
+  sc_monitor_acquire_write(&shard->monitor);
 
-  if (ref_count > 0)
+  if (shard->contexts == null_ptr)
     goto error;
 
-  sc_monitor_destroy(&ctx->monitor);
-  sc_hash_table_remove(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
-  --manager->context_count;
+  if (g_atomic_int_dec_and_test(&ctx->ref_count) == SC_FALSE)
+    goto error;
+
+  if (sc_hash_table_get(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr))) == ctx)
+    sc_hash_table_remove(shard->contexts, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
+  g_atomic_int_add(&manager->context_count, -1);
 
+  sc_monitor_destroy(&ctx->monitor);
+  sc_mem_free(ctx->pend_events);
   sc_mem_free(ctx);
 error:
-  sc_monitor_release_write(&manager->context_monitor);
+  sc_monitor_release_write(&shard->monitor);
 }
 
 sc_addr _sc_memory_context_get_user_addr(sc_memory_context * ctx)
@@ -238,42 +301,72 @@ void _sc_memory_context_pend_event(
     sc_type connector_type,
     sc_addr other_addr)
 {
-  sc_event_emit_params * params = sc_mem_new(sc_event_emit_params, 1);
-  params->event_type_addr = event_type_addr;
-  params->subscription_addr = subscription_addr;
-  params->connector_addr = connector_addr;
-  params->connector_type = connector_type;
-  params->other_addr = other_addr;
-
-  sc_monitor_acquire_write((sc_monitor *)&ctx->monitor);
-  ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_append(ctx->pend_events, params);
-  sc_monitor_release_write((sc_monitor *)&ctx->monitor);
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
+  sc_monitor_acquire_write(&context->monitor);
+  if (context->pend_events_count == context->pend_events_capacity)
+  {
+    sc_uint32 const capacity = context->pend_events_capacity == 0 ? SC_CONTEXT_PEND_EVENTS_INITIAL_CAPACITY
+                                                                   : context->pend_events_capacity * 2;
+    sc_event_emit_params * pend_events = sc_mem_new(sc_event_emit_params, capacity);
+    if (context->pend_events != null_ptr)
+    {
+      sc_mem_cpy(pend_events, context->pend_events, context->pend_events_count * sizeof(sc_event_emit_params));
+      sc_mem_free(context->pend_events);
+    }
+    context->pend_events = pend_events;
+    context->pend_events_capacity = capacity;
+  }
+
+  context->pend_events[context->pend_events_count++] = (sc_event_emit_params){
+      .subscription_addr = subscription_addr,
+      .event_type_addr = event_type_addr,
+      .connector_addr = connector_addr,
+      .connector_type = connector_type,
+      .other_addr = other_addr};
+  sc_monitor_release_write(&context->monitor);
+}
+
+gint _sc_memory_context_compare_pend_events(gconstpointer a, gconstpointer b, gpointer data)
+{
+  sc_addr_hash const a_hash = SC_ADDR_LOCAL_TO_INT(((sc_event_emit_params const *)a)->subscription_addr);
+  sc_addr_hash const b_hash = SC_ADDR_LOCAL_TO_INT(((sc_event_emit_params const *)b)->subscription_addr);
+  return (a_hash > b_hash) - (a_hash < b_hash);
 }
 
 void _sc_memory_context_emit_events(sc_memory_context const * ctx)
 {
-  GSList * item = null_ptr;
-  sc_event_emit_params * event_params = null_ptr;
+  sc_memory_context * context = (sc_memory_context *)ctx;
+  if (context->pend_events_count == 0)
+    return;
 
-  // Emit all saved events
-  while (ctx->pend_events)
+  // Group saved events by sc-elements, order of events of every sc-element is kept by stable sort
+#if GLIB_CHECK_VERSION(2, 82, 0)
+  g_sort_array(
+      context->pend_events,
+      context->pend_events_count,
+      sizeof(sc_event_emit_params),
+      _sc_memory_context_compare_pend_events,
+      null_ptr);
+#else
+  g_qsort_with_data(
+      context->pend_events,
+      (gint)context->pend_events_count,
+      sizeof(sc_event_emit_params),
+      _sc_memory_context_compare_pend_events,
+      null_ptr);
+#endif
+
+  // Emit all saved events by batches, subscriptions table is locked once per batch
+  for (sc_uint32 i = 0; i < context->pend_events_count; i += SC_CONTEXT_PEND_EVENTS_EMIT_BATCH_SIZE)
   {
-    item = ctx->pend_events;
-    event_params = (sc_event_emit_params *)item->data;
-
-    sc_event_emit_impl(
-        ctx,
-        event_params->subscription_addr,
-        event_params->event_type_addr,
-        event_params->connector_addr,
-        event_params->connector_type,
-        event_params->other_addr,
-        null_ptr,
-        SC_ADDR_EMPTY);
-    sc_mem_free(event_params);
-
-    ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_remove_sublist(ctx->pend_events, ctx->pend_events);
+    sc_uint32 const batch_size = context->pend_events_count - i < SC_CONTEXT_PEND_EVENTS_EMIT_BATCH_SIZE
+                                     ? context->pend_events_count - i
+                                     : SC_CONTEXT_PEND_EVENTS_EMIT_BATCH_SIZE;
+    sc_event_emit_n_impl(ctx, context->pend_events + i, batch_size, null_ptr, SC_ADDR_EMPTY);
   }
+
+  context->pend_events_count = 0;
 }
 
 void _sc_memory_context_pending_begin(sc_memory_context * ctx)
@@ -49,14 +49,28 @@ void _sc_memory_context_assign_context_for_system(sc_memory_context_manager * ma
  */
 void _sc_memory_context_manager_shutdown(sc_memory_context_manager * manager);
 
-/*! Function that generates an existing sc-memory context for a specified user.
+/*! Function that generates a sc-memory context for a specified user.
  * @param manager Pointer to the sc-memory context manager responsible for context creation.
- * @param user_addr sc-address representing the user for whom the context is generated.
- * @returns Returns a pointer to the existing sc-memory context for the specified user.
- * @note This function generates sc-memory context for the specified user.
+ * @param user_addr sc-address representing the user for whom the context is generated. If it is empty, then guest user
+ * is generated.
+ * @returns Returns a pointer to the referenced sc-memory context for the specified user.
+ * @note If sc-memory context for the specified user has been generated by other thread, then it is referenced and
+ * returned.
  */
 sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * manager, sc_addr user_addr);
 
+/*! Function that adds a sc-memory context into table of contexts by its user sc-address.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param ctx Pointer to the sc-memory context to be added.
+ */
+void _sc_memory_context_manager_register_context(sc_memory_context_manager * manager, sc_memory_context * ctx);
+
+/*! Function that removes a sc-memory context from table of contexts by its user sc-address.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param ctx Pointer to the sc-memory context to be removed.
+ */
+void _sc_memory_context_manager_unregister_context(sc_memory_context_manager * manager, sc_memory_context * ctx);
+
 /*! Function that retrieves an existing sc-memory context for a specified user.
  * @param manager Pointer to the sc-memory context manager responsible for context retrieval.
  * @param user_addr sc-address representing the user for whom the context is retrieved.
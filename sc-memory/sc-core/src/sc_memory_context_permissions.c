@@ -252,14 +252,13 @@ sc_result _sc_memory_context_manager_on_identified_user(
 
   sc_monitor_acquire_write(&ctx->monitor);
 
-  sc_hash_table_remove(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
+  _sc_memory_context_manager_unregister_context(manager, ctx);
 
   ctx->user_addr = identified_user_addr;
   ctx->global_permissions = _sc_context_get_user_global_permissions(ctx->user_addr);
   ctx->local_permissions = _sc_context_get_user_local_permissions(ctx->user_addr);
 
-  sc_hash_table_insert(
-      manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
+  _sc_memory_context_manager_register_context(manager, ctx);
 
   sc_monitor_release_write(&ctx->monitor);
 
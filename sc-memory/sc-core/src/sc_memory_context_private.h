@@ -13,14 +13,29 @@
 #include "sc-store/sc-container/sc_hash_table.h"
 #include "sc-store/sc-base/sc_monitor_private.h"
 
+#include "sc_memory_context_manager.h"
+
+//! Count of shards of table storing memory contexts
+#define SC_CONTEXT_TABLE_SHARDS_COUNT 32
+
+/*! Structure representing a shard of table storing memory contexts.
+ * @note Every shard stores memory contexts of users which sc-addresses hashes give the same shard index. Shards are
+ * locked separately, so memory contexts of different users are looked up and freed without contention.
+ */
+typedef struct
+{
+  sc_hash_table * contexts;  ///< Hash table storing memory contexts based on user addresses.
+  sc_monitor monitor;        ///< Monitor for synchronizing access to the hash table storing memory contexts.
+} sc_memory_context_table_shard;
+
 /*! Structure representing a memory context manager.
  * @note This structure manages memory contexts and user authentications in the sc-memory.
  */
 struct _sc_memory_context_manager
 {
-  sc_hash_table * context_hash_table;  ///< Hash table storing memory contexts based on user addresses.
-  sc_uint32 context_count;             ///< Number of currently active memory contexts.
-  sc_monitor context_monitor;          ///< Monitor for synchronizing access to the hash table storing memory contexts.
+  ///< Shards of table storing memory contexts based on user addresses.
+  sc_memory_context_table_shard context_table_shards[SC_CONTEXT_TABLE_SHARDS_COUNT];
+  sc_int32 context_count;  ///< Number of currently active memory contexts.
 
   sc_event_subscription * on_new_identified_user_subscription;  /// < Subscription for identified user events.
 
@@ -79,12 +94,15 @@ struct _sc_memory_context_manager
 struct _sc_memory_context
 {
   sc_addr user_addr;                  ///< sc-address representing the user associated with the sc-memory context.
-  sc_uint32 ref_count;                ///< Reference count to manage the number of references to the sc-memory context.
+  sc_int32 ref_count;                 ///< Reference count to manage the number of references to the sc-memory context.
   sc_permissions global_permissions;  ///< Global permissions within the knowledge base.
   sc_hash_table * local_permissions;  ///< Local permissions within sc-structures.
   sc_uint8 flags;                     ///< Flags indicating the state of the sc-memory context.
-  sc_hash_table_list * pend_events;   ///< List of pending events to be emitted in the sc-memory context.
   sc_monitor monitor;                 ///< Monitor for synchronizing access to the sc-memory context.
+
+  sc_event_emit_params * pend_events;  ///< Buffer of pending events to be emitted in the sc-memory context.
+  sc_uint32 pend_events_count;         ///< Count of pending events in buffer.
+  sc_uint32 pend_events_capacity;      ///< Capacity of pending events buffer.
 };
 
 /*!
@@ -5,30 +5,16 @@
  */
 
 #include "sc_memory_ext.h"
-
-#include <gmodule.h>
+#include "sc_memory_ext_private.h"
 
 #include "sc-core/sc-base/sc_allocator.h"
 
 #include "sc-store/sc-base/sc_message.h"
+#include "sc-store/sc-base/sc_profiler.h"
 #include "sc-store/sc-fs-memory/sc_file_system.h"
 
 GList * modules_priority_list = null_ptr;
 
-//! Type of module function
-typedef sc_result (*fModuleInitializeFunc)(sc_addr);
-typedef sc_result (*fModuleShutdownFunc)();
-typedef sc_uint32 (*fModulePriorityFunc)();
-
-typedef struct
-{
-  GModule * ptr;
-  sc_char * path;
-  sc_uint32 priority;
-  fModuleInitializeFunc init_func;
-  fModuleShutdownFunc shut_func;
-} sc_module_info;
-
 void sc_module_info_free(sc_pointer mi)
 {
   sc_module_info * info = (sc_module_info *)mi;
@@ -63,6 +49,77 @@ sc_char * _sc_module_build_path(sc_char const * directory, sc_char const * modul
   return g_strconcat(directory, "/", module_name, null_ptr);
 }
 
+void _sc_module_initialize(sc_pointer data, sc_pointer user_data)
+{
+  sc_module_info * module = (sc_module_info *)data;
+  sc_addr const * init_memory_generated_structure = (sc_addr const *)user_data;
+
+  sc_message("Initialize module: %s", module->path);
+  sc_profiler_phase * phase = sc_profiler_phase_begin(module->path);
+  gint64 const start_time = g_get_monotonic_time();
+  module->init_result = module->init_func(*init_memory_generated_structure);
+  module->init_time = g_get_monotonic_time() - start_time;
+  sc_profiler_phase_end(phase);
+}
+
+//! Initializes modules with the same priority concurrently, modules with different priorities are initialized in order
+void _sc_modules_initialize_tier(GList * tier_begin, GList * tier_end, sc_addr const * init_memory_generated_structure)
+{
+  sc_uint32 tier_size = 0;
+  for (GList * item = tier_begin; item != tier_end; item = item->next)
+    ++tier_size;
+
+  sc_uint32 const threads_count = sc_min(tier_size, g_get_num_processors());
+  GThreadPool * thread_pool = null_ptr;
+  if (threads_count > 1)
+    thread_pool = g_thread_pool_new(
+        _sc_module_initialize, (sc_pointer)init_memory_generated_structure, (gint)threads_count, SC_TRUE, null_ptr);
+
+  for (GList * item = tier_begin; item != tier_end; item = item->next)
+  {
+    if (thread_pool == null_ptr || g_thread_pool_push(thread_pool, item->data, null_ptr) == SC_FALSE)
+      _sc_module_initialize(item->data, (sc_pointer)init_memory_generated_structure);
+  }
+
+  // wait until all modules of tier are initialized
+  if (thread_pool != null_ptr)
+    g_thread_pool_free(thread_pool, SC_FALSE, SC_TRUE);
+
+  // modules failed to initialize are shutdown after the whole tier, so they don't interfere with other modules
+  for (GList * item = tier_begin; item != tier_end; item = item->next)
+  {
+    sc_module_info * module = (sc_module_info *)item->data;
+    if (module->init_result != SC_RESULT_OK)
+    {
+      sc_warning("Something happens, on module initialization: %s", module->path);
+      module->shut_func();
+      if (module->ptr != null_ptr)
+        g_module_close(module->ptr);
+      module->ptr = null_ptr;
+      continue;
+    }
+
+    sc_message("Module %s is initialized in %.3f ms", module->path, module->init_time / 1000.0);
+  }
+}
+
+void _sc_ext_initialize_modules(GList * modules, sc_addr init_memory_generated_structure)
+{
+  // modules without priority can share state of sc-machine that isn't synchronized, so they are initialized one by one
+  GList * tier_begin = modules;
+  while (tier_begin != null_ptr)
+  {
+    sc_module_info const * module = (sc_module_info *)tier_begin->data;
+    GList * tier_end = tier_begin->next;
+    while (module->has_priority && tier_end != null_ptr && ((sc_module_info *)tier_end->data)->has_priority
+           && ((sc_module_info *)tier_end->data)->priority == module->priority)
+      tier_end = tier_end->next;
+
+    _sc_modules_initialize_tier(tier_begin, tier_end, &init_memory_generated_structure);
+    tier_begin = tier_end;
+  }
+}
+
 sc_result sc_ext_initialize(
     sc_char const * ext_dir_path,
     sc_char const ** enabled_list,
@@ -132,10 +189,9 @@ sc_result sc_ext_initialize(
     mi->shut_func = shutdown_func;
 
     fModulePriorityFunc module_priority_func;
-    if (g_module_symbol(mi->ptr, "sc_module_load_priority", (sc_pointer *)&module_priority_func) == SC_FALSE)
-      mi->priority = G_MAXUINT32;
-    else
-      mi->priority = module_priority_func();
+    mi->has_priority =
+        g_module_symbol(mi->ptr, "sc_module_load_priority", (sc_pointer *)&module_priority_func) == SC_TRUE;
+    mi->priority = mi->has_priority ? module_priority_func() : G_MAXUINT32;
 
     modules_priority_list = g_list_insert_sorted(modules_priority_list, (sc_pointer)mi, sc_priority_less);
     goto next;
@@ -153,25 +209,9 @@ sc_result sc_ext_initialize(
 
   g_dir_close(ext_dir);
 
-  // initialize modules
-  GList * item = modules_priority_list;
-  sc_result init_result;
-  while (item != null_ptr)
-  {
-    sc_module_info * module = (sc_module_info *)item->data;
-    sc_message("Initialize module: %s", module->path);
-    init_result = module->init_func(init_memory_generated_structure);
-
-    if (init_result != SC_RESULT_OK)
-    {
-      sc_warning("Something happens, on module initialization: %s", module->path);
-      module->shut_func();
-      g_module_close(module->ptr);
-      module->ptr = null_ptr;
-    }
-
-    item = item->next;
-  }
+  gint64 const start_time = g_get_monotonic_time();
+  _sc_ext_initialize_modules(modules_priority_list, init_memory_generated_structure);
+  sc_message("Extensions are initialized in %.3f ms", (g_get_monotonic_time() - start_time) / 1000.0);
 
   return SC_RESULT_OK;
 }
@@ -186,7 +226,10 @@ void sc_ext_shutdown()
     sc_message("Shutdown module: %s", module->path);
     if (module->ptr != null_ptr)
     {
-      if (module->shut_func() != SC_RESULT_OK)
+      sc_profiler_phase * phase = sc_profiler_phase_begin(module->path);
+      sc_result const result = module->shut_func();
+      sc_profiler_phase_end(phase);
+      if (result != SC_RESULT_OK)
         sc_warning("Something happens, on module shutdown: %s", module->path);
     }
 
@@ -0,0 +1,39 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_memory_ext_private_h_
+#define _sc_memory_ext_private_h_
+
+#include <gmodule.h>
+
+#include "sc-core/sc_types.h"
+
+//! Type of module function
+typedef sc_result (*fModuleInitializeFunc)(sc_addr);
+typedef sc_result (*fModuleShutdownFunc)();
+typedef sc_uint32 (*fModulePriorityFunc)();
+
+typedef struct
+{
+  GModule * ptr;
+  sc_char * path;
+  sc_uint32 priority;
+  sc_bool has_priority;  // only modules that declare their priority are initialized concurrently
+  fModuleInitializeFunc init_func;
+  fModuleShutdownFunc shut_func;
+  sc_result init_result;
+  gint64 init_time;  // in microseconds
+} sc_module_info;
+
+/*! Initializes modules sorted by their priorities. Modules that declare the same priority are initialized
+ * concurrently, other modules are initialized one by one in order. Modules failed to initialize are shutdown after all
+ * modules initialized with them.
+ * @param modules A list of sc_module_info sorted by priorities.
+ * @param init_memory_generated_structure A sc-address of structure that modules append generated sc-elements to.
+ */
+_SC_EXTERN void _sc_ext_initialize_modules(GList * modules, sc_addr init_memory_generated_structure);
+
+#endif  // _sc_memory_ext_private_h_
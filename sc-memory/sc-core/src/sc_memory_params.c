@@ -28,14 +28,20 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->log_type = DEFAULT_LOG_TYPE;
   params->log_file = DEFAULT_LOG_FILE;
   params->log_level = DEFAULT_LOG_LEVEL;
+  params->profile_trace_file = DEFAULT_PROFILE_TRACE_FILE;
 
   params->init_memory_generated_structure = (sc_char const *)null_ptr;
   params->init_memory_generated_upload = SC_FALSE;
   params->user_mode = SC_FALSE;
+  params->offline_build = SC_FALSE;
 
   params->max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
   params->max_strings_channel_size = DEFAULT_MAX_STRINGS_CHANNEL_SIZE;
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+
+  params->compact_strings = DEFAULT_COMPACT_STRINGS;
+  params->compact_strings_period = DEFAULT_COMPACT_STRINGS_PERIOD;  // seconds
+  params->compact_strings_min_unreferenced_percent = DEFAULT_COMPACT_STRINGS_MIN_UNREFERENCED_PERCENT;
 }
@@ -0,0 +1,81 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "units/dictionary_test.hpp"
+
+template <class BMType>
+void BM_DictionaryAppend(benchmark::State & state)
+{
+  for (auto t : state)
+  {
+    BMType test;
+    test.Initialize(state.range(0));
+
+    state.PauseTiming();
+    state.counters["bytes_per_key"] = double(test.GetMemorySize()) / state.range(0);
+    test.Shutdown();
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class BMType>
+void BM_DictionaryFind(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+
+  size_t index = 0;
+  for (auto t : state)
+    benchmark::DoNotOptimize(test.Find(index++));
+
+  state.counters["bytes_per_key"] = double(test.GetMemorySize()) / state.range(0);
+  state.SetItemsProcessed(state.iterations());
+  test.Shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_DictionaryAppend, TestDictionary)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Iterations(3)
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_DictionaryAppend, TestMap)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Iterations(3)
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_DictionaryAppend, TestUnorderedMap)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Iterations(3)
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_DictionaryAppend, TestFixedChildrenTrie)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Iterations(3)
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_DictionaryFind, TestDictionary)->Arg(10000)->Arg(1000000)->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK_TEMPLATE(BM_DictionaryFind, TestMap)->Arg(10000)->Arg(1000000)->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK_TEMPLATE(BM_DictionaryFind, TestUnorderedMap)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK_TEMPLATE(BM_DictionaryFind, TestFixedChildrenTrie)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK_MAIN();
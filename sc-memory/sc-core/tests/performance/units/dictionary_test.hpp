@@ -0,0 +1,257 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+extern "C"
+{
+#include <sc-core/sc-container/sc_dictionary.h>
+
+#include <sc-store/sc-container/sc_dictionary_private.h>
+}
+
+inline void _TestDictionaryCharToInt(sc_char ch, sc_uint8 * ch_num, sc_uint8 const *)
+{
+  *ch_num = 128 + (sc_uint8)ch;
+}
+
+//! Generates system identifiers like `concept_set_42` and `nrel_inclusion_7` with shared prefixes
+inline std::vector<std::string> GenerateIdentifiers(size_t count)
+{
+  static std::vector<std::string> const prefixes = {"concept_", "nrel_", "rrel_", "lang_", "action_", "question_"};
+  static std::vector<std::string> const words = {
+      "set", "inclusion", "relation", "number", "structure", "main_key", "idtf", "agent", "class", "sc_element"};
+
+  std::mt19937 generator(count);
+  std::uniform_int_distribution<size_t> prefixDistribution(0, prefixes.size() - 1);
+  std::uniform_int_distribution<size_t> wordDistribution(0, words.size() - 1);
+
+  std::vector<std::string> identifiers;
+  identifiers.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+    identifiers.push_back(
+        prefixes[prefixDistribution(generator)] + words[wordDistribution(generator)] + "_" + std::to_string(i));
+
+  return identifiers;
+}
+
+class TestDictionary
+{
+public:
+  void Initialize(size_t count)
+  {
+    m_identifiers = GenerateIdentifiers(count);
+    sc_dictionary_initialize(&m_dictionary, 255, _TestDictionaryCharToInt);
+    for (size_t i = 0; i < m_identifiers.size(); ++i)
+      sc_dictionary_append(
+          m_dictionary, m_identifiers[i].c_str(), m_identifiers[i].size(), (sc_addr_hash_to_sc_pointer)(i + 1));
+  }
+
+  void Shutdown()
+  {
+    sc_dictionary_destroy(m_dictionary, nullptr);
+  }
+
+  bool Find(size_t index) const
+  {
+    std::string const & identifier = m_identifiers[index % m_identifiers.size()];
+    return sc_dictionary_get_by_key(m_dictionary, identifier.c_str(), identifier.size()) != nullptr;
+  }
+
+  size_t GetMemorySize() const
+  {
+    return sc_dictionary_get_memory_size(m_dictionary);
+  }
+
+private:
+  std::vector<std::string> m_identifiers;
+  sc_dictionary * m_dictionary = nullptr;
+};
+
+class TestMap
+{
+public:
+  void Initialize(size_t count)
+  {
+    m_identifiers = GenerateIdentifiers(count);
+    for (size_t i = 0; i < m_identifiers.size(); ++i)
+      m_map.insert({m_identifiers[i], (sc_addr_hash_to_sc_pointer)(i + 1)});
+  }
+
+  void Shutdown()
+  {
+    m_map.clear();
+  }
+
+  bool Find(size_t index) const
+  {
+    return m_map.find(m_identifiers[index % m_identifiers.size()]) != m_map.cend();
+  }
+
+  size_t GetMemorySize() const
+  {
+    // approximate size of red-black tree nodes with keys
+    size_t size = 0;
+    for (auto const & item : m_map)
+      size += sizeof(item) + 4 * sizeof(void *) + item.first.capacity() + 1;
+    return size;
+  }
+
+private:
+  std::vector<std::string> m_identifiers;
+  std::map<std::string, void *> m_map;
+};
+
+class TestUnorderedMap
+{
+public:
+  void Initialize(size_t count)
+  {
+    m_identifiers = GenerateIdentifiers(count);
+    for (size_t i = 0; i < m_identifiers.size(); ++i)
+      m_map.insert({m_identifiers[i], (sc_addr_hash_to_sc_pointer)(i + 1)});
+  }
+
+  void Shutdown()
+  {
+    m_map.clear();
+  }
+
+  bool Find(size_t index) const
+  {
+    return m_map.find(m_identifiers[index % m_identifiers.size()]) != m_map.cend();
+  }
+
+  size_t GetMemorySize() const
+  {
+    // approximate size of hash table buckets and nodes with keys and cached hashes
+    size_t size = m_map.bucket_count() * sizeof(void *);
+    for (auto const & item : m_map)
+      size += sizeof(item) + 2 * sizeof(void *) + item.first.capacity() + 1;
+    return size;
+  }
+
+private:
+  std::vector<std::string> m_identifiers;
+  std::unordered_map<std::string, void *> m_map;
+};
+
+//! Radix tree with fixed-size children arrays in every node, as sc-dictionary was laid out before adaptive nodes
+class TestFixedChildrenTrie
+{
+public:
+  void Initialize(size_t count)
+  {
+    m_identifiers = GenerateIdentifiers(count);
+    m_root = std::make_unique<Node>();
+    for (size_t i = 0; i < m_identifiers.size(); ++i)
+      Append(m_identifiers[i], (sc_addr_hash_to_sc_pointer)(i + 1));
+  }
+
+  void Shutdown()
+  {
+    m_root.reset();
+  }
+
+  bool Find(size_t index) const
+  {
+    std::string const & identifier = m_identifiers[index % m_identifiers.size()];
+
+    Node const * node = m_root.get();
+    size_t position = 0;
+    while (position < identifier.size())
+    {
+      if (node->next == nullptr)
+        return false;
+
+      node = (*node->next)[(sc_uint8)identifier[position]].get();
+      if (node == nullptr || identifier.compare(position, node->offset.size(), node->offset) != 0)
+        return false;
+      position += node->offset.size();
+    }
+
+    return node->data != nullptr;
+  }
+
+  size_t GetMemorySize() const
+  {
+    return GetMemorySize(m_root.get());
+  }
+
+private:
+  struct Node
+  {
+    std::unique_ptr<std::array<std::unique_ptr<Node>, 256>> next;
+    std::string offset;
+    void * data = nullptr;
+  };
+
+  void Append(std::string const & string, void * data)
+  {
+    Node * node = m_root.get();
+    size_t position = 0;
+    while (position < string.size())
+    {
+      if (node->next == nullptr)
+        node->next = std::make_unique<std::array<std::unique_ptr<Node>, 256>>();
+
+      std::unique_ptr<Node> & child = (*node->next)[(sc_uint8)string[position]];
+      if (child == nullptr)
+      {
+        child = std::make_unique<Node>();
+        child->offset = string.substr(position);
+        child->data = data;
+        return;
+      }
+
+      size_t common = 0;
+      while (common < child->offset.size() && position + common < string.size()
+             && child->offset[common] == string[position + common])
+        ++common;
+
+      if (common < child->offset.size())
+      {
+        auto prefix = std::make_unique<Node>();
+        prefix->offset = child->offset.substr(0, common);
+        prefix->next = std::make_unique<std::array<std::unique_ptr<Node>, 256>>();
+        child->offset.erase(0, common);
+        (*prefix->next)[(sc_uint8)child->offset[0]] = std::move(child);
+        child = std::move(prefix);
+      }
+
+      node = child.get();
+      position += common;
+    }
+
+    node->data = data;
+  }
+
+  static size_t GetMemorySize(Node const * node)
+  {
+    if (node == nullptr)
+      return 0;
+
+    size_t size = sizeof(Node) + node->offset.capacity() + 1;
+    if (node->next != nullptr)
+    {
+      size += sizeof(*node->next);
+      for (auto const & child : *node->next)
+        size += GetMemorySize(child.get());
+    }
+    return size;
+  }
+
+  std::vector<std::string> m_identifiers;
+  std::unique_ptr<Node> m_root;
+};
@@ -0,0 +1,123 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+extern "C"
+{
+#include "sc-store/sc-base/sc_profiler.h"
+}
+
+TEST(ScProfilerTest, WriteTraceFile)
+{
+  std::string const traceFilePath = "sc-profiler-trace.json";
+  sc_profiler_initialize(traceFilePath.c_str());
+
+  sc_profiler_phase * outerPhase = sc_profiler_phase_begin("outer");
+  ASSERT_NE(outerPhase, nullptr);
+  sc_profiler_phase * innerPhase = sc_profiler_phase_begin("inner \"phase\"");
+  ASSERT_NE(innerPhase, nullptr);
+  sc_profiler_phase_end(innerPhase);
+  sc_profiler_phase_end(outerPhase);
+  // unfinished phases aren't written
+  sc_profiler_phase * unfinishedPhase = sc_profiler_phase_begin("unfinished");
+
+  sc_profiler_report("Test profile");
+  sc_profiler_phase_end(unfinishedPhase);
+  sc_profiler_shutdown();
+
+  std::ifstream file(traceFilePath);
+  ASSERT_TRUE(file.is_open());
+  std::stringstream stream;
+  stream << file.rdbuf();
+  file.close();
+
+  std::string const trace = stream.str();
+  EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"outer\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"inner \\\"phase\\\"\""), std::string::npos);
+  EXPECT_EQ(trace.find("\"name\":\"unfinished\""), std::string::npos);
+
+  std::remove(traceFilePath.c_str());
+}
+
+TEST(ScProfilerTest, AppendReportedPhasesToTraceFile)
+{
+  std::string const traceFilePath = "sc-profiler-trace.json";
+  sc_profiler_initialize(traceFilePath.c_str());
+
+  sc_profiler_phase_end(sc_profiler_phase_begin("first"));
+  sc_profiler_report("First profile");
+  sc_profiler_phase_end(sc_profiler_phase_begin("second"));
+  sc_profiler_report("Second profile");
+  // reported phases are freed, so they aren't written again
+  sc_profiler_report("Third profile");
+  sc_profiler_shutdown();
+
+  std::ifstream file(traceFilePath);
+  ASSERT_TRUE(file.is_open());
+  std::stringstream stream;
+  stream << file.rdbuf();
+  file.close();
+
+  std::string const trace = stream.str();
+  size_t const firstPosition = trace.find("\"name\":\"first\"");
+  ASSERT_NE(firstPosition, std::string::npos);
+  EXPECT_EQ(trace.find("\"name\":\"first\"", firstPosition + 1), std::string::npos);
+  size_t const secondPosition = trace.find("\"name\":\"second\"");
+  ASSERT_NE(secondPosition, std::string::npos);
+  EXPECT_EQ(trace.find("\"name\":\"second\"", secondPosition + 1), std::string::npos);
+  EXPECT_EQ(trace.substr(trace.size() - 5), "}\n]}\n");
+
+  std::remove(traceFilePath.c_str());
+}
+
+TEST(ScProfilerTest, PausedProfiler)
+{
+  std::string const traceFilePath = "sc-profiler-trace.json";
+  sc_profiler_initialize(traceFilePath.c_str());
+
+  sc_profiler_phase * startedPhase = sc_profiler_phase_begin("started");
+  ASSERT_NE(startedPhase, nullptr);
+  sc_profiler_pause();
+  EXPECT_EQ(sc_profiler_phase_begin("paused"), nullptr);
+  // phase started before pause is recorded
+  sc_profiler_phase_end(startedPhase);
+  sc_profiler_resume();
+  sc_profiler_phase * resumedPhase = sc_profiler_phase_begin("resumed");
+  ASSERT_NE(resumedPhase, nullptr);
+  sc_profiler_phase_end(resumedPhase);
+
+  sc_profiler_report("Test profile");
+  sc_profiler_shutdown();
+
+  std::ifstream file(traceFilePath);
+  ASSERT_TRUE(file.is_open());
+  std::stringstream stream;
+  stream << file.rdbuf();
+  file.close();
+
+  std::string const trace = stream.str();
+  EXPECT_NE(trace.find("\"name\":\"started\""), std::string::npos);
+  EXPECT_EQ(trace.find("\"name\":\"paused\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"resumed\""), std::string::npos);
+
+  std::remove(traceFilePath.c_str());
+}
+
+TEST(ScProfilerTest, PhasesWithoutProfiler)
+{
+  sc_profiler_phase * phase = sc_profiler_phase_begin("phase");
+  EXPECT_EQ(phase, nullptr);
+  sc_profiler_phase_end(phase);
+  sc_profiler_pause();
+  sc_profiler_resume();
+  sc_profiler_report("Test profile");
+}
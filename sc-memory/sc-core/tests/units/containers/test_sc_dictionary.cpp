@@ -229,3 +229,41 @@ TEST(ScDictionaryTest, sc_dictionary_append_get_by_key_prefix)
 
   EXPECT_TRUE(_test_sc_uchar_dictionary_destroy(dictionary));
 }
+
+TEST(ScDictionaryTest, sc_dictionary_append_get_by_key_children_growth)
+{
+  sc_dictionary * dictionary;
+  EXPECT_TRUE(_test_sc_uchar_dictionary_initialize(&dictionary));
+
+  sc_char string[] = "key_";
+  sc_uint32 const string_size = sc_str_len(string) + 1;
+  sc_dictionary_node * first_node = nullptr;
+
+  // all chars after common prefix force node children to grow from 4 up to 256
+  for (sc_uint32 i = 1; i <= 255; ++i)
+  {
+    sc_char key[] = {'k', 'e', 'y', '_', (sc_char)i};
+    sc_dictionary_node * node = sc_dictionary_append(dictionary, key, string_size, (sc_addr_hash_to_sc_pointer)i);
+    if (first_node == nullptr)
+      first_node = node;
+  }
+
+  for (sc_uint32 i = 1; i <= 255; ++i)
+  {
+    sc_char key[] = {'k', 'e', 'y', '_', (sc_char)i};
+    EXPECT_EQ((sc_pointer_to_sc_addr_hash)sc_dictionary_get_by_key(dictionary, key, string_size), i);
+  }
+
+  sc_char first_key[] = {'k', 'e', 'y', '_', (sc_char)1};
+  EXPECT_EQ(sc_dictionary_get_last_node_from_node(dictionary, dictionary->root, first_key, string_size), first_node);
+  EXPECT_EQ((sc_pointer_to_sc_addr_hash)first_node->data, 1u);
+
+  sc_list * hashes;
+  sc_list_init(&hashes);
+  sc_dictionary_get_by_key_prefix(
+      dictionary, string, string_size - 1, _test_visit_nodes_by_key_prefix, (void **)&hashes);
+  EXPECT_EQ(hashes->size, 255u);
+  sc_list_destroy(hashes);
+
+  EXPECT_TRUE(_test_sc_uchar_dictionary_destroy(dictionary));
+}
@@ -6,6 +6,10 @@
 
 #include "sc_dictionary_fs_memory_test.hpp"
 
+#include <fstream>
+#include <string>
+#include <vector>
+
 extern "C"
 {
 #include <sc-core/sc-base/sc_allocator.h>
@@ -15,6 +19,7 @@ extern "C"
 #include <sc-store/sc-fs-memory/sc_dictionary_fs_memory.h>
 #include <sc-store/sc-fs-memory/sc_dictionary_fs_memory_private.h>
 #include <sc-store/sc-fs-memory/sc_file_system.h>
+#include <sc-store/sc-fs-memory/sc_fs_memory_numeric_index.h>
 #include <sc-store/sc-fs-memory/sc_io.h>
 #include <sc-store/sc-container/sc_pair.h>
 #include <sc-store/sc-container/sc_struct_node.h>
@@ -77,6 +82,9 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_nullptr)
   EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 0, nullptr, 0), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 0), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, 0, nullptr, nullptr), SC_FS_MEMORY_NO);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_file_path(memory, 0, nullptr, 0), SC_FS_MEMORY_NO);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash_ext(memory, 0, nullptr, nullptr, nullptr), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_get_link_hashes_by_string(memory, nullptr, 0, nullptr, nullptr), SC_FS_MEMORY_NO);
   EXPECT_EQ(
       sc_dictionary_fs_memory_get_link_hashes_by_substring(memory, nullptr, 0, nullptr, nullptr), SC_FS_MEMORY_NO);
@@ -90,6 +98,7 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_nullptr)
   EXPECT_EQ(sc_dictionary_fs_memory_unite_link_hashes_by_terms(memory, nullptr, nullptr), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_intersect_strings_by_terms(memory, nullptr, nullptr), SC_FS_MEMORY_NO);
   EXPECT_EQ(sc_dictionary_fs_memory_unite_strings_by_terms(memory, nullptr, nullptr), SC_FS_MEMORY_NO);
+  EXPECT_EQ(sc_dictionary_fs_memory_compact(memory), SC_FS_MEMORY_NO);
 }
 
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_init_save_shutdown_load)
@@ -1452,3 +1461,769 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_mutiple_link_strings_wi
 
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_compact_strings)
+{
+  sc_memory_params params;
+  params.storage = SC_DICTIONARY_FS_MEMORY_PATH;
+  params.clear = SC_TRUE;
+  params.max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
+  params.max_strings_channel_size = 1000;
+  params.max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
+  params.term_separators = DEFAULT_TERM_SEPARATORS;
+  params.search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params.compact_strings_min_unreferenced_percent = DEFAULT_COMPACT_STRINGS_MIN_UNREFERENCED_PERCENT;
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, &params), SC_FS_MEMORY_OK);
+
+  sc_char const string_template[] = "This is string number %" PRIu64;
+  sc_char string[50];
+
+  sc_uint64 const STRING_COUNT = 1000;
+  for (sc_uint64 hash = 0; hash < STRING_COUNT; ++hash)
+  {
+    snprintf(string, 50, string_template, hash);
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+  }
+
+  // unlink even strings and relink one sc-link with other string
+  for (sc_uint64 hash = 0; hash < STRING_COUNT; hash += 2)
+    EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, hash), SC_FS_MEMORY_OK);
+  sc_char relinked_string[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, relinked_string, sc_str_len(relinked_string)), SC_FS_MEMORY_OK);
+
+  sc_uint64 const last_string_offset = memory->last_string_offset;
+  EXPECT_GT(memory->unreferenced_strings_size, 0u);
+  EXPECT_EQ(sc_dictionary_fs_memory_compact(memory), SC_FS_MEMORY_OK);
+  EXPECT_LT(memory->last_string_offset, last_string_offset);
+  EXPECT_EQ(memory->unreferenced_strings_size, 0u);
+
+  auto const & checkStrings = [&]()
+  {
+    sc_char * found_string;
+    sc_uint64 size;
+    for (sc_uint64 hash = 0; hash < STRING_COUNT; ++hash)
+    {
+      snprintf(string, 50, string_template, hash);
+      if (hash % 2 == 0)
+      {
+        EXPECT_EQ(
+            sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash, &found_string, &size),
+            SC_FS_MEMORY_NO_STRING);
+        continue;
+      }
+
+      EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash, &found_string, &size), SC_FS_MEMORY_OK);
+      EXPECT_TRUE(sc_str_cmp(found_string, hash == 1 ? relinked_string : string));
+      sc_mem_free(found_string);
+    }
+
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    snprintf(string, 50, string_template, (sc_uint64)2);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(
+            memory, string, sc_str_len(string), found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 0u);
+    sc_list_destroy(found_link_hashes);
+
+    sc_list_init(&found_link_hashes);
+    snprintf(string, 50, string_template, (sc_uint64)3);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(
+            memory, string, sc_str_len(string), found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 1u);
+    sc_iterator * it = sc_list_iterator(found_link_hashes);
+    EXPECT_TRUE(sc_iterator_next(it));
+    EXPECT_EQ((sc_pointer_to_sc_addr_hash)sc_iterator_get(it), 3u);
+    sc_iterator_destroy(it);
+    sc_list_destroy(found_link_hashes);
+
+    sc_list_init(&found_link_hashes);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_substring(
+            memory, "first", sc_str_len("first"), found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 1u);
+    sc_list_destroy(found_link_hashes);
+  };
+  checkStrings();
+
+  // new strings are written after compacted ones
+  sc_char string2[] = TEXT_EXAMPLE_2;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, STRING_COUNT, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  params.clear = SC_FALSE;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, &params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  checkStrings();
+  {
+    sc_char * found_string;
+    sc_uint64 size;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_string_by_link_hash(memory, STRING_COUNT, &found_string, &size), SC_FS_MEMORY_OK);
+    EXPECT_TRUE(sc_str_cmp(found_string, string2));
+    sc_mem_free(found_string);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_compact_strings_with_terms_index)
+{
+  sc_memory_params params;
+  params.storage = SC_DICTIONARY_FS_MEMORY_PATH;
+  params.clear = SC_TRUE;
+  params.max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
+  params.max_strings_channel_size = 1000;
+  params.max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
+  params.term_separators = DEFAULT_TERM_SEPARATORS;
+  params.search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params.compact_strings_min_unreferenced_percent = DEFAULT_COMPACT_STRINGS_MIN_UNREFERENCED_PERCENT;
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, &params), SC_FS_MEMORY_OK);
+
+  sc_char const string_template[] = "Indexed string number %" PRIu64;
+  sc_char string[50];
+
+  sc_uint64 const STRING_COUNT = 500;
+  for (sc_uint64 hash = 0; hash < STRING_COUNT; ++hash)
+  {
+    snprintf(string, 50, string_template, hash);
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+  }
+
+  // terms are merged into terms index, it is compacted without loading into memory
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_NE(memory->terms_string_offsets_index, nullptr);
+
+  for (sc_uint64 hash = 0; hash < STRING_COUNT; hash += 2)
+    EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, hash), SC_FS_MEMORY_OK);
+  sc_char added_string[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, STRING_COUNT, added_string, sc_str_len(added_string)),
+      SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_compact(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->unreferenced_strings_size, 0u);
+  EXPECT_EQ(memory->merged_terms_string_offsets_dictionary, nullptr);
+
+  auto const & checkStrings = [&]()
+  {
+    for (sc_uint64 hash = 0; hash < STRING_COUNT; ++hash)
+    {
+      snprintf(string, 50, string_template, hash);
+
+      sc_list * found_link_hashes;
+      sc_list_init(&found_link_hashes);
+      EXPECT_EQ(
+          sc_dictionary_fs_memory_get_link_hashes_by_string(
+              memory, string, sc_str_len(string), found_link_hashes, _test_push_link_hash),
+          SC_FS_MEMORY_OK);
+      EXPECT_EQ(found_link_hashes->size, hash % 2 == 0 ? 0u : 1u);
+      sc_list_destroy(found_link_hashes);
+    }
+
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(
+            memory, added_string, sc_str_len(added_string), found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 1u);
+    sc_list_destroy(found_link_hashes);
+  };
+  checkStrings();
+
+  // compaction saves terms index consistent with compacted strings channels
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  params.clear = SC_FALSE;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, &params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  // new strings are written after compacted ones
+  sc_char string2[] = TEXT_EXAMPLE_2;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, STRING_COUNT + 1, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+  checkStrings();
+
+  sc_char * found_string;
+  sc_uint64 size;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash(memory, STRING_COUNT + 1, &found_string, &size),
+      SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_str_cmp(found_string, string2));
+  sc_mem_free(found_string);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_compact_strings_below_threshold)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char string1[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  sc_char string2[] = TEXT_ABOUT_CAT_EXAMPLE_1;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 112), SC_FS_MEMORY_OK);
+
+  sc_uint64 const last_string_offset = memory->last_string_offset;
+  EXPECT_EQ(sc_dictionary_fs_memory_compact_ext(memory, 50), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, last_string_offset);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_compact_ext(memory, 0), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, sizeof(sc_uint64) + sc_str_len(string2));
+
+  sc_char * found_string;
+  sc_uint64 size;
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, 518, &found_string, &size), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_str_cmp(found_string, string2));
+  sc_mem_free(found_string);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_save_load_unreferenced_strings_size)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char string1[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  sc_char string2[] = TEXT_ABOUT_CAT_EXAMPLE_1;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 112), SC_FS_MEMORY_OK);
+
+  sc_uint64 const unreferenced_strings_size = memory->unreferenced_strings_size;
+  EXPECT_EQ(unreferenced_strings_size, sizeof(sc_uint64) + sc_str_len(string1));
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // compaction threshold isn't reset on restart
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->unreferenced_strings_size, unreferenced_strings_size);
+
+  sc_uint64 const last_string_offset = memory->last_string_offset;
+  EXPECT_EQ(sc_dictionary_fs_memory_compact_ext(memory, 0), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, last_string_offset - unreferenced_strings_size);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_recover_compaction)
+{
+  std::filesystem::path const path = SC_DICTIONARY_FS_MEMORY_PATH;
+  sc_char string[] = TEXT_ABOUT_CAT_EXAMPLE_1;
+
+  auto const & checkString = [&]()
+  {
+    sc_dictionary_fs_memory * memory;
+    EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+    sc_char * found_string;
+    sc_uint64 size;
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, 518, &found_string, &size), SC_FS_MEMORY_OK);
+    EXPECT_TRUE(sc_str_cmp(found_string, string));
+    sc_mem_free(found_string);
+    EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  };
+
+  {
+    sc_dictionary_fs_memory * memory;
+    EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  }
+
+  // compaction interrupted before commit is discarded
+  {
+    std::ofstream(path / "compacted_strings1.scdb") << "partially compacted strings";
+    std::ofstream(path / "string_offsets_link_hashes.scdb.compacted") << "partially written dictionary";
+  }
+  checkString();
+  EXPECT_FALSE(std::filesystem::exists(path / "compacted_strings1.scdb"));
+  EXPECT_FALSE(std::filesystem::exists(path / "string_offsets_link_hashes.scdb.compacted"));
+
+  // compaction interrupted after commit is completed
+  {
+    std::filesystem::rename(path / "strings1.scdb", path / "compacted_strings1.scdb");
+    std::filesystem::rename(
+        path / "string_offsets_link_hashes.scdb", path / "string_offsets_link_hashes.scdb.compacted");
+    std::ofstream(path / "strings2.scdb") << "uncompacted strings";
+    sc_uint64 const compacted_channels_count = 1;
+    std::ofstream(path / "strings_compaction.scdb", std::ios::binary)
+        .write(reinterpret_cast<char const *>(&compacted_channels_count), sizeof(compacted_channels_count));
+  }
+  checkString();
+  EXPECT_FALSE(std::filesystem::exists(path / "compacted_strings1.scdb"));
+  EXPECT_FALSE(std::filesystem::exists(path / "strings2.scdb"));
+  EXPECT_FALSE(std::filesystem::exists(path / "strings_compaction.scdb"));
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_link_file_path)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char file_path[] = "path/to/file.txt";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_file_path(memory, 112, file_path, sc_str_len(file_path)), SC_FS_MEMORY_OK);
+  sc_char string[] = "path/to/file.txt";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+  sc_char removed_string[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1024, removed_string, sc_str_len(removed_string)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 1024), SC_FS_MEMORY_OK);
+
+  auto const & checkContents = [&]()
+  {
+    sc_char * found_string;
+    sc_uint64 size;
+    sc_bool is_file_path;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_string_by_link_hash_ext(memory, 112, &found_string, &size, &is_file_path),
+        SC_FS_MEMORY_OK);
+    EXPECT_TRUE(is_file_path);
+    EXPECT_EQ(size, sc_str_len(file_path));
+    EXPECT_TRUE(sc_str_cmp(found_string, file_path));
+    sc_mem_free(found_string);
+
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_string_by_link_hash_ext(memory, 518, &found_string, &size, &is_file_path),
+        SC_FS_MEMORY_OK);
+    EXPECT_FALSE(is_file_path);
+    EXPECT_EQ(size, sc_str_len(string));
+    EXPECT_TRUE(sc_str_cmp(found_string, string));
+    sc_mem_free(found_string);
+
+    // file paths are not searchable
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(
+            memory, file_path, sc_str_len(file_path), found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 1u);
+    sc_iterator * it = sc_list_iterator(found_link_hashes);
+    EXPECT_TRUE(sc_iterator_next(it));
+    EXPECT_EQ((sc_pointer_to_sc_addr_hash)sc_iterator_get(it), 518u);
+    sc_iterator_destroy(it);
+    sc_list_destroy(found_link_hashes);
+  };
+  checkContents();
+
+  // file path kind is kept while compaction
+  EXPECT_EQ(sc_dictionary_fs_memory_compact_ext(memory, 0), SC_FS_MEMORY_OK);
+  checkContents();
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  checkContents();
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_migrate_file_paths)
+{
+  std::filesystem::path const path = SC_DICTIONARY_FS_MEMORY_PATH;
+  std::filesystem::create_directories(path);
+  std::filesystem::path const filePath = path / "content.txt";
+  std::ofstream(filePath) << "file content";
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  std::string const file_path = filePath.string();
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 112, file_path.c_str(), file_path.size()), SC_FS_MEMORY_OK);
+  sc_char string[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // strings channels saved in format version 1 have no strings meta and mark no file paths
+  std::filesystem::remove(path / "strings_meta.scdb");
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  sc_char * found_string;
+  sc_uint64 size;
+  sc_bool is_file_path;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash_ext(memory, 112, &found_string, &size, &is_file_path),
+      SC_FS_MEMORY_OK);
+  EXPECT_TRUE(is_file_path);
+  EXPECT_EQ(std::string(found_string, size), file_path);
+  sc_mem_free(found_string);
+
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash_ext(memory, 518, &found_string, &size, &is_file_path),
+      SC_FS_MEMORY_OK);
+  EXPECT_FALSE(is_file_path);
+  EXPECT_TRUE(sc_str_cmp(found_string, string));
+  sc_mem_free(found_string);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_load_unsupported_strings_format)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  sc_char string[] = TEXT_EXAMPLE_1;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  {
+    sc_uint32 const version = 100;
+    sc_uint64 const unreferenced_strings_size = 0;
+    std::ofstream meta(std::filesystem::path(SC_DICTIONARY_FS_MEMORY_PATH) / "strings_meta.scdb", std::ios::binary);
+    meta.write(reinterpret_cast<char const *>(&version), sizeof(version));
+    meta.write(reinterpret_cast<char const *>(&unreferenced_strings_size), sizeof(unreferenced_strings_size));
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_READ_ERROR);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_terms_index_save_load)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char string1[] = TEXT_EXAMPLE_1;
+  sc_addr_hash hash1 = 112;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash1, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  // terms are queried from mapped terms index
+  EXPECT_NE(memory->terms_string_offsets_index, nullptr);
+  EXPECT_EQ(sc_fs_memory_terms_index_get_terms_count(memory->terms_string_offsets_index), 5u);
+
+  sc_char string2[] = TEXT_EXAMPLE_2;
+  sc_addr_hash hash2 = 518;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash2, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+  // string saved in terms index isn't written again
+  sc_uint64 const last_string_offset = memory->last_string_offset;
+  sc_addr_hash hash3 = 1024;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash3, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, last_string_offset);
+
+  auto const & checkLinkHashes = [&](sc_char const * string, sc_bool isSubstring, sc_uint32 expectedSize)
+  {
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    if (isSubstring)
+      EXPECT_EQ(
+          sc_dictionary_fs_memory_get_link_hashes_by_substring(
+              memory, string, sc_str_len(string), found_link_hashes, _test_push_link_hash),
+          SC_FS_MEMORY_OK);
+    else
+      EXPECT_EQ(
+          sc_dictionary_fs_memory_get_link_hashes_by_string(
+              memory, string, sc_str_len(string), found_link_hashes, _test_push_link_hash),
+          SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, expectedSize);
+    sc_list_destroy(found_link_hashes);
+  };
+
+  checkLinkHashes("it", SC_TRUE, 3u);
+  checkLinkHashes("sec", SC_TRUE, 1u);
+  checkLinkHashes(string1, SC_FALSE, 2u);
+  checkLinkHashes(string2, SC_FALSE, 1u);
+
+  // new terms are merged into terms index
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_terms_index_get_terms_count(memory->terms_string_offsets_index), 6u);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_terms_index_get_terms_count(memory->terms_string_offsets_index), 6u);
+
+  checkLinkHashes("it", SC_TRUE, 3u);
+  checkLinkHashes("sec", SC_TRUE, 1u);
+  checkLinkHashes(string1, SC_FALSE, 2u);
+  checkLinkHashes(string2, SC_FALSE, 1u);
+
+  // strings offsets of terms index are remapped on compaction
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, hash1), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, hash3), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_compact_ext(memory, 0), SC_FS_MEMORY_OK);
+  EXPECT_NE(memory->terms_string_offsets_index, nullptr);
+
+  checkLinkHashes("it", SC_TRUE, 1u);
+  checkLinkHashes("sec", SC_TRUE, 1u);
+  checkLinkHashes(string2, SC_FALSE, 1u);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_number_range)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char const * strings[] = {"42", "-7.5", "1e3", "0x10", "3.14", "not a number", "12 apples", "nan", "inf", ""};
+  sc_addr_hash const hashes[] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+  for (sc_uint32 i = 0; i < 10; ++i)
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_link_string(memory, hashes[i], strings[i], sc_str_len(strings[i])), SC_FS_MEMORY_OK);
+
+  auto const & checkLinkHashes = [&](sc_double min, sc_double max, std::vector<sc_addr_hash> const & expectedHashes)
+  {
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_number_range(
+            memory, min, max, found_link_hashes, _test_push_link_hash),
+        expectedHashes.empty() ? SC_FS_MEMORY_NO_STRING : SC_FS_MEMORY_OK);
+
+    std::vector<sc_addr_hash> foundHashes;
+    sc_iterator * it = sc_list_iterator(found_link_hashes);
+    while (sc_iterator_next(it))
+      foundHashes.push_back((sc_pointer_to_sc_addr_hash)sc_iterator_get(it));
+    sc_iterator_destroy(it);
+    sc_list_destroy(found_link_hashes);
+
+    EXPECT_EQ(foundHashes, expectedHashes);
+  };
+
+  // sc-links are found in order of their values
+  checkLinkHashes(-100, 2000, {11, 14, 13, 10, 12});
+  checkLinkHashes(3.14, 42, {14, 13, 10});
+  checkLinkHashes(43, 999, {});
+  checkLinkHashes(10, 0, {});
+
+  // changed content moves sc-link in index and not numeric content removes it
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 10, "-10", 3), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 14, "pi", 2), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 13), SC_FS_MEMORY_OK);
+  checkLinkHashes(-100, 2000, {10, 11, 12});
+
+  // sc-links moved from delta run into larger runs stay ordered
+  for (sc_addr_hash hash = 100; hash < 3100; ++hash)
+  {
+    std::string const value = std::to_string(3100 - hash);
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash, value.c_str(), value.size()), SC_FS_MEMORY_OK);
+  }
+  for (sc_addr_hash hash = 100; hash < 3100; hash += 2)
+    EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, hash), SC_FS_MEMORY_OK);
+  checkLinkHashes(1, 6, {3099, 3097, 3095});
+  EXPECT_EQ(sc_fs_memory_numeric_index_get_size(memory->numeric_index), 1503u);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_numeric_index_get_size(memory->numeric_index), 1503u);
+  checkLinkHashes(-100, 6, {10, 11, 3099, 3097, 3095});
+  checkLinkHashes(1000, 1000, {12});
+
+  // numeric index is built from strings if it isn't saved
+  sc_char * numeric_index_path;
+  sc_str_cpy(numeric_index_path, memory->numeric_index_path, sc_str_len(memory->numeric_index_path));
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_remove_file(numeric_index_path));
+  sc_mem_free(numeric_index_path);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_fs_memory_numeric_index_get_size(memory->numeric_index), 1503u);
+  checkLinkHashes(-100, 6, {10, 11, 3099, 3097, 3095});
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_fs_memory_numeric_index_runs)
+{
+  sc_fs_memory_numeric_index * index = sc_fs_memory_numeric_index_new();
+
+  auto const & getLinkHashes = [&](sc_double min, sc_double max)
+  {
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    sc_fs_memory_numeric_index_get_link_hashes_by_range(index, min, max, found_link_hashes, _test_push_link_hash);
+
+    std::vector<sc_addr_hash> foundHashes;
+    sc_iterator * it = sc_list_iterator(found_link_hashes);
+    while (sc_iterator_next(it))
+      foundHashes.push_back((sc_pointer_to_sc_addr_hash)sc_iterator_get(it));
+    sc_iterator_destroy(it);
+    sc_list_destroy(found_link_hashes);
+    return foundHashes;
+  };
+
+  // sc-links are indexed in reverse order of values, so every delta run is merged into runs with smaller values
+  sc_addr_hash const LINKS_COUNT = 20000;
+  for (sc_addr_hash hash = 1; hash <= LINKS_COUNT; ++hash)
+  {
+    std::string const value = std::to_string(LINKS_COUNT - hash);
+    sc_fs_memory_numeric_index_update(index, hash, value.c_str(), value.size());
+  }
+
+  // removed sc-links are skipped in all runs and changed ones are moved
+  for (sc_addr_hash hash = 1; hash <= LINKS_COUNT; hash += 3)
+    sc_fs_memory_numeric_index_remove(index, hash);
+  for (sc_addr_hash hash = 2; hash <= LINKS_COUNT; hash += 30)
+    sc_fs_memory_numeric_index_update(index, hash, "-1", 2);
+
+  auto const & checkLinkHashes = [&]()
+  {
+    std::vector<sc_addr_hash> expectedHashes;
+    for (sc_addr_hash hash = 2; hash <= LINKS_COUNT; hash += 30)
+      expectedHashes.push_back(hash);
+    for (sc_addr_hash hash = LINKS_COUNT; hash >= 1; --hash)
+    {
+      if (hash % 3 != 1 && (hash < 2 || (hash - 2) % 30 != 0))
+        expectedHashes.push_back(hash);
+    }
+
+    EXPECT_EQ(sc_fs_memory_numeric_index_get_size(index), expectedHashes.size());
+    EXPECT_EQ(getLinkHashes(-1, LINKS_COUNT), expectedHashes);
+    EXPECT_EQ(getLinkHashes(10, 12), std::vector<sc_addr_hash>({19989, 19988}));
+  };
+  checkLinkHashes();
+
+  std::filesystem::create_directories(SC_DICTIONARY_FS_MEMORY_PATH);
+  std::string const path = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/numeric_index_runs.scdb";
+  EXPECT_EQ(sc_fs_memory_numeric_index_write(path.c_str(), 5, index), SC_FS_MEMORY_OK);
+  sc_fs_memory_numeric_index_destroy(index);
+
+  // numeric index saved with other sc-links strings isn't read
+  index = sc_fs_memory_numeric_index_new();
+  EXPECT_EQ(sc_fs_memory_numeric_index_read(path.c_str(), 4, index), SC_FS_MEMORY_READ_ERROR);
+  EXPECT_EQ(sc_fs_memory_numeric_index_get_size(index), 0u);
+
+  // saved sc-links are read into one run and new ones are merged with it
+  EXPECT_EQ(sc_fs_memory_numeric_index_read(path.c_str(), 5, index), SC_FS_MEMORY_OK);
+  checkLinkHashes();
+
+  sc_fs_memory_numeric_index_update(index, LINKS_COUNT + 1, "11.5", 4);
+  EXPECT_EQ(getLinkHashes(10, 12), std::vector<sc_addr_hash>({19989, LINKS_COUNT + 1, 19988}));
+
+  sc_fs_memory_numeric_index_destroy(index);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_fs_memory_numeric_index_read_broken_entries)
+{
+  sc_fs_memory_numeric_index * index = sc_fs_memory_numeric_index_new();
+  sc_fs_memory_numeric_index_update(index, 1, "1", 1);
+  sc_fs_memory_numeric_index_update(index, 2, "2", 1);
+  sc_fs_memory_numeric_index_update(index, 3, "3", 1);
+
+  std::filesystem::create_directories(SC_DICTIONARY_FS_MEMORY_PATH);
+  std::string const path = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/numeric_index_broken.scdb";
+  EXPECT_EQ(sc_fs_memory_numeric_index_write(path.c_str(), 1, index), SC_FS_MEMORY_OK);
+  sc_fs_memory_numeric_index_destroy(index);
+
+  std::string content;
+  {
+    std::ifstream file(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  // header consists of magic, version, entry size, entries count and strings save identifier
+  size_t const headerSize = 8 + sizeof(sc_uint32) * 2 + sizeof(sc_uint64) * 2;
+  sc_uint32 entrySize;
+  sc_mem_cpy(&entrySize, content.data() + 8 + sizeof(sc_uint32), sizeof(entrySize));
+  ASSERT_EQ(content.size(), headerSize + entrySize * 3);
+
+  auto const & checkBrokenEntries = [&](std::string const & brokenContent)
+  {
+    {
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      file.write(brokenContent.data(), (std::streamsize)brokenContent.size());
+    }
+
+    sc_fs_memory_numeric_index * brokenIndex = sc_fs_memory_numeric_index_new();
+    sc_fs_memory_numeric_index_update(brokenIndex, 4, "4", 1);
+    EXPECT_EQ(sc_fs_memory_numeric_index_read(path.c_str(), 1, brokenIndex), SC_FS_MEMORY_READ_ERROR);
+    // index isn't changed if its file is broken
+    EXPECT_EQ(sc_fs_memory_numeric_index_get_size(brokenIndex), 1u);
+    sc_fs_memory_numeric_index_destroy(brokenIndex);
+  };
+
+  // unsorted entries
+  std::string unsortedContent = content;
+  unsortedContent.replace(headerSize, entrySize, content, headerSize + entrySize, entrySize);
+  unsortedContent.replace(headerSize + entrySize, entrySize, content, headerSize, entrySize);
+  checkBrokenEntries(unsortedContent);
+
+  // duplicated entries
+  std::string duplicatedContent = content;
+  duplicatedContent.replace(headerSize + entrySize, entrySize, content, headerSize, entrySize);
+  checkBrokenEntries(duplicatedContent);
+
+  // sc-link with several values
+  std::string duplicatedLinkContent = content;
+  duplicatedLinkContent.replace(
+      headerSize + entrySize + sizeof(sc_double), sizeof(sc_addr_hash), content, headerSize + sizeof(sc_double),
+      sizeof(sc_addr_hash));
+  checkBrokenEntries(duplicatedLinkContent);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_numeric_index_stale)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 10, "5", 1), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+
+  std::filesystem::path const numericIndexPath = memory->numeric_index_path;
+  std::filesystem::path const previousNumericIndexPath = numericIndexPath.parent_path() / "previous_numeric_index";
+  std::filesystem::copy_file(numericIndexPath, previousNumericIndexPath);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 10, "7", 1), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 11, "6", 1), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // numeric index of the previous save is left with sc-links strings of the last one
+  std::filesystem::copy_file(
+      previousNumericIndexPath, numericIndexPath, std::filesystem::copy_options::overwrite_existing);
+  std::filesystem::remove(previousNumericIndexPath);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  // numeric index is rebuilt from saved sc-links strings
+  EXPECT_EQ(sc_fs_memory_numeric_index_get_size(memory->numeric_index), 2u);
+
+  sc_list * found_link_hashes;
+  sc_list_init(&found_link_hashes);
+  sc_fs_memory_numeric_index_get_link_hashes_by_range(
+      memory->numeric_index, 5, 7, found_link_hashes, _test_push_link_hash);
+  std::vector<sc_addr_hash> foundHashes;
+  sc_iterator * it = sc_list_iterator(found_link_hashes);
+  while (sc_iterator_next(it))
+    foundHashes.push_back((sc_pointer_to_sc_addr_hash)sc_iterator_get(it));
+  sc_iterator_destroy(it);
+  sc_list_destroy(found_link_hashes);
+  EXPECT_EQ(foundHashes, std::vector<sc_addr_hash>({11, 10}));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
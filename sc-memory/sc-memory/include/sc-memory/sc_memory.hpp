@@ -295,6 +295,29 @@ public:
    */
   _SC_EXTERN bool EraseElement(ScAddr const & elementAddr) noexcept(false);
 
+  /*!
+   * @brief Erases sc-elements from the sc-memory.
+   *
+   * This method erases the sc-elements identified by the given sc-addresses from the sc-memory as one batch. It is
+   * faster than erasing sc-elements one by one: the sc-elements connected with them are found once, and sc-elements
+   * are freed grouped by memory segments. Permissions are checked for all sc-elements before erasing any of them.
+   *
+   * @param elementAddrs A vector of sc-addresses of the sc-elements to erase.
+   * @return Returns true if all sc-elements were successfully erased; otherwise, returns false.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have erase permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddr const & nodeAddr1 = context.GenerateNode(ScType::ConstNode);
+   * ScAddr const & nodeAddr2 = context.GenerateNode(ScType::ConstNode);
+   * if (context.EraseElements({nodeAddr1, nodeAddr2}))
+   * {
+   *   // Elements successfully erased.
+   * }
+   * @endcode
+   */
+  _SC_EXTERN bool EraseElements(ScAddrVector const & elementAddrs) noexcept(false);
+
   /*!
    * @brief Generates a new sc-node with the specified type.
    *
@@ -631,6 +654,8 @@ public:
    * @brief Sets the content of an sc-link with a stream.
    *
    * This method sets the content of an sc-link identified by the given sc-address using the provided stream.
+   * If the stream is `ScStreamMappedFile`, then only the path to its file is stored, and the content is mapped from
+   * this file when it is got.
    *
    * @param linkAddr A sc-address of the sc-link.
    * @param contentStream A stream containing the content.
@@ -728,6 +753,7 @@ public:
    * @return Returns a shared pointer to the stream containing the content.
    * @throws ExceptionInvalidParams if the specified sc-address is invalid.
    * @throws ExceptionInvalidState if the file memory state is invalid.
+   * @throws ExceptionInvalidState if the file with the sc-link content can't be mapped into memory.
    * @throws ExceptionInvalidState if the sc-memory context is not authenticated or does not have read permissions.
    */
   _SC_EXTERN ScStreamPtr GetLinkContent(ScAddr const & linkAddr) noexcept(false);
@@ -959,6 +985,30 @@ public:
       ScStreamPtr const & linkContentSubstringStream,
       size_t maxLengthToSearchAsPrefix = 0) noexcept(false);
 
+  /*!
+   * @brief Searches sc-links with numeric contents in the specified range.
+   *
+   * This method finds sc-links which contents are numbers from the closed range [minValue; maxValue]. Numeric contents
+   * are kept in ordered index, so found sc-links are returned in ascending order of their values. Contents set by
+   * `ScLink::Set` and `SetLinkContent` with numbers are indexed as well as string contents that are numbers.
+   *
+   * @param minValue The minimal value of the range.
+   * @param maxValue The maximal value of the range.
+   * @return Returns a vector of sc-addresses representing the found sc-links ordered by their values.
+   * @throws ExceptionInvalidState if the file memory state is invalid.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddrVector const & linkVector = context.SearchLinksByContentRange(18, 65);
+   * for (auto const & linkAddr : linkVector)
+   * {
+   *   // Process sc-links.
+   * }
+   * @endcode
+   */
+  _SC_EXTERN ScAddrVector SearchLinksByContentRange(double minValue, double maxValue) noexcept(false);
+
   /*!
    * @brief Searches sc-links contents by content substring using a stream.
    *
@@ -2393,6 +2443,48 @@ public:
    */
   _SC_EXTERN bool Save();
 
+  /*!
+   * @brief Exports an sc-structure to a stream in binary format.
+   *
+   * This method writes the sc-structure, all its sc-elements and incident sc-elements of its sc-connectors with their
+   * sc-types, system identifiers and contents of sc-links. Sc-connectors refer to their incident sc-elements by local
+   * indices, so the sc-structure can be imported into another sc-memory. Constructions of system identifiers aren't
+   * written, they are generated by `ImportStructure`. Data is written by chunks in one pass.
+   *
+   * @param structureAddr A sc-address of the sc-structure to export.
+   * @param stream A writable stream to write the sc-structure to.
+   * @throws ExceptionInvalidParams if the specified sc-address or stream is invalid.
+   * @throws ExceptionInvalidState if the stream can't be written or the sc-memory context does not have read
+   * permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScStreamPtr stream = std::make_shared<ScStream>("structure.scsb", SC_STREAM_FLAG_WRITE);
+   * context.ExportStructure(structureAddr, stream);
+   * @endcode
+   */
+  _SC_EXTERN void ExportStructure(ScAddr const & structureAddr, ScStreamPtr const & stream) noexcept(false);
+
+  /*!
+   * @brief Imports an sc-structure from a stream in binary format.
+   *
+   * This method reads the sc-structure exported by `ExportStructure` and generates its sc-elements in one pass.
+   * Sc-elements with system identifiers that already exist in sc-memory are reused, other sc-elements are generated.
+   *
+   * @param stream A readable stream to read the sc-structure from.
+   * @return Returns a sc-address of the imported sc-structure.
+   * @throws ExceptionInvalidParams if the specified stream is invalid.
+   * @throws ExceptionParseError if the stream doesn't contain the sc-structure in binary format.
+   * @throws ExceptionInvalidState if the sc-memory context does not have write permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScStreamPtr stream = std::make_shared<ScStream>("structure.scsb", SC_STREAM_FLAG_READ);
+   * ScAddr const & structureAddr = context.ImportStructure(stream);
+   * @endcode
+   */
+  _SC_EXTERN ScAddr ImportStructure(ScStreamPtr const & stream) noexcept(false);
+
 protected:
   _SC_EXTERN explicit ScMemoryContext(ScAddr const & userAddr) noexcept;
 
@@ -7,6 +7,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "sc_addr.hpp"
 
@@ -23,6 +26,23 @@ using SCsFileInterfacePtr = std::shared_ptr<SCsFileInterface>;
 
 class ScMemoryContext;
 
+namespace scs
+{
+class Parser;
+}
+
+namespace impl
+{
+class StructGenerator;
+}
+
+/*!
+ * Generates sc-elements by SCs-texts. Sc-elements with system and global identifiers are resolved once per helper:
+ * their addresses and identifier constructions are cached and reused by all next SCs-texts generated by the same
+ * helper. Sc-connectors from output structure to appended sc-elements are cached too. Caches are cleared when any
+ * sc-element is erased from sc-memory, otherwise cached sc-elements are reused without checks, so sc-links with
+ * identifiers mustn't be changed by others while helper is used.
+ */
 class SCsHelper final
 {
 public:
@@ -30,11 +50,38 @@ public:
 
   _SC_EXTERN bool GenerateBySCsText(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
   _SC_EXTERN void GenerateBySCsTextLazy(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
+
+  /*! Generates elements of already parsed SCs-text. Parsing doesn't use sc-memory, so SCs-texts can be parsed in
+   * parallel and generated one by one.
+   * @param parser Parser that has parsed SCs-text.
+   * @param outputStructure Structure that generated elements are added to.
+   * @param generatedElements If it isn't nullptr, then sc-connectors of triples and generated sc-elements without
+   * system and global identifiers are appended to it. These sc-elements belong only to this SCs-text, other sc-elements
+   * can be shared with other SCs-texts.
+   * @returns true, if elements are generated; otherwise false, and error is available by `GetLastError`.
+   */
+  _SC_EXTERN bool GenerateByParsedSCs(
+      scs::Parser const & parser,
+      ScAddr const & outputStructure = ScAddr::Empty,
+      ScAddrVector * generatedElements = nullptr);
+
   _SC_EXTERN std::string const & GetLastError() const;
 
 private:
+  friend class impl::StructGenerator;
+
   ScMemoryContext & m_ctx;
 
   SCsFileInterfacePtr m_fileInterface;
   std::string m_lastError;
+
+  // count of sc-elements erased from sc-memory when caches have been checked last time
+  sc_uint32 m_erasedElementsCount;
+
+  // identifier -> sc-element with this system or global identifier and sc-elements of identifier construction
+  std::unordered_map<std::string, std::pair<ScAddr, ScAddrVector>> m_identifiersCache;
+
+  // appended sc-element of output structure -> sc-connector from output structure to it
+  ScAddr m_outputStructure;
+  ScAddrToValueUnorderedMap<ScAddr> m_outputStructureElements;
 };
@@ -50,6 +50,9 @@ public:
   //! Check if stream has a specified flag
   _SC_EXTERN bool HasFlag(sc_uint8 flag);
 
+  //! Returns stream data without copying, if stream supports it
+  _SC_EXTERN bool View(sc_char const *& data, size_t & size) const;
+
   template <typename Type>
   bool ReadType(Type & value)
   {
@@ -73,6 +76,13 @@ private:
   MemoryBufferPtr m_buffer;
 };
 
+class ScStreamMappedFile : public ScStream
+{
+public:
+  //! Maps file into memory for reading. Stream is invalid, if file can't be mapped
+  _SC_EXTERN explicit ScStreamMappedFile(std::string const & fileName);
+};
+
 class ScStreamConverter
 {
 public:
@@ -25,12 +25,18 @@ namespace scs
 class Parser;
 }  // namespace scs
 
+namespace impl
+{
+class ScStructureBinaryReader;
+}  // namespace impl
+
 class _SC_EXTERN ScType
 {
   friend class ScMemoryContext;
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
   friend class scs::Parser;
+  friend class impl::ScStructureBinaryReader;
   friend class ScMemoryGenerateElementsJsonAction;
   friend class ScMemoryHandleKeynodesJsonAction;
   friend class ScMemoryMakeTemplateJsonAction;
@@ -102,6 +102,7 @@ struct ParsedTriple
 class Parser
 {
   friend class scsParser;
+  friend class FastParser;
 
   // Number of parsed elements, to preallocate container
   static const size_t PARSED_PREALLOC_NUM = 1024;
@@ -149,7 +150,7 @@ protected:
 
 private:
   ElementHandle AppendElement(
-      std::string idtf,
+      std::string const & idtf,
       ScType const & type = ScType::Unknown,
       bool isConnectorReversed = false,
       std::string const & value = "",
@@ -10,19 +10,38 @@
 
 #include "sc-memory/sc_structure.hpp"
 
+#include <mutex>
+
+namespace
+{
+
+// Modules with the same priority are registered concurrently. The first of them resolves keynodes of all loaded modules
+// in one batch, others wait until it is finished. Lock is recursive, because keynodes can be forgotten while resolving.
+// It is created on first use, because keynodes are remembered while static objects are initialized.
+std::recursive_mutex & GetKeynodesLock()
+{
+  static std::recursive_mutex keynodesLock;
+  return keynodesLock;
+}
+
+}  // namespace
+
 void internal::ScKeynodesRegister::Remember(ScKeynode * keynode)
 {
+  std::lock_guard<std::recursive_mutex> lock(GetKeynodesLock());
   m_notInitializedKeynodes.push_back(keynode);
 }
 
 void internal::ScKeynodesRegister::Forget(ScKeynode * keynode)
 {
+  std::lock_guard<std::recursive_mutex> lock(GetKeynodesLock());
   m_notInitializedKeynodes.remove(keynode);
   m_initializedKeynodes.remove(keynode);
 }
 
 void internal::ScKeynodesRegister::Register(ScMemoryContext * context)
 {
+  std::lock_guard<std::recursive_mutex> lock(GetKeynodesLock());
   for (auto * keynode : m_notInitializedKeynodes)
     keynode->Initialize(context);
 
@@ -31,6 +50,7 @@ void internal::ScKeynodesRegister::Register(ScMemoryContext * context)
 
 void internal::ScKeynodesRegister::Unregister(ScMemoryContext *)
 {
+  std::lock_guard<std::recursive_mutex> lock(GetKeynodesLock());
   m_notInitializedKeynodes.splice(m_notInitializedKeynodes.cend(), m_initializedKeynodes);
 }
 
@@ -12,6 +12,8 @@
 
 #include "sc-memory/utils/sc_log.hpp"
 
+#include "sc_structure_binary.hpp"
+
 extern "C"
 {
 #include <glib.h>
@@ -340,6 +342,40 @@ bool ScMemoryContext::EraseElement(ScAddr const & elementAddr)
   return result == SC_RESULT_OK;
 }
 
+bool ScMemoryContext::EraseElements(ScAddrVector const & elementAddrs)
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_addr> addrs;
+  addrs.reserve(elementAddrs.size());
+  for (ScAddr const & elementAddr : elementAddrs)
+    addrs.push_back(*elementAddr);
+
+  sc_result const result = sc_memory_elements_free(m_context, addrs.data(), (sc_uint32)addrs.size());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to erase sc-elements because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to erase sc-elements because sc-memory context hasn't erase permissions.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_ERASE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to erase sc-elements because sc-memory context hasn't permissions to erase permissions.");
+
+  default:
+    break;
+  }
+
+  return result == SC_RESULT_OK;
+}
+
 ScAddr ScMemoryContext::GenerateNode(ScType const & nodeType)
 {
   CHECK_CONTEXT;
@@ -706,6 +742,9 @@ ScStreamPtr ScMemoryContext::GetLinkContent(ScAddr const & linkAddr)
   case SC_RESULT_ERROR_FILE_MEMORY_IO:
     SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File memory state is invalid to get content.");
 
+  case SC_RESULT_ERROR_STREAM_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File with sc-link content can't be mapped to get content.");
+
   case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
     SC_THROW_EXCEPTION(
         utils::ExceptionInvalidState, "Not able to get content because sc-memory context is not authorized.");
@@ -836,6 +875,45 @@ ScAddrVector ScMemoryContext::FindLinksByContentSubstring(
   return {linkSet.cbegin(), linkSet.cend()};
 }
 
+void _PushLinkAddrInOrder(void * _data, sc_addr const link_addr)
+{
+  void ** data = ((void **)_data);
+  auto * context = (sc_memory_context *)data[0];
+
+  if (sc_memory_check_read_local_and_global_permissions(context, link_addr) == SC_FALSE)
+    return;
+
+  auto * linkVector = (ScAddrVector *)data[1];
+  linkVector->emplace_back(link_addr);
+}
+
+ScAddrVector ScMemoryContext::SearchLinksByContentRange(double minValue, double maxValue)
+{
+  CHECK_CONTEXT;
+
+  ScAddrVector linkVector;
+  void ** data = _MAKE_DATA(&*m_context, &linkVector);
+  sc_result const result =
+      sc_memory_find_links_by_content_range_ext(m_context, minValue, maxValue, data, _PushLinkAddrInOrder);
+  _ERASE_DATA(data);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_FILE_MEMORY_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File memory state is invalid to find sc-links by content range.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to find sc-links by content range because sc-memory context is not authorized.");
+
+  default:
+    break;
+  }
+
+  return linkVector;
+}
+
 void _PushLinkContent(void * data, sc_addr const, sc_char const * link_content)
 {
   auto * linkContentList = (std::set<std::string> *)data;
@@ -960,7 +1038,12 @@ bool ScMemoryContext::ResolveElementSystemIdentifier(
   if (result)
     return result;
 
+  // system identifier may be set by other thread after it is searched, then sc-element with it is resolved
   EraseElement(resultAddr);
+  result = SearchElementBySystemIdentifier(systemIdentifier, outQuintuple);
+  if (result)
+    return result;
+
   outQuintuple =
       (ScSystemIdentifierQuintuple){ScAddr::Empty, ScAddr::Empty, ScAddr::Empty, ScAddr::Empty, ScAddr::Empty};
 
@@ -1361,4 +1444,21 @@ bool ScMemoryContext::Save()
   return result == SC_RESULT_OK;
 }
 
+void ScMemoryContext::ExportStructure(ScAddr const & structureAddr, ScStreamPtr const & stream)
+{
+  CHECK_CONTEXT;
+
+  if (!IsElement(structureAddr))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-structure sc-address is invalid to export it.");
+
+  impl::ScStructureBinaryWriter(*this, stream).Write(structureAddr);
+}
+
+ScAddr ScMemoryContext::ImportStructure(ScStreamPtr const & stream)
+{
+  CHECK_CONTEXT;
+
+  return impl::ScStructureBinaryReader(*this, stream).Read();
+}
+
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
@@ -17,6 +17,11 @@
 
 #include "sc-memory/scs/scs_parser.hpp"
 
+extern "C"
+{
+#include "sc-core/sc_memory.h"
+}
+
 namespace impl
 {
 class StructGenerator
@@ -24,15 +29,29 @@ class StructGenerator
   friend class ::SCsHelper;
 
 protected:
-  StructGenerator(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface, ScAddr const & outputStructure)
-    : m_ctx(ctx)
-    , m_fileInterface(std::move(fileInterface))
+  StructGenerator(SCsHelper & helper, ScAddr const & outputStructure, ScAddrVector * generatedElements = nullptr)
+    : m_ctx(helper.m_ctx)
+    , m_fileInterface(helper.m_fileInterface)
     , m_outputStructure(outputStructure)
+    , m_generatedElements(generatedElements)
+    , m_erasedElementsCount(helper.m_erasedElementsCount)
+    , m_identifiersCache(helper.m_identifiersCache)
+    , m_outputStructureElements(helper.m_outputStructureElements)
+    , m_isIdentifiersCacheComplete(false)
   {
+    // sc-elements of output structure are cached when they are appended to it, so structure isn't iterated
+    if (m_outputStructure.IsValid() && m_outputStructure != helper.m_outputStructure)
+    {
+      helper.m_outputStructure = m_outputStructure;
+      m_outputStructureElements.clear();
+    }
   }
 
   void operator()(scs::Parser const & parser)
   {
+    ResolveIdentifiers(parser);
+    m_isIdentifiersCacheComplete = true;
+
     // generate aliases
     auto const & aliases = parser.GetAliases();
     for (auto const & it : aliases)
@@ -58,6 +77,8 @@ protected:
 
       ScAddr const arcAddr = m_ctx.GenerateConnector(connector.GetType(), srcAddrResult.first, trgAddrResult.first);
       m_idtfCache.insert({connector.GetIdtf(), arcAddr});
+      if (m_generatedElements != nullptr)
+        m_generatedElements->push_back(arcAddr);
 
       if (m_outputStructure.IsValid())
       {
@@ -80,11 +101,71 @@ private:
   template <class... Args>
   void AppendToOutputStructure(Args const &... addrs)
   {
+    ClearCachesIfErased();
+
     ScAddrVector const & addrVector{addrs...};
     for (ScAddr const & addr : addrVector)
     {
-      if (!m_ctx.CheckConnector(m_outputStructure, addr, ScType::ConstPermPosArc))
-        m_ctx.GenerateConnector(ScType::ConstPermPosArc, m_outputStructure, addr);
+      ScAddr & arcAddr = m_outputStructureElements[addr];
+      if (arcAddr.IsValid())
+        continue;
+
+      ScIterator3Ptr const it3 = m_ctx.CreateIterator3(m_outputStructure, ScType::ConstPermPosArc, addr);
+      arcAddr = it3->Next() ? it3->Get(1) : m_ctx.GenerateConnector(ScType::ConstPermPosArc, m_outputStructure, addr);
+    }
+  }
+
+  /*!
+   * Cached sc-elements and their sc-connectors may be erased and their addresses may be reused by others, so caches
+   * are cleared if any sc-element has been erased since they have been checked last time. It costs one atomic load.
+   * @returns true, if caches have been cleared.
+   */
+  bool ClearCachesIfErased()
+  {
+    sc_uint32 const erasedElementsCount = sc_memory_get_erased_elements_count();
+    if (erasedElementsCount == m_erasedElementsCount)
+      return false;
+
+    m_erasedElementsCount = erasedElementsCount;
+    m_identifiersCache.clear();
+    m_outputStructureElements.clear();
+    m_isIdentifiersCacheComplete = false;
+    return true;
+  }
+
+  //! Finds sc-elements by all system and global identifiers of SCs-text that aren't cached yet
+  void ResolveIdentifiers(scs::Parser const & parser)
+  {
+    ClearCachesIfErased();
+
+    parser.ForEachParsedElement(
+        [this](scs::ParsedElement const & el)
+        {
+          if (el.GetVisibility() == scs::Visibility::Local || el.GetType().IsConnector()
+              || scs::TypeResolver::IsKeynodeType(el.GetIdtf()))
+            return;
+
+          if (m_identifiersCache.find(el.GetIdtf()) == m_identifiersCache.cend())
+            FindByIdentifier(el);
+        });
+  }
+
+  //! Finds sc-element by its system or global identifier and caches it, if it exists
+  void FindByIdentifier(scs::ParsedElement const & el)
+  {
+    std::string const & idtf = el.GetIdtf();
+    if (el.GetVisibility() == scs::Visibility::System)
+    {
+      ScSystemIdentifierQuintuple quintuple;
+      if (m_ctx.SearchElementBySystemIdentifier(idtf, quintuple))
+        m_identifiersCache.insert(
+            {idtf, {quintuple.addr1, {quintuple.addr2, quintuple.addr3, quintuple.addr4, quintuple.addr5}}});
+    }
+    else
+    {
+      auto const & found = FindBySCsGlobalIdtf(idtf);
+      if (found.first.IsValid())
+        m_identifiersCache.insert({idtf, found});
     }
   }
 
@@ -101,30 +182,22 @@ private:
     return {linkAddr, arcAddr, relAddr};
   }
 
-  ScAddr FindBySCsGlobalIdtf(std::string const & idtf) const
+  std::pair<ScAddr, ScAddrVector> FindBySCsGlobalIdtf(std::string const & idtf) const
   {
-    ScAddr result;
+    std::pair<ScAddr, ScAddrVector> result;
 
     auto const links = m_ctx.SearchLinksByContent(idtf);
     for (ScAddr const & addr : links)
     {
-      ScTemplate templ;
-
-      templ.Quintuple(
-          ScType::Unknown >> "_el",
-          ScType::VarCommonArc,
-          addr,
-          ScType::VarPermPosArc,
-          ScKeynodes::nrel_scs_global_idtf);
-
-      ScTemplateSearchResult searchResult;
-      if (m_ctx.SearchByTemplate(templ, searchResult))
+      ScIterator5Ptr const it5 = m_ctx.CreateIterator5(
+          ScType::Unknown, ScType::ConstCommonArc, addr, ScType::ConstPermPosArc, ScKeynodes::nrel_scs_global_idtf);
+      while (it5->Next())
       {
-        if (result.IsValid() || searchResult.Size() > 1)
+        if (result.first.IsValid())
           SC_THROW_EXCEPTION(
               utils::ExceptionInvalidState, "There are more then 1 element with global identifier: " << idtf);
 
-        result = searchResult[0]["_el"];
+        result = {it5->Get(0), {addr, it5->Get(1), it5->Get(3)}};
       }
     }
 
@@ -141,16 +214,26 @@ private:
       resultAddr = it->second;
     else
     {
-      // try to find existing
-      if (el.GetVisibility() == scs::Visibility::System)
+      // existing sc-elements with identifiers are already found, unless caches have been cleared since then
+      if (el.GetVisibility() != scs::Visibility::Local)
       {
-        ScSystemIdentifierQuintuple quintuple;
-        m_ctx.SearchElementBySystemIdentifier(el.GetIdtf(), quintuple);
-        resultAddr = quintuple.addr1;
-        result = {quintuple.addr2, quintuple.addr3, quintuple.addr4, quintuple.addr5};
+        ClearCachesIfErased();
+
+        auto identifierIt = m_identifiersCache.find(idtf);
+        if (identifierIt == m_identifiersCache.cend() && !m_isIdentifiersCacheComplete)
+        {
+          FindByIdentifier(el);
+          identifierIt = m_identifiersCache.find(idtf);
+        }
+
+        // found sc-elements with global identifiers are resolved without identifier construction
+        if (identifierIt != m_identifiersCache.cend())
+        {
+          resultAddr = identifierIt->second.first;
+          if (el.GetVisibility() == scs::Visibility::System)
+            result = identifierIt->second.second;
+        }
       }
-      else if (el.GetVisibility() == scs::Visibility::Global)
-        resultAddr = FindBySCsGlobalIdtf(el.GetIdtf());
 
       // generate new one
       if (!resultAddr.IsValid())
@@ -169,6 +252,9 @@ private:
         else
           SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Incorrect element type at this state.");
 
+        if (m_generatedElements != nullptr && el.GetVisibility() == scs::Visibility::Local)
+          m_generatedElements->push_back(resultAddr);
+
         // setup system identifier
         if (el.GetVisibility() == scs::Visibility::System)
         {
@@ -180,6 +266,9 @@ private:
         {
           result = SetSCsGlobalIdtf(el.GetIdtf(), resultAddr);
         }
+
+        if (el.GetVisibility() != scs::Visibility::Local)
+          m_identifiersCache.insert({idtf, {resultAddr, result}});
       }
       else
       {
@@ -280,8 +369,14 @@ private:
   ScMemoryContext & m_ctx;
   SCsFileInterfacePtr m_fileInterface;
   ScAddr m_outputStructure;
+  ScAddrVector * m_generatedElements;
 
   std::unordered_map<std::string, ScAddr> m_idtfCache;
+  sc_uint32 & m_erasedElementsCount;
+  std::unordered_map<std::string, std::pair<ScAddr, ScAddrVector>> & m_identifiersCache;
+  ScAddrToValueUnorderedMap<ScAddr> & m_outputStructureElements;
+  // all identifiers of SCs-text have been searched since caches have been cleared last time
+  bool m_isIdentifiersCacheComplete;
 };
 
 }  // namespace impl
@@ -289,6 +384,7 @@ private:
 SCsHelper::SCsHelper(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface)
   : m_ctx(ctx)
   , m_fileInterface(std::move(fileInterface))
+  , m_erasedElementsCount(sc_memory_get_erased_elements_count())
 {
 }
 
@@ -309,7 +405,7 @@ bool SCsHelper::GenerateBySCsText(std::string const & scsText, ScAddr const & ou
     }
     else
     {
-      impl::StructGenerator generate(m_ctx, m_fileInterface, outputStructure);
+      impl::StructGenerator generate(*this, outputStructure);
       generate(parser);
     }
   }
@@ -331,9 +427,32 @@ void SCsHelper::GenerateBySCsTextLazy(std::string const & scsText, ScAddr const
     SC_THROW_EXCEPTION(utils::ExceptionParseError, parser.GetParseError());
   else
   {
-    impl::StructGenerator generate(m_ctx, m_fileInterface, outputStructure);
+    impl::StructGenerator generate(*this, outputStructure);
+    generate(parser);
+  }
+}
+
+bool SCsHelper::GenerateByParsedSCs(
+    scs::Parser const & parser,
+    ScAddr const & outputStructure,
+    ScAddrVector * generatedElements)
+{
+  m_lastError = "";
+
+  ScMemoryContextEventsPendingGuard guard(m_ctx);
+
+  try
+  {
+    impl::StructGenerator generate(*this, outputStructure, generatedElements);
     generate(parser);
   }
+  catch (utils::ScException const & ex)
+  {
+    m_lastError = ex.Description();
+    return false;
+  }
+
+  return true;
 }
 
 std::string const & SCsHelper::GetLastError() const
@@ -6,6 +6,8 @@
 
 #include "sc-memory/sc_stream.hpp"
 
+#include <algorithm>
+
 namespace
 {
 #define CHECK_STREAM SC_ASSERT(IsValid(), "Used stream is invalid. Make sure that it's initialized")
@@ -117,6 +119,16 @@ bool ScStream::HasFlag(sc_uint8 flag)
   return (sc_stream_check_flag(m_stream, flag) == SC_TRUE);
 }
 
+bool ScStream::View(sc_char const *& data, size_t & size) const
+{
+  CHECK_STREAM;
+
+  sc_uint32 viewSize = 0;
+  bool const res = sc_stream_get_view(m_stream, &data, &viewSize) == SC_RESULT_OK;
+  size = (size_t)viewSize;
+  return res;
+}
+
 // ---------------
 
 ScStreamMemory::ScStreamMemory(MemoryBufferPtr const & buff)
@@ -127,6 +139,13 @@ ScStreamMemory::ScStreamMemory(MemoryBufferPtr const & buff)
 
 ScStreamMemory::~ScStreamMemory() = default;
 
+// ---------------
+
+ScStreamMappedFile::ScStreamMappedFile(std::string const & fileName)
+  : ScStream(sc_stream_mapped_file_new(fileName.c_str()))
+{
+}
+
 // --------------------------------
 bool ScStreamConverter::StreamToString(ScStreamPtr const & stream, std::string & outString)
 {
@@ -134,14 +153,24 @@ bool ScStreamConverter::StreamToString(ScStreamPtr const & stream, std::string &
   if (bytesCount == 0)
     return false;
 
-  char * data = new char[bytesCount];
-  size_t readBytes;
-  if (stream->Read(data, bytesCount, readBytes) && (readBytes == bytesCount))
-    outString.assign(data, data + bytesCount);
-
-  delete[] data;
-
-  return true;
+  // data is converted from current position of stream to its end
+  size_t const position = std::min(stream->Pos(), bytesCount);
+  sc_char const * view = nullptr;
+  size_t viewSize = 0;
+  if (stream->View(view, viewSize) && view != nullptr)
+  {
+    viewSize = std::min(viewSize, bytesCount);
+    outString.assign(view + std::min(position, viewSize), view + viewSize);
+    stream->Seek(SC_STREAM_SEEK_SET, viewSize);
+    return true;
+  }
+
+  outString.resize(bytesCount - position);
+  size_t readBytes = 0;
+  bool const result = stream->Read(outString.data(), outString.size(), readBytes);
+  outString.resize(readBytes);
+
+  return result;
 }
 
 ScStreamPtr ScStreamConverter::StreamFromString(std::string const & str)
@@ -0,0 +1,356 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_structure_binary.hpp"
+
+#include "sc-memory/sc_memory.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace impl
+{
+
+ScStructureBinaryWriter::ScStructureBinaryWriter(ScMemoryContext & context, ScStreamPtr const & stream)
+  : m_context(context)
+  , m_stream(stream)
+{
+  if (!m_stream || !m_stream->IsValid() || !m_stream->HasFlag(SC_STREAM_FLAG_WRITE))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified stream is invalid to write sc-structure.");
+
+  m_buffer.reserve(ScStructureBinaryFormat::kBufferSize);
+}
+
+void ScStructureBinaryWriter::Write(ScAddr const & structureAddr)
+{
+  ScAddrVector structureElements;
+  CollectStructureElements(structureAddr, structureElements);
+
+  WriteBytes(ScStructureBinaryFormat::kMagic, sizeof(ScStructureBinaryFormat::kMagic));
+  WriteValue(ScStructureBinaryFormat::kVersion);
+
+  WriteElement(structureAddr);
+  for (ScAddr const & elementAddr : structureElements)
+  {
+    if (m_systemIdentifiersElements.find(elementAddr) == m_systemIdentifiersElements.cend())
+      WriteElement(elementAddr);
+  }
+
+  WriteValue<sc_uint8>(ScStructureBinaryFormat::End);
+  Flush();
+}
+
+void ScStructureBinaryWriter::CollectStructureElements(
+    ScAddr const & structureAddr,
+    ScAddrVector & structureElements)
+{
+  ScIterator3Ptr const it3 = m_context.CreateIterator3(structureAddr, ScType::ConstPermPosArc, ScType::Unknown);
+  while (it3->Next())
+  {
+    ScAddr const & elementAddr = it3->Get(2);
+    if (m_structureElements.insert(elementAddr).second)
+      structureElements.push_back(elementAddr);
+  }
+
+  for (ScAddr const & elementAddr : structureElements)
+  {
+    std::string const & systemIdentifier = m_context.GetElementSystemIdentifier(elementAddr);
+    if (systemIdentifier.empty())
+      continue;
+
+    ScSystemIdentifierQuintuple quintuple;
+    if (!m_context.SearchElementBySystemIdentifier(systemIdentifier, quintuple) || quintuple.addr1 != elementAddr)
+      continue;
+
+    m_systemIdentifiersElements.insert(quintuple.addr2);
+    m_systemIdentifiersElements.insert(quintuple.addr3);
+    m_systemIdentifiersElements.insert(quintuple.addr4);
+  }
+}
+
+void ScStructureBinaryWriter::WriteElement(ScAddr const & elementAddr)
+{
+  // incident sc-elements of sc-connectors are written before them, explicit stack is used for long chains of
+  // sc-connectors
+  ScAddrVector elementsToWrite = {elementAddr};
+  while (!elementsToWrite.empty())
+  {
+    ScAddr const addr = elementsToWrite.back();
+    if (m_indices.find(addr) != m_indices.cend())
+    {
+      elementsToWrite.pop_back();
+      continue;
+    }
+
+    if (m_context.GetElementType(addr).IsConnector())
+    {
+      auto const [sourceAddr, targetAddr] = m_context.GetConnectorIncidentElements(addr);
+      bool const isTargetWritten = m_indices.find(targetAddr) != m_indices.cend();
+      bool const isSourceWritten = m_indices.find(sourceAddr) != m_indices.cend();
+      if (!isTargetWritten)
+        elementsToWrite.push_back(targetAddr);
+      if (!isSourceWritten)
+        elementsToWrite.push_back(sourceAddr);
+      if (!isTargetWritten || !isSourceWritten)
+        continue;
+    }
+
+    WriteRecord(addr);
+    elementsToWrite.pop_back();
+  }
+}
+
+void ScStructureBinaryWriter::WriteRecord(ScAddr const & elementAddr)
+{
+  ScType const & elementType = m_context.GetElementType(elementAddr);
+  std::string const & systemIdentifier = m_context.GetElementSystemIdentifier(elementAddr);
+  std::string content;
+  if (elementType.IsLink())
+    m_context.GetLinkContent(elementAddr, content);
+
+  sc_uint8 flags = 0;
+  if (m_structureElements.find(elementAddr) != m_structureElements.cend()
+      && m_systemIdentifiersElements.find(elementAddr) == m_systemIdentifiersElements.cend())
+    flags |= ScStructureBinaryFormat::IsStructureElement;
+  if (!systemIdentifier.empty())
+    flags |= ScStructureBinaryFormat::HasSystemIdentifier;
+  if (!content.empty())
+    flags |= ScStructureBinaryFormat::HasContent;
+
+  ScStructureBinaryFormat::RecordTag tag = ScStructureBinaryFormat::Node;
+  if (elementType.IsLink())
+    tag = ScStructureBinaryFormat::Link;
+  else if (elementType.IsConnector())
+    tag = ScStructureBinaryFormat::Connector;
+
+  WriteValue<sc_uint8>(tag);
+  WriteValue<sc_uint16>(*elementType);
+  WriteValue<sc_uint8>(flags);
+
+  if (!systemIdentifier.empty())
+  {
+    WriteValue<sc_uint32>(systemIdentifier.size());
+    WriteBytes(systemIdentifier.data(), systemIdentifier.size());
+  }
+
+  if (!content.empty())
+  {
+    WriteValue<sc_uint64>(content.size());
+    WriteBytes(content.data(), content.size());
+  }
+
+  if (tag == ScStructureBinaryFormat::Connector)
+  {
+    auto const [sourceAddr, targetAddr] = m_context.GetConnectorIncidentElements(elementAddr);
+    WriteValue<sc_uint64>(m_indices.at(sourceAddr));
+    WriteValue<sc_uint64>(m_indices.at(targetAddr));
+  }
+
+  sc_uint64 const index = m_indices.size();
+  m_indices.insert({elementAddr, index});
+}
+
+template <typename TValue>
+void ScStructureBinaryWriter::WriteValue(TValue value)
+{
+  sc_char bytes[sizeof(TValue)];
+  for (size_t i = 0; i < sizeof(TValue); ++i)
+    bytes[i] = static_cast<sc_char>((static_cast<sc_uint64>(value) >> (8 * i)) & 0xFF);
+
+  WriteBytes(bytes, sizeof(TValue));
+}
+
+void ScStructureBinaryWriter::WriteBytes(sc_char const * data, size_t size)
+{
+  m_buffer.append(data, size);
+  if (m_buffer.size() >= ScStructureBinaryFormat::kBufferSize)
+    Flush();
+}
+
+void ScStructureBinaryWriter::Flush()
+{
+  if (m_buffer.empty())
+    return;
+
+  size_t writtenBytes = 0;
+  if (!m_stream->Write(m_buffer.data(), m_buffer.size(), writtenBytes) || writtenBytes != m_buffer.size())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Not able to write sc-structure to specified stream.");
+
+  m_buffer.clear();
+}
+
+// ---------------------------------------
+
+ScStructureBinaryReader::ScStructureBinaryReader(ScMemoryContext & context, ScStreamPtr const & stream)
+  : m_context(context)
+  , m_stream(stream)
+  , m_position(0)
+{
+  if (!m_stream || !m_stream->IsValid() || !m_stream->HasFlag(SC_STREAM_FLAG_READ))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified stream is invalid to read sc-structure.");
+}
+
+ScAddr ScStructureBinaryReader::Read()
+{
+  sc_char magic[sizeof(ScStructureBinaryFormat::kMagic)];
+  ReadBytes(magic, sizeof(magic));
+  if (std::memcmp(magic, ScStructureBinaryFormat::kMagic, sizeof(magic)) != 0)
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, "Specified stream doesn't contain sc-structure in binary format.");
+
+  sc_uint32 const version = ReadValue<sc_uint32>();
+  if (version != ScStructureBinaryFormat::kVersion)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "Version " << version << " of sc-structure binary format isn't supported.");
+
+  ScAddr structureAddr;
+  while (true)
+  {
+    auto const tag = static_cast<ScStructureBinaryFormat::RecordTag>(ReadValue<sc_uint8>());
+    if (tag == ScStructureBinaryFormat::End)
+      break;
+
+    ScAddr const & elementAddr = ReadRecord(tag);
+    if (!structureAddr.IsValid())
+      structureAddr = elementAddr;
+  }
+
+  if (!structureAddr.IsValid())
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, "Specified stream doesn't contain sc-structure.");
+
+  return structureAddr;
+}
+
+ScAddr ScStructureBinaryReader::ReadRecord(ScStructureBinaryFormat::RecordTag tag)
+{
+  if (tag != ScStructureBinaryFormat::Node && tag != ScStructureBinaryFormat::Link
+      && tag != ScStructureBinaryFormat::Connector)
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unknown record tag " << (sc_uint32)tag << " in sc-structure.");
+
+  ScType const elementType{ReadValue<sc_uint16>()};
+  sc_uint8 const flags = ReadValue<sc_uint8>();
+
+  std::string systemIdentifier;
+  if (flags & ScStructureBinaryFormat::HasSystemIdentifier)
+  {
+    systemIdentifier.resize(ReadLength<sc_uint32>());
+    ReadBytes(systemIdentifier.data(), systemIdentifier.size());
+  }
+
+  std::string content;
+  if (flags & ScStructureBinaryFormat::HasContent)
+  {
+    content.resize(ReadLength<sc_uint64>());
+    ReadBytes(content.data(), content.size());
+  }
+
+  ScAddr sourceAddr;
+  ScAddr targetAddr;
+  if (tag == ScStructureBinaryFormat::Connector)
+  {
+    sourceAddr = GetAddrByIndex(ReadValue<sc_uint64>());
+    targetAddr = GetAddrByIndex(ReadValue<sc_uint64>());
+  }
+
+  // sc-elements with system identifiers are shared between sc-structures, so existing ones are reused
+  ScAddr elementAddr;
+  if (!systemIdentifier.empty() && m_context.SearchElementBySystemIdentifier(systemIdentifier, elementAddr))
+  {
+    ScType const & existingType = m_context.GetElementType(elementAddr);
+    if (existingType != elementType && existingType.CanExtendTo(elementType))
+      m_context.SetElementSubtype(elementAddr, elementType);
+  }
+  else
+  {
+    if (tag == ScStructureBinaryFormat::Node)
+      elementAddr = m_context.GenerateNode(elementType);
+    else if (tag == ScStructureBinaryFormat::Link)
+      elementAddr = m_context.GenerateLink(elementType);
+    else
+      elementAddr = m_context.GenerateConnector(elementType, sourceAddr, targetAddr);
+
+    if (!content.empty())
+      m_context.SetLinkContent(elementAddr, content);
+    if (!systemIdentifier.empty())
+      m_context.SetElementSystemIdentifier(systemIdentifier, elementAddr);
+  }
+
+  m_addrs.push_back(elementAddr);
+
+  if (flags & ScStructureBinaryFormat::IsStructureElement)
+    m_context.GenerateConnector(ScType::ConstPermPosArc, m_addrs.front(), elementAddr);
+
+  return elementAddr;
+}
+
+ScAddr ScStructureBinaryReader::GetAddrByIndex(sc_uint64 index) const
+{
+  if (index >= m_addrs.size())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "Sc-connector refers to sc-element " << index << " that isn't read before it.");
+
+  return m_addrs[index];
+}
+
+template <typename TValue>
+TValue ScStructureBinaryReader::ReadValue()
+{
+  sc_uchar bytes[sizeof(TValue)];
+  ReadBytes((sc_char *)bytes, sizeof(TValue));
+
+  sc_uint64 value = 0;
+  for (size_t i = 0; i < sizeof(TValue); ++i)
+    value |= static_cast<sc_uint64>(bytes[i]) << (8 * i);
+
+  return static_cast<TValue>(value);
+}
+
+template <typename TLength>
+size_t ScStructureBinaryReader::ReadLength()
+{
+  // lengths are checked before data is allocated, so broken stream can't make reader allocate more than it contains
+  sc_uint64 const length = ReadValue<TLength>();
+  if (length > ScStructureBinaryFormat::kMaxLength || length > GetRemainingSize())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "Length " << length << " of sc-element data exceeds size of specified stream.");
+
+  return length;
+}
+
+sc_uint64 ScStructureBinaryReader::GetRemainingSize() const
+{
+  // size of stream is unknown if it is 0, then only maximum length is checked
+  size_t const streamSize = m_stream->Size();
+  if (streamSize == 0)
+    return ScStructureBinaryFormat::kMaxLength;
+
+  size_t const streamPosition = m_stream->Pos();
+  return m_buffer.size() - m_position + (streamSize > streamPosition ? streamSize - streamPosition : 0);
+}
+
+void ScStructureBinaryReader::ReadBytes(sc_char * data, size_t size)
+{
+  while (size > 0)
+  {
+    if (m_position == m_buffer.size())
+    {
+      m_buffer.resize(ScStructureBinaryFormat::kBufferSize);
+      size_t readBytes = 0;
+      if (!m_stream->Read(m_buffer.data(), m_buffer.size(), readBytes) || readBytes == 0)
+        SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unexpected end of sc-structure in specified stream.");
+
+      m_buffer.resize(readBytes);
+      m_position = 0;
+    }
+
+    size_t const count = std::min(size, m_buffer.size() - m_position);
+    std::memcpy(data, m_buffer.data() + m_position, count);
+    m_position += count;
+    data += count;
+    size -= count;
+  }
+}
+
+}  // namespace impl
@@ -0,0 +1,115 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc-memory/sc_addr.hpp"
+#include "sc-memory/sc_stream.hpp"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+class ScMemoryContext;
+
+namespace impl
+{
+
+/*!
+ * Binary format of sc-structure. All numbers are written in little-endian byte order.
+ *
+ * Header: magic "SCSB" and uint32 format version.
+ * Records of sc-elements: uint8 record tag, uint16 sc-type and uint8 flags. Then
+ *  - uint32 length and bytes of system identifier, if it is specified by flags;
+ *  - uint64 length and bytes of content, if record is sc-link and it has content;
+ *  - uint64 local indices of source and target sc-elements, if record is sc-connector.
+ * Record with end tag finishes data.
+ *
+ * Local index of sc-element is order number of its record. The first record is sc-structure itself. Incident
+ * sc-elements of sc-connector are always written before it, so every sc-element can be generated while reading in one
+ * pass.
+ */
+class ScStructureBinaryFormat
+{
+public:
+  static constexpr sc_char kMagic[4] = {'S', 'C', 'S', 'B'};
+  static constexpr sc_uint32 kVersion = 1;
+  static constexpr size_t kBufferSize = 64 * 1024;
+  //! Sizes of sc-link contents and streams are 32-bit in sc-memory
+  static constexpr sc_uint64 kMaxLength = std::numeric_limits<sc_uint32>::max();
+
+  enum RecordTag : sc_uint8
+  {
+    End = 0,
+    Node = 1,
+    Link = 2,
+    Connector = 3
+  };
+
+  enum RecordFlag : sc_uint8
+  {
+    IsStructureElement = 1 << 0,
+    HasSystemIdentifier = 1 << 1,
+    HasContent = 1 << 2
+  };
+};
+
+//! Writes sc-structure elements with their incident sc-elements to stream in binary format
+class ScStructureBinaryWriter
+{
+public:
+  ScStructureBinaryWriter(ScMemoryContext & context, ScStreamPtr const & stream);
+
+  void Write(ScAddr const & structureAddr);
+
+private:
+  ScMemoryContext & m_context;
+  ScStreamPtr m_stream;
+  std::string m_buffer;
+
+  ScAddrUnorderedSet m_structureElements;
+  // sc-elements of system identifiers constructions aren't written, they are generated while reading
+  ScAddrUnorderedSet m_systemIdentifiersElements;
+  ScAddrToValueUnorderedMap<sc_uint64> m_indices;
+
+  void CollectStructureElements(ScAddr const & structureAddr, ScAddrVector & structureElements);
+  void WriteElement(ScAddr const & elementAddr);
+  void WriteRecord(ScAddr const & elementAddr);
+
+  template <typename TValue>
+  void WriteValue(TValue value);
+  void WriteBytes(sc_char const * data, size_t size);
+  void Flush();
+};
+
+//! Reads sc-elements from stream in binary format and appends them to new sc-structure
+class ScStructureBinaryReader
+{
+public:
+  ScStructureBinaryReader(ScMemoryContext & context, ScStreamPtr const & stream);
+
+  ScAddr Read();
+
+private:
+  ScMemoryContext & m_context;
+  ScStreamPtr m_stream;
+  std::string m_buffer;
+  size_t m_position;
+
+  ScAddrVector m_addrs;
+
+  ScAddr ReadRecord(ScStructureBinaryFormat::RecordTag tag);
+  ScAddr GetAddrByIndex(sc_uint64 index) const;
+
+  template <typename TValue>
+  TValue ReadValue();
+  template <typename TLength>
+  size_t ReadLength();
+  void ReadBytes(sc_char * data, size_t size);
+  sc_uint64 GetRemainingSize() const;
+};
+
+}  // namespace impl
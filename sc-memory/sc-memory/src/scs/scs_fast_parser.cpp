@@ -0,0 +1,661 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "scs_fast_parser.hpp"
+
+#include "sc-memory/sc_debug.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+
+// The same connectors as in `connector` rule of SCs-grammar
+std::string_view const kConnectors[] = {
+    "?<=>", "?=>",   "<=?",   "<=>",   "_<=>",  "=>",    "<=",    "_=>",   "<=_",   "?.?>",  "<?.?",  ".?>",
+    "<?.",  "_.?>",  "<?._",  "?.>",   "<.?",   "?.|>",  "<|.?",  "?/>",   "</?",   ".>",    "<.",    ".|>",
+    "<|.",  "/>",    "</",    "_.>",   "<._",   "_.|>",  "<|._",  "_/>",   "</_",   "?-?>",  "<?-?",  "?..?>",
+    "<?..?", "?~?>", "<?~?",  "?%?>",  "<?%?",  "?->",   "<-?",   "?-|>",  "<|-?",  "-?>",   "<?-",   "_-?>",
+    "<?-_", "?..>",  "<..?",  "?~>",   "<~?",   "?%>",   "<%?",   "?..|>", "<|..?", "?~|>",  "<|~?",  "?%|>",
+    "<|%?", "..?>",  "<?..",  "~?>",   "<?~",   "%?>",   "<?%",   "_..?>", "<?.._", "_~?>",  "<?~_",  "_%?>",
+    "<?%_", "->",    "<-",    "_->",   "<-_",   "-|>",   "<|-",   "_-|>",  "<|-_",  "..>",   "<..",   "_..>",
+    "<.._", "~>",    "<~",    "_~>",   "<~_",   "%>",    "<%",    "_%>",   "<%_",   "..|>",  "<|..",  "_..|>",
+    "<|.._", "~|>",  "<|~",   "_~|>",  "<|~_",  "%|>",   "<|%",   "_%|>",  "<|%_",
+    // deprecated
+    ">",    "<",     "<>",    "_<=",   "_<-",   "_<|-",  "_<~",   "_<|~"};
+
+using ConnectorsByFirstSymbol = std::array<std::vector<std::string_view>, 128>;
+
+// Connectors are grouped by their first symbols and sorted by length, so the longest matched one is found first
+ConnectorsByFirstSymbol const & GetConnectorsByFirstSymbol()
+{
+  static ConnectorsByFirstSymbol const connectors = []
+  {
+    ConnectorsByFirstSymbol result;
+    for (std::string_view const & connector : kConnectors)
+      result[static_cast<unsigned char>(connector[0])].push_back(connector);
+
+    for (auto & group : result)
+    {
+      std::stable_sort(
+          group.begin(),
+          group.end(),
+          [](std::string_view const & first, std::string_view const & second)
+          {
+            return first.size() > second.size();
+          });
+    }
+    return result;
+  }();
+
+  return connectors;
+}
+
+bool IsIdentifierSymbol(char symbol)
+{
+  return (symbol >= 'a' && symbol <= 'z') || (symbol >= 'A' && symbol <= 'Z') || (symbol >= '0' && symbol <= '9')
+         || symbol == '_' || symbol == '.';
+}
+
+bool IsAliasSymbol(char symbol)
+{
+  return symbol != '.' && IsIdentifierSymbol(symbol);
+}
+
+bool IsSpace(char symbol)
+{
+  return symbol == ' ' || symbol == '\t' || symbol == '\r' || symbol == '\n';
+}
+
+}  // namespace
+
+namespace scs
+{
+
+FastParser::FastParser(Parser & parser, std::string const & text)
+  : m_parser(parser)
+  , m_text(text)
+  , m_position(0)
+  , m_hasNextToken(false)
+{
+}
+
+bool FastParser::Parse()
+{
+  try
+  {
+    Next();
+    while (m_token.m_type != TokenType::End)
+    {
+      if (!ParseSentence() || m_token.m_type != TokenType::SentenceEnd)
+        return false;
+
+      Next();
+    }
+  }
+  catch (utils::ScException const &)
+  {
+    // error is reported by ANTLR-generated parser
+    return false;
+  }
+
+  return true;
+}
+
+void FastParser::Next()
+{
+  if (m_hasNextToken)
+  {
+    m_token = m_nextToken;
+    m_hasNextToken = false;
+  }
+  else
+    m_token = Lex();
+}
+
+FastParser::Token const & FastParser::Peek()
+{
+  if (!m_hasNextToken)
+  {
+    m_nextToken = Lex();
+    m_hasNextToken = true;
+  }
+
+  return m_nextToken;
+}
+
+FastParser::Token FastParser::Lex()
+{
+  if (!SkipSpacesAndComments())
+    return {TokenType::Unsupported, {}};
+
+  if (m_position >= m_text.size())
+    return {TokenType::End, {}};
+
+  size_t const begin = m_position;
+  auto const MakeToken = [this, begin](TokenType type, size_t length) -> Token
+  {
+    m_position = begin + length;
+    return {type, m_text.substr(begin, length)};
+  };
+
+  // Like ANTLR-generated lexer, the longest token is taken
+  size_t identifierLength = 0;
+  while (begin + identifierLength < m_text.size() && IsIdentifierSymbol(m_text[begin + identifierLength]))
+    ++identifierLength;
+
+  size_t const connectorLength = MatchConnector(begin);
+  if (connectorLength > identifierLength)
+    return MakeToken(TokenType::Connector, connectorLength);
+
+  char const symbol = m_text[begin];
+  if (identifierLength > 0)
+  {
+    bool const isUnderscore = identifierLength == 1 && symbol == '_';
+    return MakeToken(isUnderscore ? TokenType::Underscore : TokenType::Identifier, identifierLength);
+  }
+
+  char const nextSymbol = begin + 1 < m_text.size() ? m_text[begin + 1] : '\0';
+  switch (symbol)
+  {
+  case '@':
+  {
+    size_t length = 1;
+    while (begin + length < m_text.size() && IsAliasSymbol(m_text[begin + length]))
+      ++length;
+    return length > 1 ? MakeToken(TokenType::Alias, length) : MakeToken(TokenType::Unsupported, 0);
+  }
+  case ';':
+    return nextSymbol == ';' ? MakeToken(TokenType::SentenceEnd, 2) : MakeToken(TokenType::Semicolon, 1);
+  case '|':
+    return MakeToken(TokenType::Pipe, 1);
+  case '=':
+    return MakeToken(TokenType::Equal, 1);
+  case '#':
+    return MakeToken(TokenType::Hash, 1);
+  case '(':
+    return nextSymbol == '*' ? MakeToken(TokenType::InternalListBegin, 2) : MakeToken(TokenType::LeftParenthesis, 1);
+  case ')':
+    return MakeToken(TokenType::RightParenthesis, 1);
+  case '*':
+    return nextSymbol == ')' ? MakeToken(TokenType::InternalListEnd, 2) : MakeToken(TokenType::Unsupported, 0);
+  case ':':
+    return nextSymbol == ':' ? MakeToken(TokenType::VarAttr, 2) : MakeToken(TokenType::ConstAttr, 1);
+  case '[':
+  case '!':
+  {
+    size_t const contentLength = MatchContent(begin);
+    return contentLength > 0 ? MakeToken(TokenType::Content, contentLength) : MakeToken(TokenType::Unsupported, 0);
+  }
+  case '"':
+  {
+    size_t const urlLength = MatchUrl(begin);
+    return urlLength > 0 ? MakeToken(TokenType::Url, urlLength) : MakeToken(TokenType::Unsupported, 0);
+  }
+  default:
+    // sets, contours and symbols out of grammar
+    return MakeToken(TokenType::Unsupported, 0);
+  }
+}
+
+bool FastParser::SkipSpacesAndComments()
+{
+  while (m_position < m_text.size())
+  {
+    char const symbol = m_text[m_position];
+    if (IsSpace(symbol))
+    {
+      ++m_position;
+      continue;
+    }
+
+    if (symbol != '/' || m_position + 1 >= m_text.size())
+      break;
+
+    char const nextSymbol = m_text[m_position + 1];
+    if (nextSymbol == '/')
+    {
+      // line comment must be ended by line break
+      size_t const end = m_text.find_first_of("\r\n", m_position + 2);
+      if (end == std::string_view::npos)
+        return false;
+
+      if (m_text[end] == '\r')
+      {
+        if (end + 1 >= m_text.size() || m_text[end + 1] != '\n')
+          return false;
+        m_position = end + 2;
+      }
+      else
+        m_position = end + 1;
+    }
+    else if (nextSymbol == '*')
+    {
+      size_t const end = m_text.find("*/", m_position + 2);
+      if (end == std::string_view::npos)
+        return false;
+      m_position = end + 2;
+    }
+    else
+      break;
+  }
+
+  return true;
+}
+
+size_t FastParser::MatchConnector(size_t position) const
+{
+  auto const symbol = static_cast<unsigned char>(m_text[position]);
+  if (symbol >= GetConnectorsByFirstSymbol().size())
+    return 0;
+
+  for (std::string_view const & connector : GetConnectorsByFirstSymbol()[symbol])
+  {
+    if (m_text.compare(position, connector.size(), connector) == 0)
+      return connector.size();
+  }
+
+  return 0;
+}
+
+size_t FastParser::MatchContent(size_t position) const
+{
+  size_t const begin = position;
+  bool const isLinkClass = m_text[position] == '!';
+  if (isLinkClass)
+    ++position;
+
+  if (position >= m_text.size() || m_text[position] != '[')
+    return 0;
+  ++position;
+
+  // `[*` is beginning of contour
+  if (position < m_text.size() && m_text[position] == '*')
+    return 0;
+
+  while (position < m_text.size())
+  {
+    char const symbol = m_text[position];
+    if (symbol == ']')
+    {
+      ++position;
+      if (isLinkClass)
+      {
+        if (position >= m_text.size() || m_text[position] != '!')
+          return 0;
+        ++position;
+      }
+      return position - begin;
+    }
+
+    if (symbol == '[')
+      return 0;
+
+    if (symbol == '\\')
+    {
+      if (position + 1 >= m_text.size())
+        return 0;
+
+      char const escapedSymbol = m_text[position + 1];
+      if (escapedSymbol != '[' && escapedSymbol != ']' && escapedSymbol != '\\' && escapedSymbol != '*')
+        return 0;
+      position += 2;
+      continue;
+    }
+
+    ++position;
+  }
+
+  return 0;
+}
+
+size_t FastParser::MatchUrl(size_t position) const
+{
+  size_t const end = m_text.find_first_of("\"\\", position + 1);
+  // URLs with escaped quotes are lexed by ANTLR-generated lexer
+  if (end == std::string_view::npos || m_text[end] != '"')
+    return 0;
+
+  return end + 1 - position;
+}
+
+bool FastParser::IsKeyword(std::string_view text)
+{
+  // keywords are lexed as separate tokens, so they can't be used where only identifiers are expected
+  if (text == "...")
+    return true;
+
+  if (text.compare(0, 3, "sc_") != 0)
+    return false;
+
+  m_keywordBuffer.assign(text);
+  return TypeResolver::IsKeynodeType(m_keywordBuffer);
+}
+
+bool FastParser::ParseSentence()
+{
+  Token const token = m_token;
+  if (token.m_type == TokenType::Alias && Peek().m_type == TokenType::Equal)
+  {
+    Next();
+    Next();
+
+    ElementHandle value;
+    if (!ParseIdtfCommon(value))
+      return false;
+
+    m_buffer.assign(token.m_text);
+    m_parser.ProcessAssign(m_buffer, value);
+    return true;
+  }
+
+  if (token.m_type == TokenType::Identifier && Peek().m_type == TokenType::Hash)
+  {
+    ElementHandle source;
+    return ParseIdtfLevel1(source) && ParseSentenceLevel1(source);
+  }
+
+  if (token.m_type == TokenType::Identifier && Peek().m_type == TokenType::Equal)
+    return ParseSentenceAssignLink();
+
+  bool const isLink = token.m_type == TokenType::Content || token.m_type == TokenType::Underscore
+                      || token.m_type == TokenType::Url;
+
+  ElementHandle source;
+  if (!ParseIdtfCommon(source))
+    return false;
+
+  if (isLink && m_token.m_type == TokenType::Pipe)
+    return ParseSentenceLevel1(source);
+
+  return ParseSentenceLevelCommon(source);
+}
+
+bool FastParser::ParseSentenceLevel1(ElementHandle const & source)
+{
+  if (m_token.m_type != TokenType::Pipe)
+    return false;
+  Next();
+
+  ElementHandle connector;
+  if (!ParseIdtfLevel1(connector) || m_token.m_type != TokenType::Pipe)
+    return false;
+  Next();
+
+  ElementHandle target;
+  if (!ParseIdtfLevel1(target))
+    return false;
+
+  m_parser.ProcessTriple(source, connector, target);
+  return true;
+}
+
+bool FastParser::ParseSentenceAssignLink()
+{
+  ElementHandle const link = ProcessIdentifier(m_token.m_text);
+  Next();
+  Next();
+
+  if (m_token.m_type == TokenType::Url)
+  {
+    m_parser.ProcessLink(link, std::string(m_token.m_text), true);
+    Next();
+    return true;
+  }
+
+  if (m_token.m_type == TokenType::Underscore)
+    Next();
+
+  if (m_token.m_type != TokenType::Content)
+    return false;
+
+  m_parser.ProcessLink(link, std::string(m_token.m_text));
+  Next();
+  return true;
+}
+
+bool FastParser::ParseSentenceLevelCommon(ElementHandle const & source)
+{
+  if (!ParseSentenceItem(source))
+    return false;
+
+  while (m_token.m_type == TokenType::Semicolon)
+  {
+    Next();
+    if (!ParseSentenceItem(source))
+      return false;
+  }
+
+  return true;
+}
+
+bool FastParser::ParseSentenceItem(ElementHandle const & source)
+{
+  // `<` is also beginning of vector
+  if (m_token.m_type != TokenType::Connector || m_token.m_text == "<")
+    return false;
+
+  std::string_view const connectorText = m_token.m_text;
+  Next();
+
+  size_t const attrsBegin = m_attrs.size();
+  if (!ParseAttrs())
+    return false;
+
+  size_t const targetsBegin = m_targets.size();
+  while (true)
+  {
+    ElementHandle target;
+    if (!ParseIdtfCommon(target))
+      return false;
+    m_targets.push_back(target);
+
+    if (m_token.m_type == TokenType::InternalListBegin && !ParseInternalSentenceList(target))
+      return false;
+
+    if (m_token.m_type != TokenType::Semicolon || Peek().m_type == TokenType::Connector)
+      break;
+    Next();
+  }
+
+  for (size_t i = targetsBegin; i < m_targets.size(); ++i)
+  {
+    ElementHandle const connector = ProcessConnector(connectorText);
+    m_parser.ProcessTriple(source, connector, m_targets[i]);
+    ProcessAttrs(attrsBegin, connector);
+  }
+
+  m_targets.resize(targetsBegin);
+  m_attrs.resize(attrsBegin);
+  return true;
+}
+
+bool FastParser::ParseInternalSentenceList(ElementHandle const & source)
+{
+  Next();
+
+  do
+  {
+    if (m_token.m_type == TokenType::InternalListBegin)
+    {
+      if (!ParseInternalSentenceList(source))
+        return false;
+    }
+    else if (!ParseSentenceItem(source))
+      return false;
+
+    if (m_token.m_type != TokenType::SentenceEnd)
+      return false;
+    Next();
+  } while (m_token.m_type != TokenType::InternalListEnd);
+
+  Next();
+  return true;
+}
+
+bool FastParser::ParseAttrs()
+{
+  while (m_token.m_type == TokenType::Identifier)
+  {
+    TokenType const attrType = Peek().m_type;
+    if (attrType != TokenType::ConstAttr && attrType != TokenType::VarAttr)
+      break;
+
+    if (IsKeyword(m_token.m_text))
+      return false;
+
+    m_attrs.emplace_back(ProcessIdentifier(m_token.m_text), attrType == TokenType::ConstAttr);
+    Next();
+    Next();
+  }
+
+  return true;
+}
+
+bool FastParser::ParseIdtfLevel1(ElementHandle & handle)
+{
+  if (m_token.m_type == TokenType::Content || m_token.m_type == TokenType::Underscore)
+    return ParseContent(handle);
+
+  if (m_token.m_type == TokenType::Url)
+    return ParseUrl(handle);
+
+  if (m_token.m_type != TokenType::Identifier || Peek().m_type != TokenType::Hash || !IsKeyword(m_token.m_text)
+      || m_token.m_text == "...")
+    return false;
+
+  m_typeBuffer.assign(m_token.m_text);
+  Next();
+  Next();
+
+  if (m_token.m_type != TokenType::Identifier || IsKeyword(m_token.m_text))
+    return false;
+
+  m_buffer.assign(m_token.m_text);
+  handle = m_parser.ProcessIdentifierLevel1(m_typeBuffer, m_buffer);
+  Next();
+  return true;
+}
+
+bool FastParser::ParseIdtfCommon(ElementHandle & handle)
+{
+  switch (m_token.m_type)
+  {
+  case TokenType::Alias:
+  case TokenType::Identifier:
+    return ParseIdtfAtomic(handle);
+  case TokenType::LeftParenthesis:
+    return ParseIdtfConnector(handle);
+  case TokenType::Content:
+  case TokenType::Underscore:
+    return ParseContent(handle);
+  case TokenType::Url:
+    return ParseUrl(handle);
+  default:
+    return false;
+  }
+}
+
+bool FastParser::ParseIdtfAtomic(ElementHandle & handle)
+{
+  if (m_token.m_type == TokenType::Alias)
+  {
+    m_buffer.assign(m_token.m_text);
+    handle = m_parser.ResolveAlias(m_buffer);
+    if (!handle.IsValid())
+      return false;
+  }
+  else if (m_token.m_type == TokenType::Identifier)
+    handle = ProcessIdentifier(m_token.m_text);
+  else
+    return false;
+
+  Next();
+  return true;
+}
+
+bool FastParser::ParseIdtfConnector(ElementHandle & handle)
+{
+  Next();
+
+  ElementHandle source;
+  if (!(m_token.m_type == TokenType::LeftParenthesis ? ParseIdtfConnector(source) : ParseIdtfAtomic(source)))
+    return false;
+
+  if (m_token.m_type != TokenType::Connector || m_token.m_text == "<")
+    return false;
+
+  std::string_view const connectorText = m_token.m_text;
+  Next();
+
+  size_t const attrsBegin = m_attrs.size();
+  if (!ParseAttrs())
+    return false;
+
+  ElementHandle target;
+  if (!(m_token.m_type == TokenType::LeftParenthesis ? ParseIdtfConnector(target) : ParseIdtfAtomic(target)))
+    return false;
+
+  if (m_token.m_type != TokenType::RightParenthesis)
+    return false;
+  Next();
+
+  handle = ProcessConnector(connectorText);
+  m_parser.ProcessTriple(source, handle, target);
+  ProcessAttrs(attrsBegin, handle);
+
+  m_attrs.resize(attrsBegin);
+  return true;
+}
+
+bool FastParser::ParseContent(ElementHandle & handle)
+{
+  bool isVar = false;
+  if (m_token.m_type == TokenType::Underscore)
+  {
+    isVar = true;
+    Next();
+  }
+
+  if (m_token.m_type != TokenType::Content)
+    return false;
+
+  handle = m_parser.ProcessContent(std::string(m_token.m_text), isVar);
+  Next();
+  return true;
+}
+
+bool FastParser::ParseUrl(ElementHandle & handle)
+{
+  handle = m_parser.ProcessFileURL(std::string(m_token.m_text));
+  Next();
+  return true;
+}
+
+ElementHandle FastParser::ProcessIdentifier(std::string_view name)
+{
+  m_buffer.assign(name);
+  return m_parser.ProcessIdentifier(m_buffer);
+}
+
+ElementHandle FastParser::ProcessConnector(std::string_view connector)
+{
+  m_buffer.assign(connector);
+  return m_parser.ProcessConnector(m_buffer);
+}
+
+void FastParser::ProcessAttrs(size_t attrsBegin, ElementHandle const & connector)
+{
+  for (size_t i = attrsBegin; i < m_attrs.size(); ++i)
+  {
+    auto const & [attr, isConst] = m_attrs[i];
+    ElementHandle const attrConnector = ProcessConnector(isConst ? "->" : "_->");
+    m_parser.ProcessTriple(attr, attrConnector, connector);
+  }
+}
+
+}  // namespace scs
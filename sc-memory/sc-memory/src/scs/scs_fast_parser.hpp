@@ -0,0 +1,116 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc-memory/scs/scs_parser.hpp"
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace scs
+{
+
+/*!
+ * Hand-written single-pass parser of SCs-text subset, that most of knowledge base sources are written in: sentences of
+ * level 1, sentences with connectors, attributes, lists of targets and internal sentences, connectors in parentheses,
+ * contents, URLs and aliases. It lexes text in place without tokens allocation and fills parser by the same calls in
+ * the same order as ANTLR-generated parser does.
+ *
+ * If text has other constructions or it is invalid, then parsing is stopped. Such text should be parsed by
+ * ANTLR-generated parser from the beginning.
+ */
+class FastParser
+{
+public:
+  FastParser(Parser & parser, std::string const & text);
+
+  /*!
+   * Parses the whole text.
+   * @returns true, if text is parsed; false, if text has unsupported constructions or it is invalid.
+   */
+  bool Parse();
+
+private:
+  enum class TokenType : uint8_t
+  {
+    End,
+    Identifier,
+    Alias,
+    Connector,
+    Content,
+    Url,
+    Underscore,
+    SentenceEnd,
+    Semicolon,
+    Pipe,
+    Equal,
+    Hash,
+    LeftParenthesis,
+    RightParenthesis,
+    InternalListBegin,
+    InternalListEnd,
+    ConstAttr,
+    VarAttr,
+    Unsupported
+  };
+
+  struct Token
+  {
+    TokenType m_type = TokenType::End;
+    std::string_view m_text;
+  };
+
+  Parser & m_parser;
+  std::string_view const m_text;
+  size_t m_position;
+
+  Token m_token;
+  Token m_nextToken;
+  bool m_hasNextToken;
+
+  // buffers are reused to pass identifiers to parser without allocations
+  std::string m_buffer;
+  std::string m_typeBuffer;
+  std::string m_keywordBuffer;
+
+  // attributes and targets of sentences that are parsed now, every sentence uses their tail
+  std::vector<std::pair<ElementHandle, bool>> m_attrs;
+  std::vector<ElementHandle> m_targets;
+
+  void Next();
+  Token const & Peek();
+  Token Lex();
+
+  bool SkipSpacesAndComments();
+  size_t MatchConnector(size_t position) const;
+  size_t MatchContent(size_t position) const;
+  size_t MatchUrl(size_t position) const;
+  bool IsKeyword(std::string_view text);
+
+  bool ParseSentence();
+  bool ParseSentenceLevel1(ElementHandle const & source);
+  bool ParseSentenceAssignLink();
+  bool ParseSentenceLevelCommon(ElementHandle const & source);
+  bool ParseSentenceItem(ElementHandle const & source);
+  bool ParseInternalSentenceList(ElementHandle const & source);
+  bool ParseAttrs();
+
+  bool ParseIdtfLevel1(ElementHandle & handle);
+  bool ParseIdtfCommon(ElementHandle & handle);
+  bool ParseIdtfAtomic(ElementHandle & handle);
+  bool ParseIdtfConnector(ElementHandle & handle);
+  bool ParseContent(ElementHandle & handle);
+  bool ParseUrl(ElementHandle & handle);
+
+  ElementHandle ProcessIdentifier(std::string_view name);
+  ElementHandle ProcessConnector(std::string_view connector);
+  void ProcessAttrs(size_t attrsBegin, ElementHandle const & connector);
+};
+
+}  // namespace scs
@@ -26,6 +26,7 @@
 
 #include "scsLexer.h"
 #include "scsParser.h"
+#include "scs_fast_parser.hpp"
 
 #include <iostream>
 
@@ -271,6 +272,21 @@ Parser::Parser()
 
 bool Parser::Parse(std::string const & str)
 {
+  // Fast parser can't roll back elements appended by it, so it is used only if nothing is parsed yet
+  if (m_parsedElements.empty() && m_parsedElementsLocal.empty() && m_aliasHandles.empty() && m_idtfCounter == 0)
+  {
+    if (FastParser(*this, str).Parse())
+      return true;
+
+    // Text has constructions unsupported by fast parser, so it is parsed by ANTLR-generated parser from the beginning
+    m_parsedElements.clear();
+    m_parsedElementsLocal.clear();
+    m_parsedTriples.clear();
+    m_idtfToParsedElement.clear();
+    m_aliasHandles.clear();
+    m_idtfCounter = 0;
+  }
+
   bool result = true;
 
   std::string fName;
@@ -366,7 +382,7 @@ std::string Parser::GenerateContourIdtf()
 }
 
 ElementHandle Parser::AppendElement(
-    std::string idtf,
+    std::string const & idtf,
     ScType const & type,
     bool isConnectorReversed,
     std::string const & value /* = "" */,
@@ -374,7 +390,7 @@ ElementHandle Parser::AppendElement(
 {
   SC_CHECK_GREAT(idtf.size(), 0, "Element identifier is empty");
   if (TypeResolver::IsUnnamed(idtf))
-    idtf = GenerateNodeIdtf();
+    return AppendElement(GenerateNodeIdtf(), type, isConnectorReversed, value, isURL);
 
   ElementHandle elId;
 
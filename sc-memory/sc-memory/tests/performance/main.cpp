@@ -11,6 +11,7 @@
 #include "units/memory_generate_link.hpp"
 #include "units/memory_iterator_search.hpp"
 #include "units/memory_search_link_by_content.hpp"
+#include "units/memory_resolve_system_identifier.hpp"
 #include "units/memory_erase_diff_elements.hpp"
 #include "units/memory_erase_set_elements.hpp"
 
@@ -21,6 +22,9 @@
 #include "units/template_search_complex.hpp"
 #include "units/template_search_smoke.hpp"
 
+#include "units/scs_parse.hpp"
+#include "units/scs_generate.hpp"
+
 #include <atomic>
 #include <chrono>
 
@@ -403,6 +407,20 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestSearchLinkByContent)
 ->Arg(kSetPower)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+int constexpr kSystemIdentifiersCount = 100000;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestResolveSystemIdentifier)
+->Threads(1)
+->Iterations(kSystemIdentifiersCount)
+->Arg(kSystemIdentifiersCount)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestResolveSystemIdentifier)
+->Threads(4)
+->Iterations(kSystemIdentifiersCount / 4)
+->Arg(kSystemIdentifiersCount)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEraseDiffElements)
 ->Threads(1)
 ->Iterations(kSetPower)
@@ -463,6 +481,18 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEraseSetElements)
 ->Arg(kSetPower)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEraseSetElementsBatch)
+->Threads(1)
+->Iterations(kSetPower / TestEraseSetElementsBatch::kBatchSize)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEraseSetElementsBatch)
+->Threads(4)
+->Iterations(kSetPower / TestEraseSetElementsBatch::kBatchSize / 4)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 // ------------------------------------
 template <class BMType>
 void BM_Memory(benchmark::State & state)
@@ -545,5 +575,60 @@ BENCHMARK_TEMPLATE(BM_Template, TestScCodeExtended)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50)->Arg(500);
 
+// ------------------------------------
+template <class BMType>
+void BM_SCsParse(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+  for (auto t : state)
+  {
+    if (!test.Run())
+      state.SkipWithError("Text isn't parsed");
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(test.GetTextSize()));
+}
+
+BENCHMARK_TEMPLATE(BM_SCsParse, TestSCsParseCommonSentences)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(1000)->Arg(10000);
+
+BENCHMARK_TEMPLATE(BM_SCsParse, TestSCsParseLevel1Sentences)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(1000)->Arg(10000);
+
+BENCHMARK_TEMPLATE(BM_SCsParse, TestSCsParseSentencesWithContour)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(1000)->Arg(10000);
+
+// ------------------------------------
+template <class BMType>
+void BM_SCsGenerate(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+  for (auto t : state)
+  {
+    if (!test.Run())
+      state.SkipWithError("Elements aren't generated");
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+  test.Shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_SCsGenerate, TestSCsGenerateBySharedHelper)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100)->Arg(1000)
+->Iterations(1000);
+
+BENCHMARK_TEMPLATE(BM_SCsGenerate, TestSCsGenerateByNewHelper)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100)->Arg(1000)
+->Iterations(1000);
+
+BENCHMARK_TEMPLATE(BM_SCsGenerate, TestSCsGenerateBySharedHelperWithErasing)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100)->Arg(1000)
+->Iterations(1000);
 
 BENCHMARK_MAIN();
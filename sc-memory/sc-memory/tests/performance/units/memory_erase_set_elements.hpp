@@ -43,3 +43,42 @@ private:
 
 ScAddrList TestEraseSetElements::m_connectors;
 std::mutex TestEraseSetElements::m_mutex;
+
+class TestEraseSetElementsBatch : public TestMemory
+{
+public:
+  static size_t constexpr kBatchSize = 100;
+
+  void Run()
+  {
+    ScAddrVector addrs;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      for (size_t i = 0; i < kBatchSize && !m_connectors.empty(); ++i)
+      {
+        addrs.push_back(m_connectors.back());
+        m_connectors.pop_back();
+      }
+    }
+
+    m_ctx->EraseElements(addrs);
+  }
+
+  void Setup(size_t objectsNum) override
+  {
+    m_addr = m_ctx->GenerateNode(ScType::ConstNode);
+    for (size_t i = 0; i < objectsNum; ++i)
+    {
+      ScAddr target = m_ctx->GenerateNode(ScType::ConstNode);
+      m_connectors.push_back(m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_addr, target));
+    }
+  }
+
+private:
+  ScAddr m_addr;
+  static std::mutex m_mutex;
+  static ScAddrList m_connectors;
+};
+
+ScAddrList TestEraseSetElementsBatch::m_connectors;
+std::mutex TestEraseSetElementsBatch::m_mutex;
@@ -0,0 +1,49 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include <list>
+#include <mutex>
+#include <string>
+
+class TestResolveSystemIdentifier : public TestMemory
+{
+public:
+  void Run()
+  {
+    std::string idtf;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      idtf = m_idtfs.back();
+      m_idtfs.pop_back();
+    }
+
+    BENCHMARK_BUILTIN_EXPECT(m_ctx->SearchElementBySystemIdentifier(idtf).IsValid(), true);
+  }
+
+  void Setup(size_t objectsNum) override
+  {
+    for (size_t i = 0; i < objectsNum; ++i)
+    {
+      std::string idtf = "benchmark_system_identifier_" + std::to_string(i);
+
+      ScAddr const addr = m_ctx->GenerateNode(ScType::ConstNode);
+      BENCHMARK_BUILTIN_EXPECT(m_ctx->SetElementSystemIdentifier(idtf, addr), true);
+
+      m_idtfs.push_back(std::move(idtf));
+    }
+  }
+
+private:
+  static std::list<std::string> m_idtfs;
+  static std::mutex m_mutex;
+};
+
+std::list<std::string> TestResolveSystemIdentifier::m_idtfs;
+std::mutex TestResolveSystemIdentifier::m_mutex;
@@ -0,0 +1,91 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_scs_helper.hpp"
+#include "sc-memory/scs/scs_parser.hpp"
+
+#include <string>
+
+/*!
+ * Generates the same SCs-text with existing system and global identifiers again and again, as sc-builder generates
+ * many sources that use the same concepts.
+ */
+class TestSCsGenerate : public TestMemory
+{
+public:
+  bool Run()
+  {
+    if (IsHelperShared())
+      return m_helper->GenerateByParsedSCs(m_parser, m_outputStructure);
+
+    SCsHelper helper(*m_ctx, nullptr);
+    return helper.GenerateByParsedSCs(m_parser, m_outputStructure);
+  }
+
+  void Setup(size_t identifiersNum) override
+  {
+    std::string text;
+    for (size_t i = 0; i < identifiersNum; ++i)
+    {
+      std::string const index = std::to_string(i);
+      text += "benchmark_concept_" + index + " -> .benchmark_global_" + index + ";;\n";
+    }
+
+    BENCHMARK_BUILTIN_EXPECT(m_parser.Parse(text), true);
+
+    m_outputStructure = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+    m_helper = std::make_unique<SCsHelper>(*m_ctx, nullptr);
+    BENCHMARK_BUILTIN_EXPECT(m_helper->GenerateByParsedSCs(m_parser, m_outputStructure), true);
+  }
+
+  void Shutdown()
+  {
+    m_helper.reset();
+    TestMemory::Shutdown();
+  }
+
+protected:
+  virtual bool IsHelperShared() const = 0;
+
+  scs::Parser m_parser;
+  ScAddr m_outputStructure;
+  std::unique_ptr<SCsHelper> m_helper;
+};
+
+//! Identifiers are resolved once and reused from caches of helper
+class TestSCsGenerateBySharedHelper : public TestSCsGenerate
+{
+protected:
+  bool IsHelperShared() const override
+  {
+    return true;
+  }
+};
+
+//! Identifiers are resolved for every SCs-text, as without caches
+class TestSCsGenerateByNewHelper : public TestSCsGenerate
+{
+protected:
+  bool IsHelperShared() const override
+  {
+    return false;
+  }
+};
+
+//! Sc-element is erased before every SCs-text, so caches of helper are cleared and identifiers are resolved again
+class TestSCsGenerateBySharedHelperWithErasing : public TestSCsGenerateBySharedHelper
+{
+public:
+  bool Run()
+  {
+    m_ctx->EraseElement(m_ctx->GenerateNode(ScType::ConstNode));
+    return TestSCsGenerateBySharedHelper::Run();
+  }
+};
@@ -0,0 +1,81 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "sc-memory/scs/scs_parser.hpp"
+
+#include <string>
+
+class TestSCsParse
+{
+public:
+  void Initialize(size_t sentencesNum)
+  {
+    m_text = GenerateText(sentencesNum);
+  }
+
+  bool Run()
+  {
+    scs::Parser parser;
+    return parser.Parse(m_text);
+  }
+
+  size_t GetTextSize() const
+  {
+    return m_text.size();
+  }
+
+protected:
+  virtual std::string GenerateText(size_t sentencesNum) const = 0;
+
+private:
+  std::string m_text;
+};
+
+//! Sentences with connectors, attributes and lists of targets, that are parsed by fast parser
+class TestSCsParseCommonSentences : public TestSCsParse
+{
+protected:
+  std::string GenerateText(size_t sentencesNum) const override
+  {
+    std::string text;
+    for (size_t i = 0; i < sentencesNum; ++i)
+    {
+      std::string const index = std::to_string(i);
+      text += "concept_" + index + " -> rrel_1: element_" + index + "; element_" + index + "_next;\n"
+              "  => nrel_main_idtf: [Element " + index + "] (* <- lang_en;; *);;\n";
+    }
+    return text;
+  }
+};
+
+//! Sentences of level 1, that are parsed by fast parser
+class TestSCsParseLevel1Sentences : public TestSCsParse
+{
+protected:
+  std::string GenerateText(size_t sentencesNum) const override
+  {
+    std::string text;
+    for (size_t i = 0; i < sentencesNum; ++i)
+    {
+      std::string const index = std::to_string(i);
+      text += "sc_node_class#concept_" + index + " | sc_main_arc#..arc_" + index + " | sc_node#element_" + index
+              + ";;\n";
+    }
+    return text;
+  }
+};
+
+//! The same sentences with a contour at the beginning, that are parsed by ANTLR-generated parser
+class TestSCsParseSentencesWithContour : public TestSCsParseCommonSentences
+{
+protected:
+  std::string GenerateText(size_t sentencesNum) const override
+  {
+    return "contour = [* source -> target;; *];;\n" + TestSCsParseCommonSentences::GenerateText(sentencesNum);
+  }
+};
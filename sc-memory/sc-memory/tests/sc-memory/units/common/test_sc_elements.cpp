@@ -452,6 +452,44 @@ TEST_F(ScMemoryTest, EraseEdgeTargetsBetweenSomeNodesByOneIterator)
   EXPECT_FALSE(m_ctx->IsElement(nodeAddr2));
 }
 
+TEST_F(ScMemoryTest, EraseElements)
+{
+  ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const nodeAddr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const nodeAddr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const nodeAddr3 = m_ctx->GenerateNode(ScType::ConstNode);
+
+  ScAddr const arcAddr1 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr1);
+  ScAddr const arcAddr2 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr2);
+  ScAddr const arcAddr3 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr3);
+  ScAddr const arcAddr4 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr1, arcAddr3);
+
+  EXPECT_TRUE(m_ctx->EraseElements({nodeAddr1, arcAddr1, arcAddr2, nodeAddr1}));
+
+  EXPECT_FALSE(m_ctx->IsElement(nodeAddr1));
+  EXPECT_FALSE(m_ctx->IsElement(arcAddr1));
+  EXPECT_FALSE(m_ctx->IsElement(arcAddr2));
+  EXPECT_FALSE(m_ctx->IsElement(arcAddr4));
+  EXPECT_TRUE(m_ctx->IsElement(nodeAddr2));
+  EXPECT_TRUE(m_ctx->IsElement(arcAddr3));
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(classAddr), 1u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(arcAddr3), 0u);
+
+  EXPECT_FALSE(m_ctx->EraseElements({nodeAddr2, ScAddr::Empty, nodeAddr1}));
+  EXPECT_FALSE(m_ctx->IsElement(nodeAddr2));
+  EXPECT_TRUE(m_ctx->EraseElements({}));
+
+  ScAddrVector nodeAddrs;
+  for (size_t i = 0; i < 10; ++i)
+    nodeAddrs.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(m_ctx->EraseElements(nodeAddrs));
+  for (ScAddr const & nodeAddr : nodeAddrs)
+    EXPECT_FALSE(m_ctx->IsElement(nodeAddr));
+
+  for (size_t i = 0; i < 10; ++i)
+    EXPECT_TRUE(m_ctx->IsElement(m_ctx->GenerateNode(ScType::ConstNode)));
+}
+
 TEST(SmallScMemoryTest, FullMemory)
 {
   sc_memory_params params;
@@ -690,6 +728,182 @@ TEST(SmallScMemoryTest, DistributedMemory)
   ScMemory::LogUnmute();
 }
 
+TEST(SmallScMemoryTest, OfflineBuild)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.dump_memory = SC_FALSE;
+  params.dump_memory_statistics = SC_FALSE;
+
+  params.offline_build = SC_TRUE;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  ScAddr node;
+  ScAddr link;
+  ScAddr arcAddr;
+  ScAddr edgeAddr;
+  size_t const count = SC_SEGMENT_ELEMENTS_COUNT;
+  {
+    ScMemoryContext ctx;
+
+    // sc-elements are generated in the following sc-segment, when the previous one is full
+    node = ctx.GenerateNode(ScType::ConstNode);
+    for (size_t i = 0; i < count; ++i)
+    {
+      ScAddr const otherNode = ctx.GenerateNode(ScType::ConstNode);
+      EXPECT_TRUE(ctx.GenerateConnector(ScType::ConstPermPosArc, node, otherNode).IsValid());
+    }
+    EXPECT_EQ(ctx.GetElementEdgesAndOutgoingArcsCount(node), count);
+
+    link = ctx.GenerateLink(ScType::ConstNodeLink);
+    EXPECT_TRUE(ctx.SetLinkContent(link, "offline build content"));
+    arcAddr = ctx.GenerateConnector(ScType::ConstCommonArc, node, link);
+    edgeAddr = ctx.GenerateConnector(ScType::ConstCommonEdge, node, link);
+    EXPECT_TRUE(ctx.SetElementSystemIdentifier("offline_build_node", node));
+  }
+
+  ScMemory::LogMute();
+  ScMemory::Shutdown(true);
+  ScMemory::LogUnmute();
+
+  params.clear = SC_FALSE;
+  params.offline_build = SC_FALSE;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  {
+    ScMemoryContext ctx;
+    EXPECT_EQ(ctx.SearchElementBySystemIdentifier("offline_build_node"), node);
+    EXPECT_EQ(ctx.GetElementEdgesAndOutgoingArcsCount(node), count + 3);
+
+    std::string content;
+    EXPECT_TRUE(ctx.GetLinkContent(link, content));
+    EXPECT_EQ(content, "offline build content");
+    ScAddrSet const & links = ctx.SearchLinksByContent("offline build content");
+    EXPECT_EQ(links.size(), 1u);
+    EXPECT_EQ(links.count(link), 1u);
+
+    EXPECT_TRUE(ctx.CheckConnector(node, link, ScType::ConstCommonArc));
+    EXPECT_TRUE(ctx.CheckConnector(node, link, ScType::ConstCommonEdge));
+    EXPECT_EQ(ctx.GetArcSourceElement(arcAddr), node);
+    EXPECT_EQ(ctx.GetArcTargetElement(arcAddr), link);
+    EXPECT_TRUE(ctx.IsElement(edgeAddr));
+
+    size_t arcsCount = 0;
+    ScIterator3Ptr const it3 = ctx.CreateIterator3(node, ScType::ConstPermPosArc, ScType::ConstNode);
+    while (it3->Next())
+      ++arcsCount;
+    EXPECT_EQ(arcsCount, count);
+
+    // sc-memory can be changed online after offline build
+    ScAddr const otherNode = ctx.GenerateNode(ScType::ConstNode);
+    EXPECT_TRUE(ctx.GenerateConnector(ScType::ConstPermPosArc, otherNode, node).IsValid());
+    EXPECT_TRUE(ctx.EraseElement(link));
+    EXPECT_FALSE(ctx.IsElement(arcAddr));
+  }
+
+  ScMemory::LogMute();
+  ScMemory::Shutdown(false);
+  ScMemory::LogUnmute();
+}
+
+TEST(SmallScMemoryTest, OfflineBuildWithExtensions)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.dump_memory = SC_FALSE;
+  params.dump_memory_statistics = SC_FALSE;
+
+  params.offline_build = SC_TRUE;
+  params.extensions = "extensions";
+
+  sc_memory_context * context = nullptr;
+  ScMemory::LogMute();
+  EXPECT_EQ(sc_memory_initialize(&params, &context), nullptr);
+  EXPECT_EQ(sc_memory_shutdown(SC_FALSE), SC_RESULT_ERROR);
+  ScMemory::LogUnmute();
+  EXPECT_EQ(context, nullptr);
+}
+
+TEST(SmallScMemoryTest, SystemIdentifiersAfterRestart)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.dump_memory = SC_FALSE;
+  params.dump_memory_statistics = SC_FALSE;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  ScAddr node;
+  ScAddr otherNode;
+  ScSystemIdentifierQuintuple fiver;
+  {
+    ScMemoryContext ctx;
+    node = ctx.GenerateNode(ScType::ConstNode);
+    EXPECT_TRUE(ctx.SetElementSystemIdentifier("restarted_node", node, fiver));
+    otherNode = ctx.GenerateNode(ScType::ConstNode);
+    EXPECT_TRUE(ctx.SetElementSystemIdentifier("other_restarted_node", otherNode));
+  }
+
+  ScMemory::LogMute();
+  ScMemory::Shutdown(true);
+  ScMemory::LogUnmute();
+
+  params.clear = SC_FALSE;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  {
+    ScMemoryContext ctx;
+    EXPECT_EQ(ctx.SearchElementBySystemIdentifier("restarted_node"), node);
+    EXPECT_EQ(ctx.SearchElementBySystemIdentifier("other_restarted_node"), otherNode);
+
+    // fivers loaded from repo are removed from index when their sc-elements are erased
+    EXPECT_TRUE(ctx.EraseElement(fiver.addr4));
+    EXPECT_FALSE(ctx.SearchElementBySystemIdentifier("restarted_node").IsValid());
+    EXPECT_EQ(ctx.SearchElementBySystemIdentifier("other_restarted_node"), otherNode);
+  }
+
+  ScMemory::LogMute();
+  ScMemory::Shutdown(true);
+  ScMemory::LogUnmute();
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+
+  {
+    ScMemoryContext ctx;
+    EXPECT_FALSE(ctx.SearchElementBySystemIdentifier("restarted_node").IsValid());
+    EXPECT_EQ(ctx.SearchElementBySystemIdentifier("other_restarted_node"), otherNode);
+  }
+
+  ScMemory::LogMute();
+  ScMemory::Shutdown(false);
+  ScMemory::LogUnmute();
+}
+
 TEST(ScMemoryDumper, DumpMemory)
 {
   sc_memory_params params;
@@ -10,6 +10,8 @@
 #include <sc-memory/sc_link.hpp>
 
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 
 template <typename Type>
 void TestType(ScMemoryContext & ctx, Type const & value)
@@ -207,6 +209,59 @@ TEST_F(ScLinkTest, content_changed)
   ctx.Destroy();
 }
 
+TEST_F(ScLinkTest, mapped_file_content)
+{
+  ScMemoryContext ctx;
+
+  std::string const fileName = "mapped_link_content.txt";
+  std::string const content = "mapped file content";
+  {
+    std::ofstream file(fileName);
+    file << content;
+  }
+
+  ScAddr const linkAddr = ctx.GenerateLink();
+  EXPECT_TRUE(ctx.SetLinkContent(linkAddr, std::make_shared<ScStreamMappedFile>(fileName)));
+
+  std::string linkContent;
+  EXPECT_TRUE(ctx.GetLinkContent(linkAddr, linkContent));
+  EXPECT_EQ(linkContent, content);
+
+  ScStreamPtr const stream = ctx.GetLinkContent(linkAddr);
+  sc_char const * data = nullptr;
+  size_t size = 0;
+  EXPECT_TRUE(stream->View(data, size));
+  EXPECT_EQ(std::string(data, size), content);
+
+  // file contents aren't indexed, and path to file isn't sc-link content
+  EXPECT_TRUE(ctx.SearchLinksByContent(content).empty());
+  EXPECT_TRUE(ctx.SearchLinksByContent(fileName).empty());
+
+  std::filesystem::remove(fileName);
+  EXPECT_THROW(ctx.GetLinkContent(linkAddr), utils::ExceptionInvalidState);
+}
+
+TEST_F(ScLinkTest, file_path_content)
+{
+  ScMemoryContext ctx;
+
+  // strings that look like paths to files are plain contents
+  std::string const fileName = "file_path_content.txt";
+  {
+    std::ofstream file(fileName);
+    file << "file content";
+  }
+
+  ScAddr const linkAddr = ctx.GenerateLink();
+  EXPECT_TRUE(ctx.SetLinkContent(linkAddr, fileName));
+
+  std::string linkContent;
+  EXPECT_TRUE(ctx.GetLinkContent(linkAddr, linkContent));
+  EXPECT_EQ(linkContent, fileName);
+
+  std::filesystem::remove(fileName);
+}
+
 TEST_F(ScLinkTest, set_system_idtf)
 {
   ScMemoryContext ctx;
@@ -267,6 +322,39 @@ TEST_F(ScLinkTest, find_links_by_substr)
   ctx.Destroy();
 }
 
+TEST_F(ScLinkTest, find_links_by_content_range)
+{
+  ScMemoryContext ctx;
+
+  ScLink link1 = ScLink(ctx, ctx.GenerateLink());
+  EXPECT_TRUE(link1.Set<double>(12345.5));
+  ScLink link2 = ScLink(ctx, ctx.GenerateLink());
+  EXPECT_TRUE(link2.Set<int64_t>(12350));
+  ScLink link3 = ScLink(ctx, ctx.GenerateLink());
+  EXPECT_TRUE(link3.Set<uint32_t>(12347));
+  ScLink link4 = ScLink(ctx, ctx.GenerateLink());
+  EXPECT_TRUE(link4.Set<std::string>("12348 apples"));
+
+  ScAddrVector linkVector = ctx.SearchLinksByContentRange(12345, 12400);
+  EXPECT_EQ(linkVector, ScAddrVector({link1, link3, link2}));
+
+  linkVector = ctx.SearchLinksByContentRange(12346, 12349);
+  EXPECT_EQ(linkVector, ScAddrVector({link3}));
+
+  EXPECT_TRUE(link3.Set<std::string>("not a number"));
+  EXPECT_TRUE(link4.Set<std::string>("12348"));
+  linkVector = ctx.SearchLinksByContentRange(12345, 12400);
+  EXPECT_EQ(linkVector, ScAddrVector({link1, link4, link2}));
+
+  ctx.EraseElement(link1);
+  linkVector = ctx.SearchLinksByContentRange(12345, 12400);
+  EXPECT_EQ(linkVector, ScAddrVector({link4, link2}));
+
+  EXPECT_TRUE(ctx.SearchLinksByContentRange(12400, 12345).empty());
+
+  ctx.Destroy();
+}
+
 TEST_F(ScLinkTest, find_strings_by_substr)
 {
   ScMemoryContext ctx;
@@ -107,6 +107,60 @@ TEST_F(ScMemoryAPITest, SetGetSystemIdentifierErrorSetTwice)
   EXPECT_FALSE(m_ctx->SetElementSystemIdentifier("test_node", otherAddr));
 }
 
+TEST_F(ScMemoryAPITest, FindSystemIdentifierAfterErasingItsConnector)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  ScSystemIdentifierQuintuple fiver;
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr, fiver));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->EraseElement(fiver.addr2));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+
+  // erased sc-connector address is reused by new sc-connector that doesn't connect sc-element with system identifier
+  ScAddr const & otherAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->GenerateConnector(ScType::ConstCommonArc, otherAddr, fiver.addr3).IsValid());
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", otherAddr));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), otherAddr);
+}
+
+TEST_F(ScMemoryAPITest, FindSystemIdentifierAfterErasingItsLink)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  ScSystemIdentifierQuintuple fiver;
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr, fiver));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->EraseElement(fiver.addr3));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+
+  ScAddr const & link = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  EXPECT_TRUE(m_ctx->SetLinkContent(link, "test_node"));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+}
+
+TEST_F(ScMemoryAPITest, FindSystemIdentifierAfterChangingLinkContent)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  ScSystemIdentifierQuintuple fiver;
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr, fiver));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->SetLinkContent(fiver.addr3, "other_test_node"));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node").IsValid());
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("other_test_node"), addr);
+  EXPECT_EQ(m_ctx->GetElementSystemIdentifier(addr), "other_test_node");
+
+  EXPECT_TRUE(m_ctx->SetLinkContent(fiver.addr3, "test_node"));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("other_test_node").IsValid());
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+}
+
 TEST_F(ScMemoryAPITest, ResolveGetSystemIdentifier)
 {
   ScAddr const & addr = m_ctx->ResolveElementSystemIdentifier("test_node", ScType::ConstNode);
@@ -6,6 +6,7 @@
 
 #include <sc-memory/test/sc_test.hpp>
 
+#include <atomic>
 #include <thread>
 
 #include <sc-memory/sc_event.hpp>
@@ -393,6 +394,35 @@ TEST_F(ScMemoryTestWithUserMode, GetUserAddrFromContext)
   EXPECT_EQ(userContext.GetUser(), userAddr);
 }
 
+TEST_F(ScMemoryTestWithUserMode, ResolveAndFreeContextsOfUserInParallel)
+{
+  ScAddr const & userAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::vector<std::thread> threads;
+  std::atomic_uint validContextsCount = 0;
+  size_t const threadsCount = 8;
+  size_t const contextsCount = 1000;
+  for (size_t i = 0; i < threadsCount; ++i)
+    threads.emplace_back(
+        [&]()
+        {
+          for (size_t j = 0; j < contextsCount; ++j)
+          {
+            TestScMemoryContext userContext{userAddr};
+            if (userContext.IsValid() && userContext.GetUser() == userAddr)
+              ++validContextsCount;
+          }
+        });
+
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_EQ(validContextsCount.load(), threadsCount * contextsCount);
+
+  TestScMemoryContext userContext{userAddr};
+  EXPECT_EQ(userContext.GetUser(), userAddr);
+}
+
 TEST_F(ScMemoryTestWithUserMode, GetGuestUserAddrFromContext)
 {
   TestScMemoryContext userContext;
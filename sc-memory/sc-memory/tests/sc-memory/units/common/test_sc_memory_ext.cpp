@@ -0,0 +1,302 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include <sc-memory/test/sc_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+extern "C"
+{
+#include <sc-core/sc_helper.h>
+
+#include <sc_memory_ext_private.h>
+}
+
+namespace
+{
+
+size_t constexpr kModulesCount = 5;
+
+struct ModulesLog
+{
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  size_t m_eventsCount = 0;
+  size_t m_startEvents[kModulesCount] = {};
+  size_t m_endEvents[kModulesCount] = {};
+  size_t m_shutdownEvents[kModulesCount] = {};
+  std::atomic<size_t> m_activeCount = 0;
+  std::atomic<size_t> m_maxActiveCount = 0;
+  size_t m_startedCount = 0;
+  bool m_isWaiting = false;
+  bool m_isFailing = false;
+};
+
+ModulesLog * modulesLog;
+
+template <size_t index>
+sc_result InitializeModule(sc_addr)
+{
+  {
+    std::lock_guard<std::mutex> lock(modulesLog->m_mutex);
+    modulesLog->m_startEvents[index] = ++modulesLog->m_eventsCount;
+  }
+
+  size_t const activeCount = ++modulesLog->m_activeCount;
+  size_t maxActiveCount = modulesLog->m_maxActiveCount;
+  while (activeCount > maxActiveCount
+         && !modulesLog->m_maxActiveCount.compare_exchange_weak(maxActiveCount, activeCount))
+    ;
+
+  sc_result result = SC_RESULT_OK;
+  if (modulesLog->m_isWaiting)
+  {
+    // module is initialized only if other module is initialized at the same time
+    std::unique_lock<std::mutex> lock(modulesLog->m_mutex);
+    ++modulesLog->m_startedCount;
+    modulesLog->m_cond.notify_all();
+    if (!modulesLog->m_cond.wait_for(
+            lock,
+            std::chrono::seconds(5),
+            []
+            {
+              return modulesLog->m_startedCount == 2;
+            }))
+      result = SC_RESULT_ERROR;
+  }
+  else
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  --modulesLog->m_activeCount;
+
+  {
+    std::lock_guard<std::mutex> lock(modulesLog->m_mutex);
+    modulesLog->m_endEvents[index] = ++modulesLog->m_eventsCount;
+  }
+
+  return index == 0 && modulesLog->m_isFailing ? SC_RESULT_ERROR : result;
+}
+
+template <size_t index>
+sc_result ShutdownModule()
+{
+  std::lock_guard<std::mutex> lock(modulesLog->m_mutex);
+  modulesLog->m_shutdownEvents[index] = ++modulesLog->m_eventsCount;
+  return SC_RESULT_OK;
+}
+
+class ScMemoryExtTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    modulesLog = &m_log;
+  }
+
+  void TearDown() override
+  {
+    g_list_free(m_modules);
+    modulesLog = nullptr;
+  }
+
+  void AddModule(sc_module_info & module, sc_bool hasPriority, sc_uint32 priority)
+  {
+    module.ptr = nullptr;
+    module.path = (sc_char *)"test-module";
+    module.has_priority = hasPriority;
+    module.priority = hasPriority ? priority : G_MAXUINT32;
+    module.init_result = SC_RESULT_OK;
+    module.init_time = 0;
+    m_modules = g_list_append(m_modules, &module);
+  }
+
+  template <size_t... indices>
+  void SetModulesFunctions(std::index_sequence<indices...>)
+  {
+    ((m_infos[indices].init_func = InitializeModule<indices>, m_infos[indices].shut_func = ShutdownModule<indices>),
+     ...);
+  }
+
+  void InitializeModules()
+  {
+    SetModulesFunctions(std::make_index_sequence<kModulesCount>());
+    _sc_ext_initialize_modules(m_modules, SC_ADDR_EMPTY);
+  }
+
+  ModulesLog m_log;
+  sc_module_info m_infos[kModulesCount] = {};
+  GList * m_modules = nullptr;
+};
+
+size_t constexpr kResolvedIdentifiersCount = 50;
+
+struct ResolvedKeynodes
+{
+  std::atomic<size_t> m_startedCount = 0;
+  std::vector<sc_addr> m_keynodes[2];
+};
+
+ResolvedKeynodes * resolvedKeynodes;
+
+template <size_t index>
+sc_result InitializeResolvingModule(sc_addr)
+{
+  // modules start resolving together to resolve the same system identifiers at the same time
+  ++resolvedKeynodes->m_startedCount;
+  while (resolvedKeynodes->m_startedCount < 2)
+    std::this_thread::yield();
+
+  ScMemoryContext context;
+  for (size_t i = 0; i < kResolvedIdentifiersCount; ++i)
+  {
+    std::string const identifier = "concurrent_module_keynode_" + std::to_string(i);
+    sc_addr keynode;
+    if (sc_helper_resolve_system_identifier(*context, identifier.c_str(), &keynode) == SC_FALSE)
+      return SC_RESULT_ERROR;
+    resolvedKeynodes->m_keynodes[index].push_back(keynode);
+  }
+
+  return SC_RESULT_OK;
+}
+
+sc_result ShutdownResolvingModule()
+{
+  return SC_RESULT_OK;
+}
+
+class ScMemoryExtKeynodesTest : public ScMemoryTest
+{
+protected:
+  void SetUp() override
+  {
+    ScMemoryTest::SetUp();
+    resolvedKeynodes = &m_keynodes;
+  }
+
+  void TearDown() override
+  {
+    g_list_free(m_modules);
+    resolvedKeynodes = nullptr;
+    ScMemoryTest::TearDown();
+  }
+
+  template <size_t index>
+  void AddResolvingModule()
+  {
+    sc_module_info & module = m_infos[index];
+    module.ptr = nullptr;
+    module.path = (sc_char *)"test-resolving-module";
+    module.has_priority = SC_TRUE;
+    module.priority = 1;
+    module.init_func = InitializeResolvingModule<index>;
+    module.shut_func = ShutdownResolvingModule;
+    module.init_result = SC_RESULT_OK;
+    module.init_time = 0;
+    m_modules = g_list_append(m_modules, &module);
+  }
+
+  ResolvedKeynodes m_keynodes;
+  sc_module_info m_infos[2] = {};
+  GList * m_modules = nullptr;
+};
+
+}  // namespace
+
+TEST_F(ScMemoryExtTest, ModulesAreInitializedByPriorities)
+{
+  AddModule(m_infos[0], SC_TRUE, 1);
+  AddModule(m_infos[1], SC_TRUE, 1);
+  AddModule(m_infos[2], SC_TRUE, 2);
+  AddModule(m_infos[3], SC_FALSE, 0);
+  AddModule(m_infos[4], SC_FALSE, 0);
+  InitializeModules();
+
+  // the next priority is initialized after all modules of the previous one
+  EXPECT_LT(m_log.m_endEvents[0], m_log.m_startEvents[2]);
+  EXPECT_LT(m_log.m_endEvents[1], m_log.m_startEvents[2]);
+  EXPECT_LT(m_log.m_endEvents[2], m_log.m_startEvents[3]);
+  EXPECT_LT(m_log.m_endEvents[3], m_log.m_startEvents[4]);
+
+  for (sc_module_info const & module : m_infos)
+    EXPECT_EQ(module.init_result, SC_RESULT_OK);
+  for (size_t const shutdownEvent : m_log.m_shutdownEvents)
+    EXPECT_EQ(shutdownEvent, 0u);
+}
+
+TEST_F(ScMemoryExtTest, FailedModuleIsShutdownAfterItsPriority)
+{
+  m_log.m_isFailing = true;
+  AddModule(m_infos[0], SC_TRUE, 1);
+  AddModule(m_infos[1], SC_TRUE, 1);
+  AddModule(m_infos[2], SC_TRUE, 2);
+  InitializeModules();
+
+  EXPECT_EQ(m_infos[0].init_result, SC_RESULT_ERROR);
+  EXPECT_EQ(m_infos[1].init_result, SC_RESULT_OK);
+  EXPECT_EQ(m_infos[2].init_result, SC_RESULT_OK);
+
+  EXPECT_GT(m_log.m_shutdownEvents[0], m_log.m_endEvents[1]);
+  EXPECT_LT(m_log.m_shutdownEvents[0], m_log.m_startEvents[2]);
+  EXPECT_EQ(m_log.m_shutdownEvents[1], 0u);
+  EXPECT_EQ(m_log.m_shutdownEvents[2], 0u);
+}
+
+TEST_F(ScMemoryExtTest, ModulesWithSamePriorityAreInitializedConcurrently)
+{
+  if (g_get_num_processors() < 2)
+    GTEST_SKIP() << "Modules are initialized concurrently only on several processors";
+
+  m_log.m_isWaiting = true;
+  AddModule(m_infos[0], SC_TRUE, 1);
+  AddModule(m_infos[1], SC_TRUE, 1);
+  InitializeModules();
+
+  EXPECT_EQ(m_infos[0].init_result, SC_RESULT_OK);
+  EXPECT_EQ(m_infos[1].init_result, SC_RESULT_OK);
+  EXPECT_EQ(m_log.m_maxActiveCount, 2u);
+}
+
+TEST_F(ScMemoryExtTest, ModulesWithoutPriorityAreInitializedOneByOne)
+{
+  AddModule(m_infos[0], SC_FALSE, 0);
+  AddModule(m_infos[1], SC_FALSE, 0);
+  AddModule(m_infos[2], SC_FALSE, 0);
+  InitializeModules();
+
+  EXPECT_EQ(m_log.m_maxActiveCount, 1u);
+  EXPECT_LT(m_log.m_endEvents[0], m_log.m_startEvents[1]);
+  EXPECT_LT(m_log.m_endEvents[1], m_log.m_startEvents[2]);
+}
+
+TEST_F(ScMemoryExtKeynodesTest, ModulesWithSamePriorityResolveTheSameKeynodes)
+{
+  AddResolvingModule<0>();
+  AddResolvingModule<1>();
+  _sc_ext_initialize_modules(m_modules, SC_ADDR_EMPTY);
+
+  EXPECT_EQ(m_infos[0].init_result, SC_RESULT_OK);
+  EXPECT_EQ(m_infos[1].init_result, SC_RESULT_OK);
+  ASSERT_EQ(m_keynodes.m_keynodes[0].size(), kResolvedIdentifiersCount);
+  ASSERT_EQ(m_keynodes.m_keynodes[1].size(), kResolvedIdentifiersCount);
+
+  for (size_t i = 0; i < kResolvedIdentifiersCount; ++i)
+  {
+    EXPECT_TRUE(SC_ADDR_IS_EQUAL(m_keynodes.m_keynodes[0][i], m_keynodes.m_keynodes[1][i]));
+
+    // system identifier is set once, so there is one sc-link with it
+    std::string const identifier = "concurrent_module_keynode_" + std::to_string(i);
+    EXPECT_EQ(m_ctx->SearchLinksByContent(identifier).size(), 1u);
+  }
+}
@@ -8,6 +8,9 @@
 
 #include <sc-memory/sc_memory.hpp>
 
+#include <filesystem>
+#include <fstream>
+
 TEST(ScStreamTest, common)
 {
   uint32_t const length = 1024;
@@ -66,3 +69,57 @@ TEST(ScStreamTest, MakeSmoke)
   stream = ScStreamMakeRead(float(7.f));
   stream = ScStreamMakeRead(double(7.0));
 }
+
+TEST(ScStreamTest, MemoryView)
+{
+  std::string const content = "stream content";
+  ScStreamPtr const stream = ScStreamMakeRead(content);
+
+  sc_char const * data = nullptr;
+  size_t size = 0;
+  EXPECT_TRUE(stream->View(data, size));
+  EXPECT_EQ(std::string(data, size), content);
+}
+
+TEST(ScStreamTest, MappedFile)
+{
+  std::string const fileName = "mapped_file_stream.bin";
+  std::string const content("mapped\0file\xff content", 20);
+  {
+    std::ofstream file(fileName, std::ios::binary);
+    file.write(content.data(), content.size());
+  }
+
+  ScStreamPtr const stream = std::make_shared<ScStreamMappedFile>(fileName);
+  EXPECT_TRUE(stream->IsValid());
+  EXPECT_TRUE(stream->HasFlag(SC_STREAM_FLAG_READ));
+  EXPECT_FALSE(stream->HasFlag(SC_STREAM_FLAG_WRITE));
+  EXPECT_EQ(stream->Size(), content.size());
+
+  sc_char const * data = nullptr;
+  size_t size = 0;
+  EXPECT_TRUE(stream->View(data, size));
+  EXPECT_EQ(std::string(data, size), content);
+
+  sc_char buff[6];
+  size_t readBytes;
+  EXPECT_TRUE(stream->Seek(SC_STREAM_SEEK_SET, 0));
+  EXPECT_TRUE(stream->Read(buff, sizeof(buff), readBytes));
+  EXPECT_EQ(readBytes, sizeof(buff));
+  EXPECT_EQ(std::string(buff, readBytes), "mapped");
+  EXPECT_EQ(stream->Pos(), sizeof(buff));
+
+  // stream is converted from its current position
+  std::string result;
+  EXPECT_TRUE(ScStreamConverter::StreamToString(stream, result));
+  EXPECT_EQ(result, content.substr(sizeof(buff)));
+  EXPECT_EQ(stream->Pos(), content.size());
+
+  std::filesystem::remove(fileName);
+}
+
+TEST(ScStreamTest, MappedFileNotExist)
+{
+  ScStreamMappedFile stream("not_existing_mapped_file.bin");
+  EXPECT_FALSE(stream.IsValid());
+}
@@ -9,6 +9,8 @@
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_structure.hpp>
 
+#include <filesystem>
+
 using ScStructTest = ScMemoryTest;
 
 TEST_F(ScStructTest, AppendIterateElements)
@@ -91,3 +93,100 @@ TEST_F(ScStructTest, AppendItSelf)
 
   EXPECT_TRUE(setCopy.HasElement(setCopy));
 }
+
+TEST_F(ScStructTest, ExportImportStructure)
+{
+  ScStructure structure = m_ctx->GenerateStructure();
+
+  ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("exported_class", classAddr));
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  EXPECT_TRUE(m_ctx->SetLinkContent(linkAddr, "exported content"));
+  ScAddr const arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr);
+  ScAddr const edgeAddr = m_ctx->GenerateConnector(ScType::ConstCommonEdge, nodeAddr, linkAddr);
+  // this sc-node isn't in sc-structure, but it is written as incident sc-element of sc-arc
+  ScAddr const outerNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const outerArcAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, arcAddr, outerNodeAddr);
+
+  structure << classAddr << nodeAddr << linkAddr << arcAddr << edgeAddr << outerArcAddr;
+
+  std::string const fileName = "exported_structure.scsb";
+  m_ctx->ExportStructure(structure, std::make_shared<ScStream>(fileName, SC_STREAM_FLAG_WRITE));
+
+  ScAddr const importedStructureAddr =
+      m_ctx->ImportStructure(std::make_shared<ScStream>(fileName, SC_STREAM_FLAG_READ));
+  EXPECT_TRUE(importedStructureAddr.IsValid());
+  EXPECT_NE(importedStructureAddr, structure);
+  EXPECT_EQ(m_ctx->GetElementType(importedStructureAddr), ScType::ConstNodeStructure);
+
+  ScAddrUnorderedSet importedElements;
+  ScIterator3Ptr it3 = m_ctx->CreateIterator3(importedStructureAddr, ScType::ConstPermPosArc, ScType::Unknown);
+  while (it3->Next())
+    importedElements.insert(it3->Get(2));
+  EXPECT_EQ(importedElements.size(), 6u);
+
+  // sc-element with system identifier is reused
+  EXPECT_TRUE(importedElements.count(classAddr));
+  EXPECT_EQ(m_ctx->GetElementSystemIdentifier(classAddr), "exported_class");
+  EXPECT_FALSE(importedElements.count(nodeAddr));
+
+  ScAddr importedArcAddr;
+  ScAddr importedNodeAddr;
+  it3 = m_ctx->CreateIterator3(classAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+  while (it3->Next())
+  {
+    if (importedElements.count(it3->Get(1)))
+    {
+      importedArcAddr = it3->Get(1);
+      importedNodeAddr = it3->Get(2);
+    }
+  }
+  ASSERT_TRUE(importedArcAddr.IsValid());
+  EXPECT_TRUE(importedElements.count(importedNodeAddr));
+
+  it3 = m_ctx->CreateIterator3(importedNodeAddr, ScType::ConstCommonEdge, ScType::ConstNodeLink);
+  ASSERT_TRUE(it3->Next());
+  EXPECT_TRUE(importedElements.count(it3->Get(1)));
+  EXPECT_TRUE(importedElements.count(it3->Get(2)));
+  EXPECT_NE(it3->Get(2), linkAddr);
+
+  std::string content;
+  EXPECT_TRUE(m_ctx->GetLinkContent(it3->Get(2), content));
+  EXPECT_EQ(content, "exported content");
+
+  it3 = m_ctx->CreateIterator3(importedArcAddr, ScType::ConstCommonArc, ScType::ConstNode);
+  ASSERT_TRUE(it3->Next());
+  EXPECT_TRUE(importedElements.count(it3->Get(1)));
+  EXPECT_FALSE(importedElements.count(it3->Get(2)));
+  EXPECT_NE(it3->Get(2), outerNodeAddr);
+
+  std::filesystem::remove(fileName);
+}
+
+TEST_F(ScStructTest, ImportInvalidStructure)
+{
+  EXPECT_THROW(m_ctx->ImportStructure(ScStreamMakeRead("not a structure")), utils::ExceptionParseError);
+  EXPECT_THROW(m_ctx->ImportStructure(nullptr), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScStructTest, ImportStructureWithInvalidLengths)
+{
+  // header and sc-node record with flags of system identifier and content, then only length of its data
+  auto const & MakeRecord = [](sc_uint8 flags, std::string const & length)
+  {
+    std::string data{"SCSB"};
+    data.append("\x01\x00\x00\x00", 4);
+    data.push_back(1);
+    data.append("\x00\x00", 2);
+    data.push_back(flags);
+    data.append(length);
+    return ScStreamMakeRead(data);
+  };
+
+  EXPECT_THROW(m_ctx->ImportStructure(MakeRecord(1 << 1, std::string(4, '\xff'))), utils::ExceptionParseError);
+  EXPECT_THROW(m_ctx->ImportStructure(MakeRecord(1 << 2, std::string(8, '\xff'))), utils::ExceptionParseError);
+  EXPECT_THROW(
+      m_ctx->ImportStructure(MakeRecord(1 << 2, std::string("\x10\x00\x00\x00\x00\x00\x00\x00", 8))),
+      utils::ExceptionParseError);
+}
@@ -1263,6 +1263,52 @@ TEST_F(ScEventTest, PendEvents)
   EXPECT_EQ(passedCount, el_num);
 }
 
+TEST_F(ScEventTest, PendEventsOfSeveralElements)
+{
+  ScAddr const nodeAddr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const nodeAddr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const targetAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_uint eventsCount1(0);
+  auto eventSubscription1 =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr1,
+          [&eventsCount1](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            eventsCount1.fetch_add(1);
+          });
+
+  std::atomic_uint eventsCount2(0);
+  auto eventSubscription2 =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr2,
+          [&eventsCount2](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            eventsCount2.fetch_add(1);
+          });
+
+  size_t const arcsCount = 3000;
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx);
+    for (size_t i = 0; i < arcsCount; ++i)
+    {
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr1, targetAddr);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr2, targetAddr);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(eventsCount1.load(), 0u);
+    EXPECT_EQ(eventsCount2.load(), 0u);
+  }
+
+  // wait all events
+  while (eventsCount1.load() < arcsCount || eventsCount2.load() < arcsCount)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(eventsCount1.load(), arcsCount);
+  EXPECT_EQ(eventsCount2.load(), arcsCount);
+}
+
 TEST_F(ScEventTest, BlockEventsAndNotEmitAfter)
 {
   ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
@@ -1,5 +1,6 @@
 #include <sc-memory/test/sc_test.hpp>
 
+#include <sc-memory/sc_keynodes.hpp>
 #include <sc-memory/sc_link.hpp>
 #include <sc-memory/sc_memory.hpp>
 
@@ -370,6 +371,122 @@ TEST_F(SCsHelperTest, GenerateStructureAppendToStructure)
   );
 }
 
+TEST_F(SCsHelperTest, GenerateBySCs_IdentifiersCache)
+{
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
+
+  ScAddr const outputStructure = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  EXPECT_TRUE(outputStructure.IsValid());
+
+  EXPECT_TRUE(helper.GenerateBySCsText(
+      "cached_concept -> cached_instance;; .cached_global -> cached_instance;;", outputStructure));
+  ScAddr const conceptAddr = m_ctx->SearchElementBySystemIdentifier("cached_concept");
+  ScAddr const instanceAddr = m_ctx->SearchElementBySystemIdentifier("cached_instance");
+  EXPECT_EQ(m_ctx->GetElementType(conceptAddr), ScType::ConstNode);
+
+  // cached sc-elements are extended by types from next SCs-texts
+  EXPECT_TRUE(helper.GenerateBySCsText(
+      "sc_node_class -> cached_concept;; .cached_global -> cached_concept;;", outputStructure));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("cached_concept"), conceptAddr);
+  EXPECT_EQ(m_ctx->GetElementType(conceptAddr), ScType::ConstNodeClass);
+
+  ScTemplate templ;
+  m_ctx->BuildTemplate(templ, "_global _-> cached_instance;; _global _-> cached_concept;;");
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 1u);
+
+  // sc-elements are appended to output structure once
+  size_t conceptArcsCount = 0;
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(outputStructure, ScType::ConstPermPosArc, conceptAddr);
+  while (it3->Next())
+    ++conceptArcsCount;
+  EXPECT_EQ(conceptArcsCount, 1u);
+
+  // erased cached sc-elements are generated again
+  EXPECT_TRUE(m_ctx->EraseElement(instanceAddr));
+  EXPECT_TRUE(helper.GenerateBySCsText("cached_concept -> cached_instance;;", outputStructure));
+  ScAddr const newInstanceAddr = m_ctx->SearchElementBySystemIdentifier("cached_instance");
+  EXPECT_TRUE(m_ctx->IsElement(newInstanceAddr));
+  EXPECT_TRUE(m_ctx->CheckConnector(conceptAddr, newInstanceAddr, ScType::ConstPermPosArc));
+  EXPECT_TRUE(m_ctx->CheckConnector(outputStructure, newInstanceAddr, ScType::ConstPermPosArc));
+}
+
+TEST_F(SCsHelperTest, GenerateBySCs_IdentifiersCacheAfterChanges)
+{
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
+
+  ScAddr const outputStructure = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  EXPECT_TRUE(helper.GenerateBySCsText("cached_concept -> .cached_global;;", outputStructure));
+  ScSystemIdentifierQuintuple fiver;
+  EXPECT_TRUE(m_ctx->SearchElementBySystemIdentifier("cached_concept", fiver));
+  ScAddr const conceptAddr = fiver.addr1;
+
+  auto const & CountArcs = [this](ScAddr const & sourceAddr, ScAddr const & targetAddr)
+  {
+    size_t arcsCount = 0;
+    ScIterator3Ptr const it3 = m_ctx->CreateIterator3(sourceAddr, ScType::ConstPermPosArc, targetAddr);
+    while (it3->Next())
+      ++arcsCount;
+    return arcsCount;
+  };
+
+  // erased sc-element with system identifier isn't resolved by it
+  EXPECT_TRUE(m_ctx->EraseElement(conceptAddr));
+  EXPECT_TRUE(helper.GenerateBySCsText("cached_concept -> .cached_global;;", outputStructure));
+  ScAddr const newConceptAddr = m_ctx->SearchElementBySystemIdentifier("cached_concept");
+  EXPECT_TRUE(newConceptAddr.IsValid());
+  EXPECT_NE(newConceptAddr, conceptAddr);
+  EXPECT_TRUE(m_ctx->IsElement(newConceptAddr));
+
+  // sc-element which global identifier is erased isn't resolved by it
+  ScTemplate templ;
+  m_ctx->BuildTemplate(templ, "cached_concept _-> _global;;");
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 1u);
+  ScAddr const globalAddr = result[0]["_global"];
+  ScIterator5Ptr const it5 = m_ctx->CreateIterator5(
+      globalAddr, ScType::ConstCommonArc, ScType::NodeLink, ScType::ConstPermPosArc, ScKeynodes::nrel_scs_global_idtf);
+  EXPECT_TRUE(it5->Next());
+  EXPECT_TRUE(m_ctx->EraseElement(it5->Get(2)));
+  EXPECT_TRUE(helper.GenerateBySCsText("other_concept -> .cached_global;;", outputStructure));
+  ScAddr const otherConceptAddr = m_ctx->SearchElementBySystemIdentifier("other_concept");
+  EXPECT_EQ(CountArcs(otherConceptAddr, globalAddr), 0u);
+  ScTemplate otherTempl;
+  m_ctx->BuildTemplate(otherTempl, "other_concept _-> _global;;");
+  ScTemplateSearchResult otherResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(otherTempl, otherResult));
+  EXPECT_EQ(otherResult.Size(), 1u);
+  EXPECT_NE(otherResult[0]["_global"], globalAddr);
+
+  // sc-element which sc-connector from output structure is erased is appended to output structure again
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(outputStructure, ScType::ConstPermPosArc, newConceptAddr);
+  EXPECT_TRUE(it3->Next());
+  EXPECT_TRUE(m_ctx->EraseElement(it3->Get(1)));
+  EXPECT_EQ(CountArcs(outputStructure, newConceptAddr), 0u);
+  EXPECT_TRUE(helper.GenerateBySCsText("cached_concept -> other_instance;;", outputStructure));
+  EXPECT_EQ(CountArcs(outputStructure, newConceptAddr), 1u);
+}
+
+TEST_F(SCsHelperTest, GenerateBySCs_AppendToFilledStructure)
+{
+  ScAddr const outputStructure = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  ScAddr const conceptAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("filled_concept", conceptAddr));
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, outputStructure, conceptAddr);
+
+  // sc-elements that are already in output structure aren't appended to it again
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
+  EXPECT_TRUE(helper.GenerateBySCsText("filled_concept -> filled_instance;;", outputStructure));
+
+  size_t arcsCount = 0;
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(outputStructure, ScType::ConstPermPosArc, conceptAddr);
+  while (it3->Next())
+    ++arcsCount;
+  EXPECT_EQ(arcsCount, 1u);
+}
+
 TEST_F(SCsHelperTest, FindTriplesSmoke)
 {
   SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
@@ -0,0 +1,124 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#include <gtest/gtest.h>
+
+#include "sc-memory/scs/scs_parser.hpp"
+
+#include "test_scs_utils.hpp"
+
+namespace
+{
+
+// Contours aren't supported by fast parser, so text with this sentence is parsed by ANTLR-generated parser
+std::string const kFallbackSentence = "..fallback_contour = [* ..fallback_source -> ..fallback_target;; *];;";
+
+void ExpectEqualElements(scs::ParsedElement const & fastElement, scs::ParsedElement const & element)
+{
+  EXPECT_EQ(fastElement.GetIdtf(), element.GetIdtf());
+  EXPECT_EQ(fastElement.GetType(), element.GetType());
+  EXPECT_EQ(fastElement.GetVisibility(), element.GetVisibility());
+  EXPECT_EQ(fastElement.GetValue(), element.GetValue());
+  EXPECT_EQ(fastElement.IsURL(), element.IsURL());
+}
+
+void ExpectEqualParsing(std::string const & data)
+{
+  scs::Parser fastParser;
+  EXPECT_TRUE(fastParser.Parse(data)) << data;
+
+  scs::Parser parser;
+  EXPECT_TRUE(parser.Parse(data + kFallbackSentence)) << data;
+
+  auto const & fastTriples = fastParser.GetParsedTriples();
+  auto const & triples = parser.GetParsedTriples();
+  EXPECT_FALSE(fastTriples.empty()) << data;
+  ASSERT_LT(fastTriples.size(), triples.size()) << data;
+
+  for (size_t i = 0; i < fastTriples.size(); ++i)
+  {
+    ExpectEqualElements(
+        fastParser.GetParsedElement(fastTriples[i].m_source), parser.GetParsedElement(triples[i].m_source));
+    ExpectEqualElements(
+        fastParser.GetParsedElement(fastTriples[i].m_connector), parser.GetParsedElement(triples[i].m_connector));
+    ExpectEqualElements(
+        fastParser.GetParsedElement(fastTriples[i].m_target), parser.GetParsedElement(triples[i].m_target));
+  }
+}
+
+}  // namespace
+
+TEST(scs_fast_parser, Level1)
+{
+  ExpectEqualParsing("sc_node#a | sc_edge#e1 | sc_node#b;;");
+  ExpectEqualParsing("sc_node#a | sc_arc_main#_e1 | [content];;");
+  ExpectEqualParsing("sc_node_class#a | sc_edge_dcommon#e1 | \"file://data.txt\";;");
+}
+
+TEST(scs_fast_parser, Connectors)
+{
+  ExpectEqualParsing(
+      "a -> b;; a <- c;; a => nrel_x: d;; a _<= e;; a ~> f;; a <|- g;; a /> h;;"
+      "a _..> _i;; a <?-? j;; a ?%|> k;; a <> l;;");
+}
+
+TEST(scs_fast_parser, Lists)
+{
+  ExpectEqualParsing("a -> b; c; d; -> rrel_1: e; f; => nrel_g:: h;;");
+  ExpectEqualParsing("a -> rrel_1: rrel_2:: b (* <- c;; => nrel_d: e (* -> f;; *);; *); g;;");
+}
+
+TEST(scs_fast_parser, ConnectorsInParentheses)
+{
+  ExpectEqualParsing("(a -> b) => nrel_c: (d <- rrel_e: (f _-> g));;");
+}
+
+TEST(scs_fast_parser, ContentsAndAliases)
+{
+  ExpectEqualParsing(
+      "@a = [content];; @b = (x -> @a);; @b <- c;;"
+      "d = [value \\[escaped\\]];; e = _![class]!;; f = \"file://data.txt\";;"
+      "d -> e; f; _[var]; ![]!; [];;");
+}
+
+TEST(scs_fast_parser, KeynodesAndComments)
+{
+  ExpectEqualParsing(
+      "// comment\n"
+      "sc_node_class -> a; ..b;; /* multiline\ncomment */ sc_node_tuple -> ...;;\r\n"
+      "... -> sc_node;;");
+}
+
+TEST(scs_fast_parser, FallbackToANTLRParser)
+{
+  std::string const data =
+      "a -> b;;"
+      "c -> {d; e};;";
+
+  scs::Parser parser;
+  EXPECT_TRUE(parser.Parse(data));
+
+  auto const & triples = parser.GetParsedTriples();
+  ASSERT_FALSE(triples.empty());
+  {
+    SPLIT_TRIPLE(triples[0]);
+
+    EXPECT_EQ(src.GetIdtf(), "a");
+    EXPECT_EQ(connector.GetType(), ScType::ConstPermPosArc);
+    EXPECT_EQ(trg.GetIdtf(), "b");
+  }
+}
+
+TEST(scs_fast_parser, ParseError)
+{
+  std::string const data =
+      "a -> b;;"
+      "c -> d";
+
+  scs::Parser parser;
+  EXPECT_FALSE(parser.Parse(data));
+  EXPECT_FALSE(parser.GetParseError().empty());
+}
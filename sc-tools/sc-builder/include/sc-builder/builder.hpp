@@ -12,6 +12,7 @@
 
 #include "translator.hpp"
 #include "sc_repo_path_collector.hpp"
+#include "sc_builder_manifest.hpp"
 
 struct BuilderParams
 {
@@ -23,6 +24,8 @@ struct BuilderParams
   std::string m_resultStructureSystemIdtf;
   //! Flag to create result structure
   sc_bool m_resultStructureUpload = SC_FALSE;
+  //! Count of threads parsing sources, 0 means count of hardware threads
+  size_t m_jobsCount = 0;
 };
 
 class Builder
@@ -37,12 +40,21 @@ protected:
   std::unique_ptr<ScMemoryContext> m_ctx;
   ScRepoPathCollector m_collector;
   std::unordered_map<std::string, std::shared_ptr<Translator>> m_translators;
+  ScBuilderManifest m_manifest;
 
   ScAddr ResolveOutputStructure();
 
   bool BuildSources(ScRepoPathCollector::Sources const & buildSources, ScAddr const & outputStructure);
 
-  bool ProcessFile(std::string const & filename, ScAddr const & outputStructure);
+  std::vector<std::string> RetractChangedSources(
+      std::vector<std::string> const & sources,
+      std::unordered_map<std::string, uint64_t> & sourcesHashes);
+
+  void RetractSource(ScBuilderManifest::Source const & source);
+
+  void RetractElements(ScAddrVector const & generatedElements);
+
+  std::shared_ptr<Translator> const & GetTranslator(std::string const & fileName) const;
 
   void DumpStatistics();
 };
@@ -10,6 +10,11 @@
 
 #include <sc-memory/sc_addr.hpp>
 
+namespace scs
+{
+class Parser;
+}
+
 class Translator
 {
 public:
@@ -21,6 +26,8 @@ public:
     bool m_autoFormatInfo;
     //! output structure
     ScAddr m_outputStructure;
+    //! If it isn't nullptr, then elements generated only for this file are appended to it
+    ScAddrVector * m_generatedElements = nullptr;
   };
 
   explicit Translator(class ScMemoryContext & context);
@@ -35,6 +42,20 @@ public:
   //! Implementation of translate
   virtual bool TranslateImpl(Params const & params) = 0;
 
+  /*! Parse specified file without changing memory, so different files can be parsed in parallel
+   * @param params Input parameters
+   * @param parser Parser to parse file by
+   * @throws utils::ScException if file can't be parsed
+   */
+  virtual void Parse(Params const & params, scs::Parser & parser) const = 0;
+
+  /*! Generate elements of parsed file in memory
+   * @param params Input parameters
+   * @param parser Parser that has parsed file
+   * @throws utils::ScException if elements can't be generated
+   */
+  virtual void Generate(Params const & params, scs::Parser const & parser) = 0;
+
   static void Clean(ScMemoryContext & ctx);
 
 protected:
@@ -6,11 +6,18 @@
 
 #include "sc-builder/builder.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <fstream>
+#include <unordered_set>
+#include <vector>
+
+#include <sc-memory/scs/scs_parser.hpp>
 
 #include "scs_translator.hpp"
 #include "gwf_translator.hpp"
+#include "sc_sources_parser.hpp"
 
 Builder::Builder() = default;
 
@@ -18,6 +25,13 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
 {
   m_params = params;
 
+  // manifest is valid only for binaries that it is saved with, so binaries are built incrementally if they aren't
+  // cleared and have manifest
+  if (memoryParams.clear == SC_TRUE)
+    ScBuilderManifest::Remove(m_params.m_outputPath);
+  else if (m_manifest.Load(m_params.m_outputPath))
+    ScConsole::PrintLine() << ScConsole::Color::Blue << "Build knowledge base incrementally by manifest... ";
+
   if (!ScMemory::Initialize(memoryParams))
     SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Error while sc-memory initialize");
 
@@ -39,7 +53,11 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
   bool const status = BuildSources(buildSources, outputStructure);
 
   m_ctx.reset();
+
+  // previous manifest mustn't be used with new binaries if saving is interrupted
+  ScBuilderManifest::Remove(m_params.m_outputPath);
   ScMemory::Shutdown(SC_TRUE);
+  m_manifest.Save(m_params.m_outputPath);
 
   return status;
 }
@@ -49,30 +67,71 @@ bool Builder::BuildSources(ScRepoPathCollector::Sources const & buildSources, Sc
   ScMemoryContextEventsBlockingGuard guard{*m_ctx};
   m_translators = {{"scs", std::make_shared<SCsTranslator>(*m_ctx)}, {"gwf", std::make_shared<GWFTranslator>(*m_ctx)}};
 
-  // process founded files
-  bool status = true;
+  // sources are generated in sorted order, so built knowledge base doesn't depend on count of jobs
+  std::vector<std::string> sortedSources{buildSources.cbegin(), buildSources.cend()};
+  std::sort(sortedSources.begin(), sortedSources.end());
 
-  size_t done = 0;
-  for (auto const & fileName : buildSources)
+  std::unordered_map<std::string, uint64_t> sourcesHashes;
+  std::vector<std::string> const sources = RetractChangedSources(sortedSources, sourcesHashes);
+
+  auto const start = std::chrono::steady_clock::now();
+
+  // process founded files: they are parsed in parallel and generated one by one
+  bool status = true;
   {
-    ScConsole::Print() << ScConsole::Color::LightBlue << "[" << (++done) << "/" << buildSources.size() << "]: ";
-    ScConsole::Print() << ScConsole::Color::Grey << fileName << " - ";
+    ScSourcesParser sourcesParser{
+        sources,
+        m_params.m_jobsCount,
+        [this, &outputStructure](std::string const & fileName, scs::Parser & parser)
+        {
+          Translator::Params translateParams;
+          translateParams.m_fileName = fileName;
+          translateParams.m_outputStructure = outputStructure;
+          GetTranslator(fileName)->Parse(translateParams, parser);
+        }};
+    ScConsole::PrintLine() << ScConsole::Color::Blue << "Parse sources by " << sourcesParser.GetJobsCount()
+                           << " jobs... ";
 
-    try
+    for (size_t i = 0; i < sources.size(); ++i)
     {
-      ProcessFile(fileName, outputStructure);
+      std::string const & fileName = sources[i];
+      ScConsole::Print() << ScConsole::Color::LightBlue << "[" << (i + 1) << "/" << sources.size() << "]: ";
+      ScConsole::Print() << ScConsole::Color::Grey << fileName << " - ";
 
-      ScConsole::PrintLine() << ScConsole::Color::Green << "ok";
-    }
-    catch (utils::ScException const & e)
-    {
-      ScConsole::PrintLine() << ScConsole::Color::Red << "failed";
-      ScConsole::PrintLine() << ScConsole::Color::Red << e.Message();
-      status = false;
-      break;
+      ScAddrVector generatedElements;
+      try
+      {
+        Translator::Params translateParams;
+        translateParams.m_fileName = fileName;
+        translateParams.m_outputStructure = outputStructure;
+        translateParams.m_generatedElements = &generatedElements;
+        GetTranslator(fileName)->Generate(translateParams, *sourcesParser.Take(i));
+
+        ScBuilderManifest::Source & source = m_manifest.GetSources()[fileName];
+        source.m_hash = sourcesHashes[fileName];
+        source.m_elements.reserve(generatedElements.size());
+        for (ScAddr const & addr : generatedElements)
+          source.m_elements.push_back({addr.Hash(), *m_ctx->GetElementType(addr)});
+
+        ScConsole::PrintLine() << ScConsole::Color::Green << "ok";
+      }
+      catch (utils::ScException const & e)
+      {
+        ScConsole::PrintLine() << ScConsole::Color::Red << "failed";
+        ScConsole::PrintLine() << ScConsole::Color::Red << e.Message();
+
+        // failed source isn't recorded in manifest, so its partially generated elements are rolled back to not be
+        // left in binaries untracked
+        RetractElements(generatedElements);
+        status = false;
+        break;
+      }
     }
   }
 
+  std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+  ScConsole::PrintLine() << ScConsole::Color::Blue << "Sources are built in " << elapsed.count() << " s";
+
   ScConsole::PrintLine() << ScConsole::Color::Green << "Clean state...";
   Translator::Clean(*m_ctx);
 
@@ -82,6 +141,94 @@ bool Builder::BuildSources(ScRepoPathCollector::Sources const & buildSources, Sc
   return status;
 }
 
+std::vector<std::string> Builder::RetractChangedSources(
+    std::vector<std::string> const & sources,
+    std::unordered_map<std::string, uint64_t> & sourcesHashes)
+{
+  ScBuilderManifest::Sources & manifestSources = m_manifest.GetSources();
+  std::unordered_set<std::string> const sourcesSet{sources.cbegin(), sources.cend()};
+
+  size_t removedSourcesCount = 0;
+  for (auto it = manifestSources.begin(); it != manifestSources.end();)
+  {
+    if (sourcesSet.find(it->first) != sourcesSet.cend())
+    {
+      ++it;
+      continue;
+    }
+
+    RetractSource(it->second);
+    it = manifestSources.erase(it);
+    ++removedSourcesCount;
+  }
+
+  std::vector<std::string> changedSources;
+  for (std::string const & fileName : sources)
+  {
+    uint64_t hash = 0;
+    try
+    {
+      hash = ScBuilderManifest::CalculateHash(fileName);
+    }
+    catch (utils::ScException const &)
+    {
+      // source is built anyway, so error of its reading is printed by translator
+    }
+    sourcesHashes[fileName] = hash;
+
+    auto const it = manifestSources.find(fileName);
+    if (it != manifestSources.cend())
+    {
+      if (it->second.m_hash == hash)
+        continue;
+
+      RetractSource(it->second);
+      manifestSources.erase(it);
+    }
+
+    changedSources.push_back(fileName);
+  }
+
+  if (removedSourcesCount != 0 || changedSources.size() != sources.size())
+    ScConsole::PrintLine() << ScConsole::Color::Blue << "Unchanged sources: " << sources.size() - changedSources.size()
+                           << ", changed or new sources: " << changedSources.size()
+                           << ", removed sources: " << removedSourcesCount;
+
+  return changedSources;
+}
+
+void Builder::RetractSource(ScBuilderManifest::Source const & source)
+{
+  // elements of source can be already erased with other its elements, and their addresses can be reused only if
+  // binaries are changed not by sc-builder, so elements with other types aren't erased
+  ScAddrVector elements;
+  elements.reserve(source.m_elements.size());
+  for (ScBuilderManifest::Element const & element : source.m_elements)
+  {
+    ScAddr const addr{element.m_addrHash};
+    if (m_ctx->IsElement(addr) && *m_ctx->GetElementType(addr) == element.m_type)
+      elements.push_back(addr);
+  }
+
+  if (!elements.empty())
+    m_ctx->EraseElements(elements);
+}
+
+void Builder::RetractElements(ScAddrVector const & generatedElements)
+{
+  // generated sc-connectors can be already erased with their incident elements
+  ScAddrVector elements;
+  elements.reserve(generatedElements.size());
+  for (ScAddr const & addr : generatedElements)
+  {
+    if (m_ctx->IsElement(addr))
+      elements.push_back(addr);
+  }
+
+  if (!elements.empty())
+    m_ctx->EraseElements(elements);
+}
+
 ScAddr Builder::ResolveOutputStructure()
 {
   ScSystemIdentifierQuintuple fiver;
@@ -104,19 +251,15 @@ ScAddr Builder::ResolveOutputStructure()
   return outputStructure;
 }
 
-bool Builder::ProcessFile(std::string const & fileName, ScAddr const & outputStructure)
+std::shared_ptr<Translator> const & Builder::GetTranslator(std::string const & fileName) const
 {
-  Translator::Params translateParams;
-  translateParams.m_fileName = fileName;
-  translateParams.m_outputStructure = outputStructure;
-
   std::string const & fileExt = m_collector.GetFileExtension(fileName);
   auto const & it = m_translators.find(fileExt);
   if (it == m_translators.cend())
     SC_THROW_EXCEPTION(
         utils::ExceptionInvalidState, "Not found translators for sources with extension `" << fileExt << "`.");
 
-  return it->second->Translate(translateParams);
+  return it->second;
 }
 
 void Builder::DumpStatistics()
@@ -6,7 +6,7 @@
 
 #include "gwf_parser.hpp"
 
-#include <iostream>
+#include <fstream>
 
 #include <sc-memory/utils/sc_base64.hpp>
 #include <sc-memory/sc_debug.hpp>
@@ -15,192 +15,303 @@
 
 using namespace Constants;
 
-void XmlCharDeleter::operator()(xmlChar * ptr) const
+namespace
+{
+size_t constexpr kChunkSize = 64 * 1024;
+// attributes of SAX2 element are given by tuples (localname, prefix, URI, value, end)
+int constexpr kAttributeFieldsCount = 5;
+}  // namespace
+
+GWFParser::GWFParser(SCgElements & elementsWithoutParents)
+  : m_elementsWithoutParents(elementsWithoutParents)
 {
-  if (ptr != nullptr)
-    xmlFree(ptr);
 }
 
-void GWFParser::Parse(std::string const & xmlStr, SCgElements & elements)
+void GWFParser::Parse(std::string const & fileName, SCgElements & elements)
 {
-  xmlInitParser();
+  GWFParser parser(elements);
+  parser.ParseFile(fileName);
 
-  auto xmlTree = std::unique_ptr<xmlDoc, decltype(&xmlFreeDoc)>(
-      xmlReadMemory(xmlStr.c_str(), xmlStr.size(), "noname.xml", nullptr, 0), xmlFreeDoc);
-  if (xmlTree == nullptr)
-    SC_THROW_EXCEPTION(utils::ExceptionParseError, "Failed to open XML xmlTree.");
+  if (!parser.m_isStaticSectorFound)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "GWFParser::Parse: StaticSector not found in GWF-file `" << fileName << "`.");
 
-  xmlNodePtr rootElement = xmlDocGetRootElement(xmlTree.get());
-  xmlNodePtr staticSector = nullptr;
+  // To correctly process contours and connectors all elements are first collected, then the contours and connectors are
+  // assigned elements
+  FillConnectors(parser.m_connectors, parser.m_allElements);
+  FillContours(parser.m_contours, parser.m_allElements);
+}
 
-  for (xmlNodePtr node = rootElement->children; node != nullptr; node = node->next)
-  {
-    if (xmlStrEqual(node->name, STATIC_SECTOR))
-    {
-      staticSector = node;
-      break;
-    }
-  }
+void GWFParser::ParseFile(std::string const & fileName)
+{
+  std::ifstream file(fileName, std::ios::binary);
+  if (!file.is_open())
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, "GWFParser::Parse: Failed to open GWF-file `" << fileName << "`.");
+
+  xmlSAXHandler handler{};
+  handler.initialized = XML_SAX2_MAGIC;
+  handler.startElementNs = OnStartElement;
+  handler.endElementNs = OnEndElement;
+  handler.characters = OnCharacters;
+  handler.cdataBlock = OnCharacters;
+  // Entities aren't registered by parser, so external files can't be read into knowledge base through them
+  handler.externalSubset = OnExternalSubset;
+  handler.entityDecl = OnEntityDecl;
+
+  m_context = xmlCreatePushParserCtxt(&handler, this, nullptr, 0, fileName.c_str());
+  if (m_context == nullptr)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "GWFParser::Parse: Failed to create XML parser for `" << fileName << "`.");
+  std::unique_ptr<xmlParserCtxt, decltype(&xmlFreeParserCtxt)> const context(m_context, xmlFreeParserCtxt);
 
-  if (staticSector == nullptr)
-    SC_THROW_EXCEPTION(utils::ExceptionParseError, "StaticSector not found in XML xmlTree.");
+  // Predefined entities and character references are decoded by SAX2 parser itself, so entities aren't substituted
+  xmlCtxtUseOptions(m_context, XML_PARSE_NONET);
 
-  if (staticSector->children == nullptr)
-    return;
+  char buffer[kChunkSize];
+  int result = XML_ERR_OK;
+  while (result == XML_ERR_OK && m_exception == nullptr && (file.read(buffer, sizeof(buffer)) || file.gcount() > 0))
+    result = xmlParseChunk(m_context, buffer, static_cast<int>(file.gcount()), 0);
+  if (result == XML_ERR_OK && m_exception == nullptr)
+    result = xmlParseChunk(m_context, nullptr, 0, 1);
 
-  ProcessStaticSector(staticSector, elements);
-  xmlCleanupParser();
+  if (m_exception != nullptr)
+    std::rethrow_exception(m_exception);
+
+  if (result != XML_ERR_OK)
+  {
+    auto const * error = xmlCtxtGetLastError(m_context);
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError,
+        "GWFParser::Parse: Failed to parse XML file `" << fileName << "`: "
+                                                      << (error && error->message ? error->message : "unknown error"));
+  }
 }
 
-void GWFParser::ProcessStaticSector(xmlNodePtr staticSector, SCgElements & elementsWithoutParents)
+void GWFParser::OnStartElement(
+    void * data,
+    xmlChar const * localName,
+    xmlChar const *,
+    xmlChar const *,
+    int,
+    xmlChar const **,
+    int attributesCount,
+    int,
+    xmlChar const ** attributes)
 {
-  SCgElements allElements;
-  SCgConnectors connectors;  // connectors = {connector: (sourceId, targetId)}
-  SCgContours contours;
-
-  for (xmlNodePtr child = staticSector->children; child != nullptr; child = child->next)
-  {
-    if (child->type == XML_ELEMENT_NODE)
-    {
-      auto const id = GetXmlPropStr(child, ID);
-      auto const parent = GetXmlPropStr(child, PARENT);
-      auto const identifier = GetXmlPropStr(child, IDENTIFIER);
-      auto const type = GetXmlPropStr(child, TYPE);
-      auto const tag = XmlCharToString(std::unique_ptr<xmlChar, XmlCharDeleter>(xmlStrdup(child->name)));
-
-      SCgElementPtr scgElement;
-      if (tag == NODE)
+  auto * parser = static_cast<GWFParser *>(data);
+  parser->HandleCallback(
+      [&]
       {
-        if (HasContent(child))
-          scgElement = CreateLink(id, parent, identifier, type, tag, child);
-        else
-          scgElement = CreateNode(id, parent, identifier, type, tag);
-      }
-      else if (tag == BUS)
-        scgElement = CreateBus(id, parent, identifier, type, tag, child);
-      else if (tag == CONTOUR)
-        scgElement = CreateContour(id, parent, identifier, type, tag);
-      else if (tag == PAIR || tag == ARC)
-        scgElement = CreateConnector(id, parent, identifier, type, tag, child, connectors);
-      else
-        SC_THROW_EXCEPTION(
-            utils::ExceptionParseError, "GWFParser::ProcessStaticSector: Unknown tag  " << tag << " with id " << id);
+        ++parser->m_depth;
+        if (parser->m_depth == 2 && !parser->m_isStaticSectorFound && xmlStrEqual(localName, STATIC_SECTOR))
+          parser->m_isStaticSectorFound = parser->m_isInStaticSector = true;
+        else if (!parser->m_isInStaticSector)
+          return;
+        else if (parser->m_depth == 3)
+          parser->StartElement(reinterpret_cast<char const *>(localName), attributes, attributesCount);
+        else if (parser->m_depth == 4 && parser->m_element.m_tag == NODE && xmlStrEqual(localName, CONTENT))
+          parser->StartContent(attributes, attributesCount);
+      });
+}
 
-      if (parent == NO_PARENT)
-        elementsWithoutParents[id] = scgElement;
-      else
+void GWFParser::OnEndElement(void * data, xmlChar const *, xmlChar const *, xmlChar const *)
+{
+  auto * parser = static_cast<GWFParser *>(data);
+  parser->HandleCallback(
+      [&]
       {
-        if (!contours.count(parent))
-          contours.insert({parent, {}});
-
-        contours[parent].insert({id, scgElement});
-      }
-
-      allElements[id] = scgElement;
-    }
-  }
-
-  // To correctly process contours and connectors all elements are first collected, then the contours and connectors are
-  // assigned elements
-  FillConnectors(connectors, allElements);
-  FillContours(contours, allElements);
+        if (parser->m_isInStaticSector)
+        {
+          if (parser->m_depth == 4)
+            parser->m_element.m_isInContent = false;
+          else if (parser->m_depth == 3)
+            parser->EndElement();
+          else if (parser->m_depth == 2)
+            parser->m_isInStaticSector = false;
+        }
+        --parser->m_depth;
+      });
 }
 
-std::shared_ptr<SCgNode> GWFParser::CreateNode(
-    std::string const & id,
-    std::string const & parent,
-    std::string const & identifier,
-    std::string const & type,
-    std::string const & tag)
+void GWFParser::OnCharacters(void * data, xmlChar const * characters, int length)
 {
-  return std::make_shared<SCgNode>(id, parent, identifier, type, tag);
+  auto * parser = static_cast<GWFParser *>(data);
+  if (parser->m_isInStaticSector && parser->m_element.m_isInContent)
+    parser->m_element.m_contentData.append(reinterpret_cast<char const *>(characters), length);
 }
 
-std::shared_ptr<SCgLink> GWFParser::CreateLink(
-    std::string const & id,
-    std::string const & parent,
-    std::string const & identifier,
-    std::string const & type,
-    std::string const & tag,
-    xmlNodePtr el)
+void GWFParser::OnExternalSubset(
+    void * data,
+    xmlChar const * name,
+    xmlChar const * externalId,
+    xmlChar const * systemId)
 {
-  for (xmlNodePtr contentChild = el->children; contentChild; contentChild = contentChild->next)
-  {
-    if (contentChild->type == XML_ELEMENT_NODE && xmlStrcmp(contentChild->name, CONTENT) == 0)
-    {
-      auto const contentType = GetXmlPropStr(contentChild, TYPE);
-      auto const mimeType = GetXmlPropStr(contentChild, MIME_TYPE);
-      auto const fileName = GetXmlPropStr(contentChild, FILE_NAME);
-      auto contentData = XmlCharToString(std::unique_ptr<xmlChar, XmlCharDeleter>(xmlNodeGetContent(contentChild)));
+  if (externalId == nullptr && systemId == nullptr)
+    return;
 
-      if (!contentType.empty() && std::stoi(contentType) < 4)
+  auto * parser = static_cast<GWFParser *>(data);
+  parser->HandleCallback(
+      [&]
       {
-        // Content is num or string that don't need conversion
-      }
-      else if (contentType == "4")
+        SC_THROW_EXCEPTION(
+            utils::ExceptionParseError,
+            "GWFParser::Parse: Document type `" << reinterpret_cast<char const *>(name)
+                                                << "` with external subset isn't supported.");
+      });
+}
+
+void GWFParser::OnEntityDecl(
+    void * data,
+    xmlChar const * name,
+    int,
+    xmlChar const * publicId,
+    xmlChar const * systemId,
+    xmlChar *)
+{
+  if (publicId == nullptr && systemId == nullptr)
+    return;
+
+  auto * parser = static_cast<GWFParser *>(data);
+  parser->HandleCallback(
+      [&]
       {
-        // Content in binary format (image)
-        contentData = ScBase64::Decode(contentData);
-      }
-      else
         SC_THROW_EXCEPTION(
-            utils::ExceptionParseError, "GWFParser::CreateLink: Content type is not supported: " << contentType);
+            utils::ExceptionParseError,
+            "GWFParser::Parse: External entity `" << reinterpret_cast<char const *>(name) << "` isn't supported.");
+      });
+}
 
-      return std::make_shared<SCgLink>(id, parent, identifier, type, tag, contentType, mimeType, fileName, contentData);
-    }
-  }
+template <typename Callback>
+void GWFParser::HandleCallback(Callback const & callback)
+{
+  if (m_exception != nullptr)
+    return;
 
-  return nullptr;
+  // Exceptions mustn't be thrown through libxml2, so parser is stopped and exception is rethrown after parsing
+  try
+  {
+    callback();
+  }
+  catch (...)
+  {
+    m_exception = std::current_exception();
+    xmlStopParser(m_context);
+  }
 }
 
-bool GWFParser::HasContent(xmlNodePtr node)
+void GWFParser::StartElement(std::string const & tag, xmlChar const ** attributes, int attributesCount)
 {
-  for (xmlNodePtr child = node->children; child; child = child->next)
+  m_element = ParsedElement();
+  m_element.m_tag = tag;
+  m_element.m_id = GetXmlPropStr(attributes, attributesCount, ID);
+  m_element.m_parent = GetXmlPropStr(attributes, attributesCount, PARENT);
+  m_element.m_identifier = GetXmlPropStr(attributes, attributesCount, IDENTIFIER);
+  m_element.m_type = GetXmlPropStr(attributes, attributesCount, TYPE);
+
+  if (tag == BUS)
+    m_element.m_nodeId = GetXmlPropStr(attributes, attributesCount, OWNER);
+  else if (tag == PAIR || tag == ARC)
   {
-    if (child->type == XML_ELEMENT_NODE && xmlStrcmp(child->name, CONTENT) == 0
-        && GetXmlPropStr(child, TYPE) != NO_CONTENT)
-      return true;
+    m_element.m_sourceId = GetXmlPropStr(attributes, attributesCount, ID_B);
+    m_element.m_targetId = GetXmlPropStr(attributes, attributesCount, ID_E);
   }
-  return false;
+  else if (tag != NODE && tag != CONTOUR)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "GWFParser::StartElement: Unknown tag  " << tag << " with id " << m_element.m_id);
 }
 
-std::shared_ptr<SCgBus> GWFParser::CreateBus(
-    std::string const & id,
-    std::string const & parent,
-    std::string const & identifier,
-    std::string const & type,
-    std::string const & tag,
-    xmlNodePtr el)
+void GWFParser::StartContent(xmlChar const ** attributes, int attributesCount)
 {
-  auto const nodeId = GetXmlPropStr(el, OWNER);
-  return std::make_shared<SCgBus>(id, parent, identifier, type, tag, nodeId);
+  // Node is link if it has any content with content type, but link content is taken from the first content only
+  if (m_element.m_hasContent)
+    return;
+
+  std::string const contentType = GetXmlPropStr(attributes, attributesCount, TYPE);
+  m_element.m_hasContent = contentType != NO_CONTENT;
+
+  if (m_element.m_isContentFound)
+    return;
+
+  m_element.m_isContentFound = true;
+  m_element.m_isInContent = true;
+  m_element.m_contentType = contentType;
+  m_element.m_mimeType = GetXmlProp(attributes, attributesCount, MIME_TYPE);
+  m_element.m_fileName = GetXmlProp(attributes, attributesCount, FILE_NAME);
 }
 
-std::shared_ptr<SCgContour> GWFParser::CreateContour(
-    std::string const & id,
-    std::string const & parent,
-    std::string const & identifier,
-    std::string const & type,
-    std::string const & tag)
+void GWFParser::EndElement()
 {
-  return std::make_shared<SCgContour>(id, parent, identifier, type, tag);
+  ParsedElement & element = m_element;
+
+  SCgElementPtr scgElement;
+  if (element.m_tag == NODE)
+  {
+    if (element.m_hasContent)
+      scgElement = CreateLink();
+    else
+      scgElement = std::make_shared<SCgNode>(
+          element.m_id, element.m_parent, element.m_identifier, element.m_type, element.m_tag);
+  }
+  else if (element.m_tag == BUS)
+    scgElement = std::make_shared<SCgBus>(
+        element.m_id, element.m_parent, element.m_identifier, element.m_type, element.m_tag, element.m_nodeId);
+  else if (element.m_tag == CONTOUR)
+    scgElement = std::make_shared<SCgContour>(
+        element.m_id, element.m_parent, element.m_identifier, element.m_type, element.m_tag);
+  else
+  {
+    auto connector = std::make_shared<SCgConnector>(
+        element.m_id, element.m_parent, element.m_identifier, element.m_type, element.m_tag, nullptr, nullptr);
+    m_connectors.insert({connector, {element.m_sourceId, element.m_targetId}});
+    scgElement = connector;
+  }
+
+  if (element.m_parent == NO_PARENT)
+    m_elementsWithoutParents[element.m_id] = scgElement;
+  else
+    m_contours[element.m_parent].insert({element.m_id, scgElement});
+
+  m_allElements[element.m_id] = scgElement;
 }
 
-std::shared_ptr<SCgConnector> GWFParser::CreateConnector(
-    std::string const & id,
-    std::string const & parent,
-    std::string const & identifier,
-    std::string const & type,
-    std::string const & tag,
-    xmlNodePtr el,
-    SCgConnectors & connectors)
+std::shared_ptr<SCgLink> GWFParser::CreateLink() const
 {
-  std::string const & sourceId = GetXmlPropStr(el, ID_B);
-  std::string const & targetId = GetXmlPropStr(el, ID_E);
+  ParsedElement const & element = m_element;
+
+  if (!element.m_mimeType)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError,
+        "GWFParser::CreateLink: Gwf-element doesn't have property name `" << MIME_TYPE << "`.");
+  if (!element.m_fileName)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError,
+        "GWFParser::CreateLink: Gwf-element doesn't have property name `" << FILE_NAME << "`.");
 
-  auto connector = std::make_shared<SCgConnector>(id, parent, identifier, type, tag, nullptr, nullptr);
-  connectors.insert({connector, {sourceId, targetId}});
-  return connector;
+  std::string const & contentType = element.m_contentType;
+  std::string contentData = element.m_contentData;
+  if (!contentType.empty() && std::stoi(contentType) < 4)
+  {
+    // Content is num or string that don't need conversion
+  }
+  else if (contentType == "4")
+  {
+    // Content in binary format (image)
+    contentData = ScBase64::Decode(contentData);
+  }
+  else
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "GWFParser::CreateLink: Content type is not supported: " << contentType);
+
+  return std::make_shared<SCgLink>(
+      element.m_id,
+      element.m_parent,
+      element.m_identifier,
+      element.m_type,
+      element.m_tag,
+      contentType,
+      *element.m_mimeType,
+      *element.m_fileName,
+      contentData);
 }
 
 void GWFParser::FillConnectors(SCgConnectors const & connectors, SCgElements const & elements)
@@ -255,30 +366,28 @@ void GWFParser::FillContours(SCgContours const & contours, SCgElements const & a
   }
 }
 
-std::string GWFParser::XmlCharToString(std::unique_ptr<xmlChar, XmlCharDeleter> const & ptr)
+std::optional<std::string> GWFParser::GetXmlProp(
+    xmlChar const ** attributes,
+    int attributesCount,
+    std::string const & propName)
 {
-  std::size_t length = xmlStrlen(ptr.get());
-
-  std::string result(length, '\0');
-  std::copy(ptr.get(), ptr.get() + length, result.begin());
-
-  return result;
-}
+  for (int i = 0; i < attributesCount; ++i)
+  {
+    xmlChar const ** attribute = attributes + i * kAttributeFieldsCount;
+    if (xmlStrEqual(attribute[0], BAD_CAST propName.c_str()))
+      return std::string(reinterpret_cast<char const *>(attribute[3]), attribute[4] - attribute[3]);
+  }
 
-std::unique_ptr<xmlChar, XmlCharDeleter> GWFParser::GetXmlProp(xmlNodePtr node, std::string const & propName)
-{
-  xmlChar * propValue = xmlGetProp(node, BAD_CAST propName.c_str());
-  return std::unique_ptr<xmlChar, XmlCharDeleter>(propValue);
+  return std::nullopt;
 }
 
-std::string GWFParser::GetXmlPropStr(xmlNodePtr node, std::string const & propName)
+std::string GWFParser::GetXmlPropStr(xmlChar const ** attributes, int attributesCount, std::string const & propName)
 {
-  std::unique_ptr<xmlChar, XmlCharDeleter> const prop = GetXmlProp(node, propName);
-  if (prop == nullptr)
+  std::optional<std::string> prop = GetXmlProp(attributes, attributesCount, propName);
+  if (!prop)
     SC_THROW_EXCEPTION(
         utils::ExceptionParseError,
         "GWFParser::GetXmlPropStr: Gwf-element doesn't have property name `" << propName << "`.");
 
-  std::string const propStr = XmlCharToString(prop);
-  return propStr;
+  return *prop;
 }
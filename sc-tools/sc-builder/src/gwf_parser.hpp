@@ -6,78 +6,108 @@
 
 #pragma once
 
-#include <string>
-#include <vector>
-#include <cstring>
+#include <exception>
 #include <memory>
-#include <list>
+#include <optional>
+#include <string>
 
 #include <libxml2/libxml/parser.h>
-#include <libxml2/libxml/tree.h>
 
 #include "gwf_translator_constants.hpp"
 #include "sc_scg_element.hpp"
 
-class XmlCharDeleter
-{
-public:
-  void operator()(xmlChar * ptr) const;
-};
-
+/*!
+ * Parses GWF-file by SAX in one streaming pass: file is read by chunks and scg-elements are collected from parser
+ * callbacks, so XML tree of GWF-file isn't built in memory.
+ */
 class GWFParser
 {
 public:
-  static void Parse(std::string const & xmlStr, SCgElements & elements);
+  /*!
+   * Parses GWF-file and collects its scg-elements.
+   * @param fileName Path to GWF-file.
+   * @param elements Scg-elements without parents.
+   * @throws utils::ExceptionParseError if file can't be read, it isn't valid XML or it isn't valid GWF.
+   */
+  static void Parse(std::string const & fileName, SCgElements & elements);
 
 private:
-  static std::shared_ptr<SCgNode> CreateNode(
-      std::string const & id,
-      std::string const & parent,
-      std::string const & identifier,
-      std::string const & type,
-      std::string const & tag);
-
-  static std::shared_ptr<SCgLink> CreateLink(
-      std::string const & id,
-      std::string const & parent,
-      std::string const & identifier,
-      std::string const & type,
-      std::string const & tag,
-      xmlNodePtr el);
-
-  static bool HasContent(xmlNodePtr node);
-
-  static std::shared_ptr<SCgBus> CreateBus(
-      std::string const & id,
-      std::string const & parent,
-      std::string const & identifier,
-      std::string const & type,
-      std::string const & tag,
-      xmlNodePtr el);
-
-  static std::shared_ptr<SCgContour> CreateContour(
-      std::string const & id,
-      std::string const & parent,
-      std::string const & identifier,
-      std::string const & type,
-      std::string const & tag);
-
-  static std::shared_ptr<SCgConnector> CreateConnector(
-      std::string const & id,
-      std::string const & parent,
-      std::string const & identifier,
-      std::string const & type,
-      std::string const & tag,
-      xmlNodePtr el,
-      SCgConnectors & connectors);
+  //! Attributes and content of gwf-element that is being parsed
+  struct ParsedElement
+  {
+    std::string m_tag;
+    std::string m_id;
+    std::string m_parent;
+    std::string m_identifier;
+    std::string m_type;
+
+    std::string m_nodeId;
+    std::string m_sourceId;
+    std::string m_targetId;
+
+    bool m_hasContent = false;
+    bool m_isContentFound = false;
+    bool m_isInContent = false;
+    std::string m_contentType;
+    std::optional<std::string> m_mimeType;
+    std::optional<std::string> m_fileName;
+    std::string m_contentData;
+  };
+
+  explicit GWFParser(SCgElements & elementsWithoutParents);
+
+  SCgElements & m_elementsWithoutParents;
+  SCgElements m_allElements;
+  SCgConnectors m_connectors;  // connectors = {connector: (sourceId, targetId)}
+  SCgContours m_contours;
+
+  xmlParserCtxtPtr m_context = nullptr;
+  std::exception_ptr m_exception;
+
+  size_t m_depth = 0;
+  bool m_isStaticSectorFound = false;
+  bool m_isInStaticSector = false;
+  ParsedElement m_element;
+
+  void ParseFile(std::string const & fileName);
+
+  void StartElement(std::string const & tag, xmlChar const ** attributes, int attributesCount);
+  void StartContent(xmlChar const ** attributes, int attributesCount);
+  void EndElement();
+
+  std::shared_ptr<SCgLink> CreateLink() const;
 
   static void FillConnectors(SCgConnectors const & connectors, SCgElements const & elements);
 
   static void FillContours(SCgContours const & contours, SCgElements const & elements);
 
-  static void ProcessStaticSector(xmlNodePtr staticSector, SCgElements & elementsWithParents);
-
-  static std::string XmlCharToString(std::unique_ptr<xmlChar, XmlCharDeleter> const & ptr);
-  static std::unique_ptr<xmlChar, XmlCharDeleter> GetXmlProp(xmlNodePtr node, std::string const & propName);
-  static std::string GetXmlPropStr(xmlNodePtr node, std::string const & propName);
+  static void OnStartElement(
+      void * data,
+      xmlChar const * localName,
+      xmlChar const * prefix,
+      xmlChar const * uri,
+      int namespacesCount,
+      xmlChar const ** namespaces,
+      int attributesCount,
+      int defaultedAttributesCount,
+      xmlChar const ** attributes);
+  static void OnEndElement(void * data, xmlChar const * localName, xmlChar const * prefix, xmlChar const * uri);
+  static void OnCharacters(void * data, xmlChar const * characters, int length);
+  static void OnExternalSubset(void * data, xmlChar const * name, xmlChar const * externalId, xmlChar const * systemId);
+  static void OnEntityDecl(
+      void * data,
+      xmlChar const * name,
+      int type,
+      xmlChar const * publicId,
+      xmlChar const * systemId,
+      xmlChar * content);
+
+  template <typename Callback>
+  void HandleCallback(Callback const & callback);
+
+  static std::optional<std::string> GetXmlProp(
+      xmlChar const ** attributes,
+      int attributesCount,
+      std::string const & propName);
+  static std::string GetXmlPropStr(xmlChar const ** attributes, int attributesCount, std::string const & propName);
 };
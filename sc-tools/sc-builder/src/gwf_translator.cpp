@@ -6,9 +6,8 @@
 
 #include "gwf_translator.hpp"
 
-#include <filesystem>
-
 #include <sc-memory/utils/sc_exec.hpp>
+#include <sc-memory/scs/scs_parser.hpp>
 
 #include "gwf_parser.hpp"
 #include "sc_scs_writer.hpp"
@@ -20,98 +19,48 @@ GWFTranslator::GWFTranslator(ScMemoryContext & context)
   : Translator(context)
   , m_scsTranslator(context)
 {
+  xmlInitParser();
 }
 
-bool GWFTranslator::TranslateImpl(Params const & params)
+GWFTranslator::~GWFTranslator()
 {
-  std::string const & scsText = TranslateXMLFileContentToSCs(params.m_fileName);
-  std::string const & scsSource = WriteStringToFile(scsText, params.m_fileName);
-
-  Params newParams;
-  newParams.m_fileName = scsSource;
-  newParams.m_autoFormatInfo = params.m_autoFormatInfo;
-  newParams.m_outputStructure = params.m_outputStructure;
-  bool status = m_scsTranslator.Translate(newParams);
-
-  std::filesystem::remove(scsSource.c_str());
-
-  return status;
+  // libxml2 can't be cleaned up while GWF-files are parsed by other threads
+  xmlCleanupParser();
 }
 
-std::string GWFTranslator::TranslateXMLFileContentToSCs(std::string const & filename)
+bool GWFTranslator::TranslateImpl(Params const & params)
 {
-  std::string const & gwfText = GetXMLFileContent(filename);
-  return TranslateGWFToSCs(gwfText, filename);
+  scs::Parser parser;
+  Parse(params, parser);
+  Generate(params, parser);
+  return true;
 }
 
-std::string GWFTranslator::GetXMLFileContent(std::string const & fileName)
+void GWFTranslator::Parse(Params const & params, scs::Parser & parser) const
 {
-  xmlInitParser();
-
-  xmlDocPtr const & document = xmlReadFile(fileName.c_str(), nullptr, 0);
-  if (document == nullptr)
-    SC_THROW_EXCEPTION(
-        utils::ExceptionParseError, "GWFTranslator::GetXMLFileContent: Failed to parse XML file `" << fileName << "`.");
-
-  xmlChar * xmlBuffer;
-  int bufferSize;
-  xmlDocDumpFormatMemory(document, &xmlBuffer, &bufferSize, 0);
-
-  std::string xmlString((char *)xmlBuffer, bufferSize);
-
-  xmlFree(xmlBuffer);
-  xmlFreeDoc(document);
-  xmlCleanupParser();
+  std::string const & scsText = TranslateXMLFileContentToSCs(params.m_fileName);
+  if (!parser.Parse(scsText))
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, parser.GetParseError());
+}
 
-  return xmlString;
+void GWFTranslator::Generate(Params const & params, scs::Parser const & parser)
+{
+  m_scsTranslator.Generate(params, parser);
 }
 
-std::string GWFTranslator::TranslateGWFToSCs(std::string const & xmlStr, std::string const & filePath)
+std::string GWFTranslator::TranslateXMLFileContentToSCs(std::string const & fileName)
 {
   SCgElements elementsWithoutParents;
-
-  GWFParser::Parse(xmlStr, elementsWithoutParents);
+  GWFParser::Parse(fileName, elementsWithoutParents);
 
   if (elementsWithoutParents.empty())
     SC_THROW_EXCEPTION(
         utils::ExceptionParseError,
-        "GWFTranslator::TranslateGWFToSCs: There are no elements in file `" << filePath << "`.");
+        "GWFTranslator::TranslateXMLFileContentToSCs: There are no elements in file `" << fileName << "`.");
 
   Buffer scsBuffer;
   std::unordered_set<SCgElementPtr> writtenElements;
-  SCsWriter::Write(elementsWithoutParents, filePath, scsBuffer, 0, writtenElements);
+  SCsWriter::Write(elementsWithoutParents, fileName, scsBuffer, 0, writtenElements);
 
   return scsBuffer.GetValue();
 }
-
-std::string GWFTranslator::WriteStringToFile(std::string const & scsText, std::string const & fileName)
-{
-  std::string const & filePath = fileName + GENERATED_EXTENTION + SCS_EXTENTION;
-  std::ofstream outputFile(filePath, std::ios::binary);
-
-  if (!outputFile.is_open())
-    SC_THROW_EXCEPTION(
-        utils::ExceptionCritical,
-        "GWFTranslator::WriteStringToFile: Error creating file for writing `" << filePath << "`.");
-
-  outputFile << scsText;
-
-  if (outputFile.fail())
-  {
-    outputFile.close();
-    std::remove(filePath.c_str());
-    SC_THROW_EXCEPTION(
-        utils::ExceptionCritical, "GWFTranslator::WriteStringToFile: Error writing to file `" << filePath << "`.");
-  }
-
-  outputFile.close();
-
-  if (outputFile.fail())
-  {
-    std::remove(filePath.c_str());
-    SC_THROW_EXCEPTION(
-        utils::ExceptionCritical, "GWFTranslator::WriteStringToFile: Error closing the file `" << filePath << "`.");
-  }
-
-  return filePath;
-}
@@ -18,16 +18,18 @@ class GWFTranslator : public Translator
 {
 public:
   explicit GWFTranslator(class ScMemoryContext & context);
-  ~GWFTranslator() override = default;
+  ~GWFTranslator() override;
 
   bool TranslateImpl(Params const & params) override;
 
+  //! Translates GWF-file to SCs-text in memory and parses it
+  void Parse(Params const & params, scs::Parser & parser) const override;
+
+  void Generate(Params const & params, scs::Parser const & parser) override;
+
+  //! Translates GWF-file to SCs-text without XML tree and temporary files
   static std::string TranslateXMLFileContentToSCs(std::string const & filename);
 
 protected:
   SCsTranslator m_scsTranslator;
-
-  static std::string WriteStringToFile(std::string const & scsStr, std::string const & filePath);
-  static std::string TranslateGWFToSCs(std::string const & xmlStr, std::string const & filePath);
-  static std::string GetXMLFileContent(std::string const & filename);
 };
@@ -0,0 +1,130 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_builder_manifest.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+#include <sc-memory/sc_debug.hpp>
+
+uint64_t ScBuilderManifest::CalculateHash(std::string const & fileName)
+{
+  std::ifstream ifs(fileName, std::ios::binary);
+  if (!ifs.is_open())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't open file " << fileName);
+
+  uint64_t hash = 14695981039346656037ull;
+  char buffer[64 * 1024];
+  while (ifs.read(buffer, sizeof(buffer)) || ifs.gcount() > 0)
+  {
+    std::streamsize const size = ifs.gcount();
+    for (std::streamsize i = 0; i < size; ++i)
+    {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 1099511628211ull;
+    }
+  }
+
+  return hash;
+}
+
+bool ScBuilderManifest::Load(std::string const & binariesPath)
+{
+  m_sources.clear();
+
+  std::string const & path = GetPath(binariesPath);
+  std::error_code code;
+  uintmax_t const fileSize = std::filesystem::file_size(path, code);
+  if (code)
+    return false;
+
+  std::ifstream ifs(path);
+  if (!ifs.is_open())
+    return false;
+
+  std::string header;
+  if (!std::getline(ifs, header) || header != kHeader)
+    return false;
+
+  // every source is written as its path, then its hash and count of its elements, then its elements
+  std::string fileName;
+  while (std::getline(ifs, fileName))
+  {
+    Source source;
+    size_t elementsCount = 0;
+    if (!(ifs >> source.m_hash >> elementsCount))
+    {
+      m_sources.clear();
+      return false;
+    }
+
+    // count of elements is checked before allocation, so broken manifest is ignored like missing one
+    std::streamoff const position = ifs.tellg();
+    if (position < 0 || elementsCount > (fileSize - static_cast<uintmax_t>(position)) / kMinElementSize)
+    {
+      m_sources.clear();
+      return false;
+    }
+
+    source.m_elements.resize(elementsCount);
+    for (Element & element : source.m_elements)
+    {
+      if (!(ifs >> element.m_addrHash >> element.m_type))
+      {
+        m_sources.clear();
+        return false;
+      }
+    }
+    ifs.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    m_sources.insert({fileName, std::move(source)});
+  }
+
+  return true;
+}
+
+void ScBuilderManifest::Save(std::string const & binariesPath) const
+{
+  std::string const & path = GetPath(binariesPath);
+  std::string const & tmpPath = path + ".tmp";
+
+  {
+    std::ofstream ofs(tmpPath, std::ios::trunc);
+    if (!ofs.is_open())
+      SC_THROW_EXCEPTION(utils::ExceptionCritical, "Can't write sc-builder manifest to `" << tmpPath << "`.");
+
+    ofs << kHeader << "\n";
+    for (auto const & [fileName, source] : m_sources)
+    {
+      ofs << fileName << "\n" << source.m_hash << " " << source.m_elements.size() << "\n";
+      for (Element const & element : source.m_elements)
+        ofs << element.m_addrHash << " " << element.m_type << "\n";
+    }
+
+    if (ofs.fail())
+      SC_THROW_EXCEPTION(utils::ExceptionCritical, "Can't write sc-builder manifest to `" << tmpPath << "`.");
+  }
+
+  std::filesystem::rename(tmpPath, path);
+}
+
+void ScBuilderManifest::Remove(std::string const & binariesPath)
+{
+  std::error_code code;
+  std::filesystem::remove(GetPath(binariesPath), code);
+}
+
+ScBuilderManifest::Sources & ScBuilderManifest::GetSources()
+{
+  return m_sources;
+}
+
+std::string ScBuilderManifest::GetPath(std::string const & binariesPath)
+{
+  return (std::filesystem::path(binariesPath) / kFileName).string();
+}
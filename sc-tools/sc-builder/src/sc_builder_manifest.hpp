@@ -0,0 +1,66 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sc-memory/sc_addr.hpp>
+#include <sc-memory/sc_type.hpp>
+
+/*!
+ * Manifest of built knowledge base. It keeps content hash of every built source and elements generated only for
+ * this source, so sc-builder can retract and regenerate elements of changed sources only. It is stored in directory
+ * of knowledge base binaries.
+ */
+class ScBuilderManifest
+{
+public:
+  static inline std::string const kFileName = "sc-builder.manifest";
+
+  struct Element
+  {
+    ScAddr::HashType m_addrHash;
+    ScType::RealType m_type;
+  };
+
+  struct Source
+  {
+    uint64_t m_hash = 0;
+    std::vector<Element> m_elements;
+  };
+
+  using Sources = std::map<std::string, Source>;
+
+  //! Calculates FNV-1a hash of file content
+  static uint64_t CalculateHash(std::string const & fileName);
+
+  /*! Reads manifest from directory of knowledge base binaries.
+   * @returns true, if manifest is read; false, if there is no manifest or it is broken.
+   */
+  bool Load(std::string const & binariesPath);
+
+  /*! Writes manifest to directory of knowledge base binaries.
+   * @throws utils::ExceptionCritical if manifest can't be written.
+   */
+  void Save(std::string const & binariesPath) const;
+
+  static void Remove(std::string const & binariesPath);
+
+  Sources & GetSources();
+
+private:
+  static inline std::string const kHeader = "sc-builder-manifest 1";
+  //! Minimal size of written element: its address hash, space, its type and new line
+  static size_t constexpr kMinElementSize = 4;
+
+  Sources m_sources;
+
+  static std::string GetPath(std::string const & binariesPath);
+};
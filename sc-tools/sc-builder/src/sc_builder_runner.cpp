@@ -6,6 +6,7 @@
 
 #include "sc_builder_runner.hpp"
 
+#include <charconv>
 #include <iostream>
 
 #include <sc-config/sc_options.hpp>
@@ -32,10 +33,24 @@ void PrintHelpMessage(std::string const & binaryName)
             << binaryName << ".\n"
             << "  --clear                                 Run sc-builder in the mode when it overwrites "
                "existing knowledge base binaries.\n"
+            << "  --jobs|-j <count>                       Provide a count of threads parsing sources. By default, it "
+               "is count of hardware threads.\n"
             << "  --version                               Display version of " << binaryName << ".\n"
             << "  --help                                  Display this help message.\n";
 }
 
+size_t ParseJobsCount(std::string const & jobs)
+{
+  size_t jobsCount = 0;
+  auto const [end, error] = std::from_chars(jobs.data(), jobs.data() + jobs.size(), jobsCount);
+  if (error != std::errc() || end != jobs.data() + jobs.size() || jobsCount == 0)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Count of jobs `" << jobs << "` is not positive integer. For more information, run with --help.");
+
+  return jobsCount;
+}
+
 sc_int RunBuilder(sc_int argc, sc_char * argv[])
 try
 {
@@ -74,6 +89,9 @@ try
     return EXIT_FAILURE;
   }
 
+  if (options.Has({"jobs", "j"}))
+    params.m_jobsCount = ParseJobsCount(options[{"jobs", "j"}].second);
+
   std::string configPath;
   if (options.Has({"config", "c"}))
     configPath = options[{"config", "c"}].second;
@@ -82,7 +100,7 @@ try
   if (!params.m_outputPath.empty())
     memoryParams.Insert({"storage", params.m_outputPath});
 
-  ScConfig config{configPath, {"storage", "log_file", "input_path"}, {"extensions"}};
+  ScConfig config{configPath, {"storage", "log_file", "input_path", "profile_trace_file"}, {"extensions"}};
   ScMemoryConfig memoryConfig{config, memoryParams};
 
   sc_memory_params formedMemoryParams = memoryConfig.GetParams();
@@ -99,6 +117,11 @@ try
   formedMemoryParams.dump_memory = SC_FALSE;
   formedMemoryParams.dump_memory_statistics = SC_FALSE;
   formedMemoryParams.user_mode = SC_FALSE;
+  // sources are generated in sc-memory by one thread, and nobody subscribes to sc-events of built knowledge base, so
+  // extensions aren't loaded
+  formedMemoryParams.offline_build = SC_TRUE;
+  formedMemoryParams.extensions = nullptr;
+  formedMemoryParams.enabled_exts = nullptr;
 
   Builder builder;
   return builder.Run(params, formedMemoryParams) ? EXIT_SUCCESS : EXIT_FAILURE;
@@ -0,0 +1,109 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_sources_parser.hpp"
+
+#include <algorithm>
+
+ScSourcesParser::ScSourcesParser(std::vector<std::string> const & sources, size_t jobsCount, ParseCallback parse)
+  : m_sources(sources)
+  , m_parse(std::move(parse))
+  , m_parsedSources(sources.size())
+{
+  if (jobsCount == 0)
+    jobsCount = std::max(std::thread::hardware_concurrency(), 1u);
+  jobsCount = std::max<size_t>(std::min(jobsCount, sources.size()), 1);
+
+  m_maxParsedSourcesCount = jobsCount * kMaxParsedSourcesPerJob;
+
+  m_threads.reserve(jobsCount);
+  for (size_t i = 0; i < jobsCount; ++i)
+    m_threads.emplace_back(&ScSourcesParser::ParseSources, this);
+}
+
+ScSourcesParser::~ScSourcesParser()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopped = true;
+  }
+  m_takenCond.notify_all();
+
+  for (auto & thread : m_threads)
+    thread.join();
+}
+
+std::unique_ptr<scs::Parser> ScSourcesParser::Take(size_t index)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  ParsedSource & source = m_parsedSources[index];
+  m_parsedCond.wait(
+      lock,
+      [&source]
+      {
+        return source.m_isParsed;
+      });
+
+  std::unique_ptr<scs::Parser> parser = std::move(source.m_parser);
+  std::exception_ptr const exception = source.m_exception;
+  source.m_exception = nullptr;
+  m_takenSourcesCount = index + 1;
+
+  lock.unlock();
+  m_takenCond.notify_all();
+
+  if (exception)
+    std::rethrow_exception(exception);
+
+  return parser;
+}
+
+size_t ScSourcesParser::GetJobsCount() const
+{
+  return m_threads.size();
+}
+
+void ScSourcesParser::ParseSources()
+{
+  while (true)
+  {
+    size_t index;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_takenCond.wait(
+          lock,
+          [this]
+          {
+            return m_isStopped || m_nextSourceIndex >= m_sources.size()
+                   || m_nextSourceIndex < m_takenSourcesCount + m_maxParsedSourcesCount;
+          });
+      if (m_isStopped || m_nextSourceIndex >= m_sources.size())
+        return;
+
+      index = m_nextSourceIndex++;
+    }
+
+    auto parser = std::make_unique<scs::Parser>();
+    std::exception_ptr exception;
+    try
+    {
+      m_parse(m_sources[index], *parser);
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ParsedSource & source = m_parsedSources[index];
+      source.m_parser = std::move(parser);
+      source.m_exception = exception;
+      source.m_isParsed = true;
+    }
+    m_parsedCond.notify_all();
+  }
+}
@@ -0,0 +1,76 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sc-memory/scs/scs_parser.hpp>
+
+/*!
+ * Parses sources by pool of threads and gives their parsers in order of sources, so elements of sources can be
+ * generated in the same order as sources are parsed one by one. Threads parse sources only ahead of taken sources by
+ * limited count, so parsers of all sources aren't kept in memory at once.
+ */
+class ScSourcesParser
+{
+public:
+  using ParseCallback = std::function<void(std::string const & fileName, scs::Parser & parser)>;
+
+  static size_t constexpr kMaxParsedSourcesPerJob = 4;
+
+  /*!
+   * @param sources Paths to sources in order of their taking.
+   * @param jobsCount Count of threads that parse sources. If it is 0, then it is count of hardware threads.
+   * @param parse Callback that parses source. It is called from different threads in parallel, so it mustn't change
+   * sc-memory.
+   */
+  ScSourcesParser(std::vector<std::string> const & sources, size_t jobsCount, ParseCallback parse);
+
+  ~ScSourcesParser();
+
+  /*!
+   * Waits until source is parsed and gives its parser. Sources must be taken in order.
+   * @param index Index of source.
+   * @returns Parser that has parsed source.
+   * @throws Exception thrown by parse callback for this source.
+   */
+  std::unique_ptr<scs::Parser> Take(size_t index);
+
+  size_t GetJobsCount() const;
+
+private:
+  struct ParsedSource
+  {
+    std::unique_ptr<scs::Parser> m_parser;
+    std::exception_ptr m_exception;
+    bool m_isParsed = false;
+  };
+
+  std::vector<std::string> const & m_sources;
+  ParseCallback m_parse;
+
+  std::vector<ParsedSource> m_parsedSources;
+  size_t m_maxParsedSourcesCount;
+  size_t m_nextSourceIndex = 0;
+  size_t m_takenSourcesCount = 0;
+  bool m_isStopped = false;
+
+  std::mutex m_mutex;
+  std::condition_variable m_parsedCond;
+  std::condition_variable m_takenCond;
+
+  std::vector<std::thread> m_threads;
+
+  void ParseSources();
+};
@@ -12,6 +12,7 @@
 
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_scs_helper.hpp>
+#include <sc-memory/scs/scs_parser.hpp>
 
 extern "C"
 {
@@ -24,13 +25,15 @@ namespace impl
 class FileProvider : public SCsFileInterface
 {
 public:
-  explicit FileProvider(std::string parentPath)
-    : m_parentPath(std::move(parentPath))
-  {
-  }
+  FileProvider() = default;
 
   virtual ~FileProvider() = default;
 
+  void SetParentPath(std::string const & parentPath)
+  {
+    m_parentPath = parentPath;
+  }
+
   virtual ScStreamPtr GetFileContent(std::string const & fileURL)
   {
     std::regex const pattern("(\\w+):(\\/{2,3})(.+)");
@@ -52,6 +55,11 @@ public:
       fullPath = match[3];
 
     std::string const extension = utils::StringUtils::GetFileExtension(fullPath);
+    // file content is stored as path to file and isn't copied into sc-memory
+    ScStreamPtr const fileStream = std::make_shared<ScStreamMappedFile>(fullPath);
+    if (fileStream->IsValid())
+      return fileStream;
+
     sc_char * copied;
     sc_str_cpy(copied, fullPath.c_str(), fullPath.size());
     return std::make_shared<ScStream>(copied, fullPath.size(), SC_STREAM_FLAG_READ, SC_TRUE);
@@ -65,18 +73,36 @@ private:
 
 SCsTranslator::SCsTranslator(ScMemoryContext & context)
   : Translator(context)
+  , m_fileProvider(std::make_shared<impl::FileProvider>())
+  , m_helper(std::make_unique<SCsHelper>(context, m_fileProvider))
 {
 }
 
+SCsTranslator::~SCsTranslator() = default;
+
 bool SCsTranslator::TranslateImpl(Params const & params)
+{
+  scs::Parser parser;
+  Parse(params, parser);
+  Generate(params, parser);
+
+  return true;
+}
+
+void SCsTranslator::Parse(Params const & params, scs::Parser & parser) const
 {
   std::string data;
   GetFileContent(params.m_fileName, data);
 
-  SCsHelper scs(m_ctx, std::make_shared<impl::FileProvider>(params.m_fileName));
+  if (!parser.Parse(data))
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, parser.GetParseError());
+}
 
-  if (!scs.GenerateBySCsText(data, params.m_outputStructure))
-    SC_THROW_EXCEPTION(utils::ExceptionParseError, scs.GetLastError());
+void SCsTranslator::Generate(Params const & params, scs::Parser const & parser)
+{
+  // urls of file contents are relative to parsed file
+  m_fileProvider->SetParentPath(params.m_fileName);
 
-  return true;
+  if (!m_helper->GenerateByParsedSCs(parser, params.m_outputStructure, params.m_generatedElements))
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, m_helper->GetLastError());
 }
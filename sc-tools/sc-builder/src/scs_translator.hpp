@@ -6,13 +6,31 @@
 
 #pragma once
 
+#include <memory>
+
 #include "sc-builder/translator.hpp"
 
+class SCsHelper;
+
+namespace impl
+{
+class FileProvider;
+}
+
 class SCsTranslator : public Translator
 {
 public:
   explicit SCsTranslator(class ScMemoryContext & context);
-  ~SCsTranslator() override = default;
+  ~SCsTranslator() override;
 
   bool TranslateImpl(Params const & params) override;
+
+  void Parse(Params const & params, scs::Parser & parser) const override;
+
+  void Generate(Params const & params, scs::Parser const & parser) override;
+
+private:
+  // helper is shared by all sources to resolve every system and global identifier once
+  std::shared_ptr<impl::FileProvider> m_fileProvider;
+  std::unique_ptr<SCsHelper> m_helper;
 };
@@ -6,12 +6,15 @@
 
 #include "builder_test.hpp"
 
+#include <fstream>
+
 #include <sc-builder/builder.hpp>
 
 #include <sc-config/sc_options.hpp>
 #include <sc-config/sc_config.hpp>
 #include <sc-config/sc_memory_config.hpp>
 
+#include "sc_builder_manifest.hpp"
 #include "sc_builder_runner.hpp"
 
 TEST(ScBuilder, Run)
@@ -46,6 +49,23 @@ TEST(ScBuilder, RunWithConfigWithRemovedBuilderGroup)
   EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_FAILURE);
 }
 
+TEST(ScBuilder, RunWithConfigWithExtensions)
+{
+  std::string const & configPath = ScBuilderTest::SC_BUILDER_CONFIGS + "/extensions.ini";
+
+  sc_uint32 const argsNumber = 8;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-c",
+      configPath.c_str(),
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+}
+
 TEST(ScBuilder, RunWithoutConfig)
 {
   sc_uint32 const argsNumber = 6;
@@ -59,6 +79,189 @@ TEST(ScBuilder, RunWithoutConfig)
   EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
 }
 
+TEST(ScBuilder, RunWithJobs)
+{
+  sc_uint32 const argsNumber = 10;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-c",
+      ScBuilderTest::SC_BUILDER_INI.c_str(),
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--clear",
+      "-j",
+      "4"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+}
+
+TEST(ScBuilder, RunWithInvalidJobs)
+{
+  for (sc_char const * jobs : {"0", "-1", "four", "4four", "", "99999999999999999999999"})
+  {
+    sc_uint32 const argsNumber = 10;
+    sc_char const * args[argsNumber] = {
+        "sc-builder",
+        "-c",
+        ScBuilderTest::SC_BUILDER_INI.c_str(),
+        "-i",
+        ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+        "-o",
+        ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+        "--clear",
+        "-j",
+        jobs};
+    EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_FAILURE) << jobs;
+  }
+}
+
+TEST(ScBuilder, BuildIncrementally)
+{
+  std::string const & kbPath = "sc-builder-incremental-kb";
+  std::filesystem::create_directories(kbPath);
+  auto const & WriteSource = [&kbPath](std::string const & fileName, std::string const & text)
+  {
+    std::ofstream(kbPath + "/" + fileName) << text;
+  };
+
+  BuilderParams params;
+  params.m_inputPath = kbPath;
+  params.m_outputPath = ScBuilderTest::SC_BUILDER_KB_BIN;
+
+  sc_memory_params memoryParams;
+  sc_memory_params_clear(&memoryParams);
+  memoryParams.storage = ScBuilderTest::SC_BUILDER_KB_BIN.c_str();
+  memoryParams.dump_memory = SC_FALSE;
+  memoryParams.dump_memory_statistics = SC_FALSE;
+  memoryParams.clear = SC_TRUE;
+
+  WriteSource("changed.scs", "incremental_concept -> [first];;");
+  WriteSource("unchanged.scs", "incremental_concept -> unchanged_element;;");
+  WriteSource("removed.scs", "incremental_concept -> removed_element;;");
+  EXPECT_TRUE(Builder().Run(params, memoryParams));
+
+  memoryParams.clear = SC_FALSE;
+  WriteSource("changed.scs", "incremental_concept -> [second];;");
+  std::filesystem::remove(kbPath + "/removed.scs");
+  EXPECT_TRUE(Builder().Run(params, memoryParams));
+
+  ScMemory::Initialize(memoryParams);
+  {
+    ScMemoryContext context;
+    ScAddr const & conceptAddr = context.SearchElementBySystemIdentifier("incremental_concept");
+    EXPECT_TRUE(conceptAddr.IsValid());
+
+    size_t linksCount = 0;
+    size_t nodesCount = 0;
+    ScIterator3Ptr const it3 = context.CreateIterator3(conceptAddr, ScType::ConstPermPosArc, ScType::Unknown);
+    while (it3->Next())
+    {
+      ScAddr const & targetAddr = it3->Get(2);
+      if (context.GetElementType(targetAddr).IsLink())
+      {
+        std::string content;
+        EXPECT_TRUE(context.GetLinkContent(targetAddr, content));
+        EXPECT_EQ(content, "second");
+        ++linksCount;
+      }
+      else
+      {
+        EXPECT_EQ(targetAddr, context.SearchElementBySystemIdentifier("unchanged_element"));
+        ++nodesCount;
+      }
+    }
+    EXPECT_EQ(linksCount, 1u);
+    EXPECT_EQ(nodesCount, 1u);
+  }
+  ScMemory::Shutdown(SC_FALSE);
+
+  std::filesystem::remove_all(kbPath);
+  std::filesystem::remove_all(ScBuilderTest::SC_BUILDER_KB_BIN);
+}
+
+TEST(ScBuilder, BuildIncrementallyAfterFailedSource)
+{
+  std::string const & kbPath = "sc-builder-incremental-kb";
+  std::filesystem::create_directories(kbPath);
+  auto const & WriteSource = [&kbPath](std::string const & fileName, std::string const & text)
+  {
+    std::ofstream(kbPath + "/" + fileName) << text;
+  };
+
+  BuilderParams params;
+  params.m_inputPath = kbPath;
+  params.m_outputPath = ScBuilderTest::SC_BUILDER_KB_BIN;
+
+  sc_memory_params memoryParams;
+  sc_memory_params_clear(&memoryParams);
+  memoryParams.storage = ScBuilderTest::SC_BUILDER_KB_BIN.c_str();
+  memoryParams.dump_memory = SC_FALSE;
+  memoryParams.dump_memory_statistics = SC_FALSE;
+  memoryParams.clear = SC_TRUE;
+
+  auto const & CountConceptArcs = [&memoryParams]()
+  {
+    size_t arcsCount = 0;
+    ScMemory::Initialize(memoryParams);
+    {
+      ScMemoryContext context;
+      ScAddr const & conceptAddr = context.SearchElementBySystemIdentifier("incremental_concept");
+      if (conceptAddr.IsValid())
+      {
+        ScIterator3Ptr const it3 = context.CreateIterator3(conceptAddr, ScType::ConstPermPosArc, ScType::Unknown);
+        while (it3->Next())
+          ++arcsCount;
+      }
+    }
+    ScMemory::Shutdown(SC_FALSE);
+    return arcsCount;
+  };
+
+  // the first triple is generated before the second one fails
+  WriteSource(
+      "failed.scs",
+      "incremental_concept -> partial_element;; incremental_concept -> [^\"uint64:99999999999999999999999\"];;");
+  EXPECT_FALSE(Builder().Run(params, memoryParams));
+
+  memoryParams.clear = SC_FALSE;
+  EXPECT_EQ(CountConceptArcs(), 0u);
+
+  WriteSource("failed.scs", "incremental_concept -> partial_element;; incremental_concept -> [^\"uint64:16\"];;");
+  EXPECT_TRUE(Builder().Run(params, memoryParams));
+  EXPECT_EQ(CountConceptArcs(), 2u);
+
+  std::filesystem::remove_all(kbPath);
+  std::filesystem::remove_all(ScBuilderTest::SC_BUILDER_KB_BIN);
+}
+
+TEST(ScBuilder, LoadBrokenManifest)
+{
+  std::string const & binariesPath = "sc-builder-manifest-kb";
+  std::filesystem::create_directories(binariesPath);
+  auto const & WriteManifest = [&binariesPath](std::string const & text)
+  {
+    std::ofstream(binariesPath + "/" + ScBuilderManifest::kFileName) << "sc-builder-manifest 1\n" << text;
+  };
+
+  ScBuilderManifest manifest;
+  WriteManifest("source.scs\n1 2\n3 4\n5 6\n");
+  EXPECT_TRUE(manifest.Load(binariesPath));
+  EXPECT_EQ(manifest.GetSources().at("source.scs").m_elements.size(), 2u);
+
+  // huge count of elements isn't allocated
+  WriteManifest("source.scs\n1 18446744073709551615\n3 4\n");
+  EXPECT_FALSE(manifest.Load(binariesPath));
+  EXPECT_TRUE(manifest.GetSources().empty());
+
+  // truncated manifest is broken
+  WriteManifest("source.scs\n1 3\n3 4\n");
+  EXPECT_FALSE(manifest.Load(binariesPath));
+  EXPECT_TRUE(manifest.GetSources().empty());
+
+  std::filesystem::remove_all(binariesPath);
+}
+
 TEST(ScBuilder, RunWithoutInput)
 {
   sc_uint32 const argsNumber = 4;
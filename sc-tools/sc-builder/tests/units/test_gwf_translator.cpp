@@ -109,6 +109,18 @@ TEST_F(GWFTranslatorTest, UnknownLinkContent)
   EXPECT_THROW(GWFTranslator::TranslateXMLFileContentToSCs(filePath), utils::ExceptionParseError);
 }
 
+TEST_F(GWFTranslatorTest, ExternalEntity)
+{
+  std::string const filePath = SC_BUILDER_KB_GWF + "/external_entity.gwf";
+  EXPECT_THROW(GWFTranslator::TranslateXMLFileContentToSCs(filePath), utils::ExceptionParseError);
+}
+
+TEST_F(GWFTranslatorTest, ExternalSubset)
+{
+  std::string const filePath = SC_BUILDER_KB_GWF + "/external_subset.gwf";
+  EXPECT_THROW(GWFTranslator::TranslateXMLFileContentToSCs(filePath), utils::ExceptionParseError);
+}
+
 TEST_F(GWFTranslatorTest, ContourWithUnknownParent)
 {
   std::string const filePath = SC_BUILDER_KB_GWF + "/contour_with_unknown_parent.gwf";
@@ -206,21 +218,17 @@ TEST_F(GWFTranslatorTest, SCsTree)
   }
 }
 
-class TestGWFTranslator : public GWFTranslator
+TEST_F(GWFTranslatorTest, TranslateWithoutTemporaryFiles)
 {
-public:
-  explicit TestGWFTranslator(class ScMemoryContext & context)
-    : GWFTranslator(context)
-  {
-  }
+  std::string const & gwfFilePath = ScBuilderTest::SC_BUILDER_KB_GWF + "bus.gwf";
 
-  using GWFTranslator::WriteStringToFile;
-};
+  GWFTranslator translator(*m_ctx);
+  Translator::Params params;
+  params.m_fileName = gwfFilePath;
+  params.m_autoFormatInfo = false;
+  EXPECT_TRUE(translator.Translate(params));
 
-TEST_F(GWFTranslatorTest, WriteStringToFileInUnknownDirectory)
-{
-  TestGWFTranslator translator(*m_ctx);
-  EXPECT_THROW(translator.WriteStringToFile("text", "test/test.txt"), utils::ExceptionCritical);
+  EXPECT_FALSE(std::filesystem::exists(gwfFilePath + ".generated.scs"));
 }
 
 TEST_F(GWFTranslatorTest, DifferencesToString)
@@ -138,6 +138,7 @@ sc_memory_params ScMemoryConfig::GetParams()
   m_memoryParams.log_type = GetStringByKey("log_type", DEFAULT_LOG_TYPE);
   m_memoryParams.log_file = GetStringByKey("log_file", DEFAULT_LOG_FILE);
   m_memoryParams.log_level = GetStringByKey("log_level", DEFAULT_LOG_LEVEL);
+  m_memoryParams.profile_trace_file = GetStringByKey("profile_trace_file", DEFAULT_PROFILE_TRACE_FILE);
 
   m_memoryParams.init_memory_generated_upload = GetBoolByKey("init_memory_generated_upload");
   m_memoryParams.init_memory_generated_structure = GetStringByKey("init_memory_generated_structure");
@@ -151,6 +152,11 @@ sc_memory_params ScMemoryConfig::GetParams()
   m_memoryParams.term_separators = GetStringByKey("term_separators", DEFAULT_TERM_SEPARATORS);
   m_memoryParams.search_by_substring = GetBoolByKey("search_by_substring", DEFAULT_SEARCH_BY_SUBSTRING);
 
+  m_memoryParams.compact_strings = GetBoolByKey("compact_strings", DEFAULT_COMPACT_STRINGS);
+  m_memoryParams.compact_strings_period = GetIntByKey("compact_strings_period", DEFAULT_COMPACT_STRINGS_PERIOD);
+  m_memoryParams.compact_strings_min_unreferenced_percent =
+      GetIntByKey("compact_strings_min_unreferenced_percent", DEFAULT_COMPACT_STRINGS_MIN_UNREFERENCED_PERCENT);
+
   return m_memoryParams;
 }
 
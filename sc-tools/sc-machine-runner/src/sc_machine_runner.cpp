@@ -78,7 +78,7 @@ try
 
   ScMemory::ms_configPath = configPath;
 
-  ScConfig config{configPath, {"extensions", "repo_path", "storage", "log_file"}};
+  ScConfig config{configPath, {"extensions", "repo_path", "storage", "log_file", "profile_trace_file"}};
   ScParams memoryParams{options, {{"extensions", "e"}, {"storage", "s"}, {"clear"}}};
   ScMemoryConfig memoryConfig{config, memoryParams};
 
@@ -0,0 +1,172 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <map>
+
+#include "sc_memory_json_action.hpp"
+
+#include <sc-memory/sc_agent_context.hpp>
+
+/*!
+ * Completes ordered list of sub-requests `[{"type": <request type>, "payload": <request payload>}, ...]` in one
+ * request. Every sub-request payload can contain references `{"batch_ref": [<sub-request index>, <item index>]}` to
+ * items of payloads of previous sub-requests responses, item index can be omitted to reference whole payload.
+ * Sc-events of all sub-requests are pended until the last sub-request is completed.
+ */
+class ScMemoryBatchJsonAction : public ScMemoryJsonAction
+{
+public:
+  explicit ScMemoryBatchJsonAction(std::map<std::string, ScMemoryJsonAction *> const & actions)
+    : m_actions(actions)
+  {
+  }
+
+  ScMemoryJsonPayload Complete(
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    if (!requestPayload.is_array())
+    {
+      errorsPayload = "Batch request payload must be an array of sub-requests";
+      return {};
+    }
+
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array();
+    ScMemoryContextEventsPendingGuard guard(*context);
+
+    for (size_t i = 0; i < requestPayload.size(); ++i)
+    {
+      ScMemoryJsonPayload subErrorsPayload = ScMemoryJsonPayload::array();
+      ScMemoryJsonPayload subResponsePayload = CompleteSubRequest(
+          context, i, std::move(requestPayload[i]), responsePayload, subErrorsPayload);
+
+      sc_bool const subStatus = subErrorsPayload.empty();
+      if (subStatus == SC_FALSE)
+        errorsPayload.push_back("Batch sub-request " + std::to_string(i) + " has not been completed");
+
+      responsePayload.push_back(
+          {{"status", subStatus}, {"errors", std::move(subErrorsPayload)}, {"payload", std::move(subResponsePayload)}});
+    }
+
+    return responsePayload;
+  }
+
+protected:
+  std::map<std::string, ScMemoryJsonAction *> const & m_actions;
+
+  ScMemoryJsonPayload CompleteSubRequest(
+      ScAgentContext * context,
+      size_t subRequestIndex,
+      ScMemoryJsonPayload subRequest,
+      ScMemoryJsonPayload const & responsePayload,
+      ScMemoryJsonPayload & errorsPayload)
+  {
+    if (!subRequest.is_object() || !subRequest.contains("type") || !subRequest["type"].is_string()
+        || !subRequest.contains("payload"))
+    {
+      errorsPayload = "Invalid batch sub-request";
+      return {};
+    }
+
+    std::string const & requestType = subRequest["type"].get_ref<std::string const &>();
+    auto const & it = m_actions.find(requestType);
+    if (it == m_actions.cend() || it->second == this)
+    {
+      errorsPayload = "Unsupported batch sub-request type: " + requestType;
+      return {};
+    }
+
+    ScMemoryJsonPayload & requestPayload = subRequest["payload"];
+    if (!ResolveReferences(requestPayload, subRequestIndex, responsePayload, errorsPayload))
+      return {};
+
+    try
+    {
+      return it->second->Complete(context, std::move(requestPayload), errorsPayload);
+    }
+    catch (utils::ScException const & e)
+    {
+      errorsPayload = e.Description();
+    }
+    catch (std::exception const & e)
+    {
+      errorsPayload = e.what();
+    }
+
+    return {};
+  }
+
+  static sc_bool ResolveReferences(
+      ScMemoryJsonPayload & payload,
+      size_t subRequestIndex,
+      ScMemoryJsonPayload const & responsePayload,
+      ScMemoryJsonPayload & errorsPayload)
+  {
+    if (payload.is_array())
+    {
+      for (auto & item : payload)
+      {
+        if (!ResolveReferences(item, subRequestIndex, responsePayload, errorsPayload))
+          return SC_FALSE;
+      }
+      return SC_TRUE;
+    }
+
+    if (!payload.is_object())
+      return SC_TRUE;
+
+    auto const & refIt = payload.find("batch_ref");
+    if (refIt == payload.end() || payload.size() != 1)
+    {
+      for (auto & item : payload)
+      {
+        if (!ResolveReferences(item, subRequestIndex, responsePayload, errorsPayload))
+          return SC_FALSE;
+      }
+      return SC_TRUE;
+    }
+
+    auto const & isIndex = [](ScMemoryJsonPayload const & index) -> sc_bool
+    {
+      return index.is_number_integer() && index.get<int64_t>() >= 0;
+    };
+
+    ScMemoryJsonPayload const & ref = *refIt;
+    if (!ref.is_array() || ref.empty() || ref.size() > 2 || !isIndex(ref[0]) || (ref.size() == 2 && !isIndex(ref[1])))
+    {
+      errorsPayload = "Invalid batch reference: " + ref.dump();
+      return SC_FALSE;
+    }
+
+    // Only responses of previous sub-requests can be referenced
+    size_t const refSubRequestIndex = ref[0].get<size_t>();
+    if (refSubRequestIndex >= subRequestIndex || !responsePayload[refSubRequestIndex]["status"].get<bool>())
+    {
+      errorsPayload = "Batch reference to not completed sub-request: " + ref.dump();
+      return SC_FALSE;
+    }
+
+    ScMemoryJsonPayload const & refPayload = responsePayload[refSubRequestIndex]["payload"];
+    if (ref.size() == 1)
+    {
+      payload = refPayload;
+      return SC_TRUE;
+    }
+
+    size_t const refItemIndex = ref[1].get<size_t>();
+    if (!refPayload.is_array() || refItemIndex >= refPayload.size())
+    {
+      errorsPayload = "Batch reference to not existing item: " + ref.dump();
+      return SC_FALSE;
+    }
+
+    payload = refPayload[refItemIndex];
+    return SC_TRUE;
+  }
+};
@@ -70,14 +70,75 @@ private:
   {
     ScAddr const & linkAddr = ScAddr(atom["addr"].get<size_t>());
     ScLink link{*context, linkAddr};
+    ScLink::Type const type = link.DetermineType();
+
+    // content is got once, numbers are parsed from the same stream that strings are viewed in
+    ScStreamPtr const & stream = context->GetLinkContent(linkAddr);
+    if (!stream || !stream->IsValid())
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Invalid sc-address to get content value");
+
+    if (type >= ScLink::Type::Int8 && type <= ScLink::Type::UInt64)
+      return {{"value", GetNumber<sc_int>(link, stream)}, {"type", "int"}};
+    else if (type == ScLink::Type::Float || type == ScLink::Type::Double)
+      return {{"value", GetNumber<float>(link, stream)}, {"type", "float"}};
+
+    sc_char const * data = nullptr;
+    size_t size = 0;
+    std::string content;
+    // stream data is sent without intermediate copies, binary data is encoded to be valid json string
+    if (!stream->View(data, size) || data == nullptr)
+    {
+      ScStreamConverter::StreamToString(stream, content);
+      data = content.data();
+      size = content.size();
+    }
 
-    ScMemoryJsonPayload answer;
-    if (link.DetermineType() >= ScLink::Type::Int8 && link.DetermineType() <= ScLink::Type::UInt64)
-      return {{"value", link.Get<sc_int>()}, {"type", "int"}};
-    else if (link.IsType<double>() || link.IsType<float>())
-      return {{"value", link.Get<float>()}, {"type", "float"}};
+    if (!IsUtf8(data, size))
+      return {{"value", ScBase64::Encode(reinterpret_cast<unsigned char const *>(data), size)}, {"type", "binary"}};
     else
-      return {{"value", link.Get<std::string>()}, {"type", "string"}};
+      return {{"value", std::string(data, size)}, {"type", "string"}};
+  }
+
+  template <typename TNumber>
+  static TNumber GetNumber(ScLink const & link, ScStreamPtr const & stream)
+  {
+    TNumber value;
+    if (!link.Stream2Value(stream, value))
+      SC_THROW_EXCEPTION(utils::ExceptionCritical, "Failed to get the value of " + std::to_string(link.Hash()));
+
+    return value;
+  }
+
+  static bool IsUtf8(sc_char const * data, size_t const size)
+  {
+    auto const * bytes = reinterpret_cast<unsigned char const *>(data);
+    for (size_t i = 0; i < size;)
+    {
+      size_t sequenceSize;
+      if (bytes[i] < 0x80)
+        sequenceSize = 1;
+      else if ((bytes[i] & 0xE0) == 0xC0 && bytes[i] >= 0xC2)
+        sequenceSize = 2;
+      else if ((bytes[i] & 0xF0) == 0xE0)
+        sequenceSize = 3;
+      else if ((bytes[i] & 0xF8) == 0xF0 && bytes[i] <= 0xF4)
+        sequenceSize = 4;
+      else
+        return false;
+
+      if (sequenceSize > size - i)
+        return false;
+
+      for (size_t j = 1; j < sequenceSize; ++j)
+      {
+        if ((bytes[i + j] & 0xC0) != 0x80)
+          return false;
+      }
+
+      i += sequenceSize;
+    }
+
+    return true;
   }
 
   std::vector<size_t> SearchLinksByContent(ScAgentContext * context, ScMemoryJsonPayload const & atom)
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "sc-server-impl/sc-memory-json/sc_memory_json_payload.hpp"
+#include "sc-server-impl/sc-memory-json/sc_memory_binary_payload_writer.hpp"
 
 class ScAgentContext;
 
@@ -18,5 +19,18 @@ public:
       ScMemoryJsonPayload requestPayload,
       ScMemoryJsonPayload & errorsPayload) = 0;
 
+  /*!
+   * Completes action for binary message and writes its response payload by writer. By default, response payload is
+   * built by `Complete` and encoded after that. Actions with large responses write them directly.
+   */
+  virtual void CompleteBinary(
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload,
+      ScMemoryBinaryPayloadWriter & responseWriter)
+  {
+    responseWriter.WritePayload(Complete(context, std::move(requestPayload), errorsPayload));
+  }
+
   virtual ~ScMemoryJsonAction() = default;
 };
@@ -16,3 +16,5 @@
 #include "sc_memory_handle_keynodes_json_action.hpp"
 #include "sc_memory_template_generate_json_action.hpp"
 #include "sc_memory_template_search_json_action.hpp"
+#include "sc_memory_template_search_page_json_action.hpp"
+#include "sc_memory_batch_json_action.hpp"
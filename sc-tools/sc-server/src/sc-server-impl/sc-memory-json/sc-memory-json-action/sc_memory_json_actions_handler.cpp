@@ -10,9 +10,8 @@
 
 std::map<std::string, ScMemoryJsonAction *> ScMemoryJsonActionsHandler::m_actions;
 
-ScMemoryJsonActionsHandler::ScMemoryJsonActionsHandler(ScServer * server, ScAgentContext * sessionCtx)
+ScMemoryJsonActionsHandler::ScMemoryJsonActionsHandler(ScServer * server)
   : ScMemoryJsonHandler(server)
-  , m_context(sessionCtx)
 {
 }
 
@@ -28,13 +27,17 @@ void ScMemoryJsonActionsHandler::InitializeActionClasses()
       {"check_elements", new ScMemoryCheckElementsJsonAction()},
       {"delete_elements", new ScMemoryEraseElementsJsonAction()},
       {"search_template", new ScMemoryTemplateSearchJsonAction()},
+      {"search_template_page", new ScMemoryTemplateSearchPageJsonAction()},
       {"generate_template", new ScMemoryTemplateGenerateJsonAction()},
       {"content", new ScMemoryHandleLinkContentJsonAction()},
   };
+  m_actions.insert({"batch", new ScMemoryBatchJsonAction(m_actions)});
 }
 
 void ScMemoryJsonActionsHandler::ClearActionClasses()
 {
+  ScMemoryTemplateSearchCursors::Clear();
+
   for (auto & it : m_actions)
   {
     delete it.second;
@@ -44,8 +47,9 @@ void ScMemoryJsonActionsHandler::ClearActionClasses()
 
 ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleRequestPayload(
     ScServerSessionId const &,
+    ScAgentContext * sessionCtx,
     std::string const & requestType,
-    ScMemoryJsonPayload const & requestPayload,
+    ScMemoryJsonPayload & requestPayload,
     ScMemoryJsonPayload & errorsPayload,
     sc_bool & status,
     sc_bool & isEvent)
@@ -63,8 +67,36 @@ ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleRequestPayload(
   }
 
   auto * action = it->second;
-  responsePayload = action->Complete(m_context, requestPayload, errorsPayload);
+  responsePayload = action->Complete(sessionCtx, std::move(requestPayload), errorsPayload);
 
   status = errorsPayload.empty();
   return responsePayload;
 }
+
+void ScMemoryJsonActionsHandler::HandleBinaryRequestPayload(
+    ScServerSessionId const &,
+    ScAgentContext * sessionCtx,
+    std::string const & requestType,
+    ScMemoryJsonPayload & requestPayload,
+    ScMemoryJsonPayload & errorsPayload,
+    sc_bool & status,
+    sc_bool & isEvent,
+    ScMemoryBinaryPayloadWriter & responseWriter)
+{
+  status = SC_FALSE;
+  isEvent = SC_FALSE;
+
+  auto const & it = m_actions.find(requestType);
+  if (it == m_actions.end())
+  {
+    errorsPayload = "Unsupported request type: " + requestType;
+    m_server->LogMessage(ScServerErrorLevel::error, errorsPayload);
+    responseWriter.WriteNil();
+    return;
+  }
+
+  auto * action = it->second;
+  action->CompleteBinary(sessionCtx, std::move(requestPayload), errorsPayload, responseWriter);
+
+  status = errorsPayload.empty();
+}
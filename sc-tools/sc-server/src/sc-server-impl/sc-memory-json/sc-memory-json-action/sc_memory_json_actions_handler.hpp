@@ -15,7 +15,7 @@
 class ScMemoryJsonActionsHandler : public ScMemoryJsonHandler
 {
 public:
-  explicit ScMemoryJsonActionsHandler(ScServer * server, ScAgentContext * processCtx);
+  explicit ScMemoryJsonActionsHandler(ScServer * server);
 
   ~ScMemoryJsonActionsHandler() override;
 
@@ -24,15 +24,24 @@ public:
   static void ClearActionClasses();
 
 private:
-  ScAgentContext * m_context;
-
   ScMemoryJsonPayload HandleRequestPayload(
       ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
       std::string const & requestType,
-      ScMemoryJsonPayload const & requestPayload,
+      ScMemoryJsonPayload & requestPayload,
       ScMemoryJsonPayload & errorsPayload,
       sc_bool & status,
       sc_bool & isEvent) override;
 
+  void HandleBinaryRequestPayload(
+      ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
+      std::string const & requestType,
+      ScMemoryJsonPayload & requestPayload,
+      ScMemoryJsonPayload & errorsPayload,
+      sc_bool & status,
+      sc_bool & isEvent,
+      ScMemoryBinaryPayloadWriter & responseWriter) override;
+
   static std::map<std::string, ScMemoryJsonAction *> m_actions;
 };
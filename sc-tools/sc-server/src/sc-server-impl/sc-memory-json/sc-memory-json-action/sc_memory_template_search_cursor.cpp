@@ -0,0 +1,341 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_memory_template_search_cursor.hpp"
+
+std::mutex ScMemoryTemplateSearchCursor::m_searchesMutex;
+std::condition_variable ScMemoryTemplateSearchCursor::m_searchesCond;
+size_t ScMemoryTemplateSearchCursor::m_searchesCount = 0;
+
+ScMemoryTemplateSearchCursor::ScMemoryTemplateSearchCursor(
+    ScAgentContext * sessionCtx,
+    ScTemplate * templ,
+    size_t pageSize)
+  : m_sessionCtx(sessionCtx)
+  , m_template(templ)
+  , m_pageSize(pageSize == 0 ? 1 : pageSize)
+  , m_aliases(ScMemoryJsonPayload::object())
+  , m_isFinished(SC_FALSE)
+  , m_isCancelled(SC_FALSE)
+{
+}
+
+ScMemoryTemplateSearchCursor::~ScMemoryTemplateSearchCursor() = default;
+
+void ScMemoryTemplateSearchCursor::Start()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_searchesMutex);
+    ++m_searchesCount;
+  }
+
+  // Search uses its own context, so session context isn't used by several threads
+  std::thread(
+      [self = shared_from_this(), userAddr = m_sessionCtx->GetUser()]() mutable
+      {
+        self->Search(userAddr);
+        // Cursor is released before search is counted as finished, so it doesn't outlive sc-memory
+        self.reset();
+
+        {
+          std::lock_guard<std::mutex> lock(m_searchesMutex);
+          --m_searchesCount;
+        }
+        m_searchesCond.notify_all();
+      })
+      .detach();
+}
+
+void ScMemoryTemplateSearchCursor::WaitSearches()
+{
+  std::unique_lock<std::mutex> lock(m_searchesMutex);
+  m_searchesCond.wait(
+      lock,
+      []
+      {
+        return m_searchesCount == 0;
+      });
+}
+
+sc_bool ScMemoryTemplateSearchCursor::NextPage(
+    ScMemoryJsonPayload & page,
+    ScMemoryJsonPayload & aliases,
+    ScMemoryJsonPayload & errorsPayload)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cond.wait(
+      lock,
+      [this]
+      {
+        return !m_pages.empty() || m_isFinished || m_isCancelled;
+      });
+
+  if (m_pages.empty())
+    page = ScMemoryJsonPayload::array();
+  else
+  {
+    page = std::move(m_pages.front());
+    m_pages.pop();
+    m_cond.notify_all();
+  }
+
+  aliases = m_aliases;
+  if (!m_error.empty())
+    errorsPayload = m_error;
+
+  return !m_isCancelled && (!m_isFinished || !m_pages.empty());
+}
+
+void ScMemoryTemplateSearchCursor::Cancel()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isCancelled = SC_TRUE;
+  }
+  m_cond.notify_all();
+}
+
+ScAgentContext * ScMemoryTemplateSearchCursor::GetSessionContext() const
+{
+  return m_sessionCtx;
+}
+
+void ScMemoryTemplateSearchCursor::Search(ScAddr const & userAddr)
+{
+  ScAgentContext context{userAddr};
+  ScMemoryJsonPayload page = ScMemoryJsonPayload::array();
+  sc_bool isFirstItem = SC_TRUE;
+
+  try
+  {
+    context.SearchByTemplateInterruptibly(
+        *m_template,
+        [&](ScTemplateResultItem const & item) -> ScTemplateSearchRequest
+        {
+          {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isCancelled)
+              return ScTemplateSearchRequest::STOP;
+          }
+
+          if (isFirstItem)
+          {
+            isFirstItem = SC_FALSE;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
+            m_aliases = item.GetReplacements();
+            SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
+          }
+
+          std::vector<size_t> hashes;
+          hashes.reserve(item.Size());
+          for (ScAddr const & addr : item)
+            hashes.push_back(addr.Hash());
+          page.push_back(std::move(hashes));
+
+          if (page.size() < m_pageSize)
+            return ScTemplateSearchRequest::CONTINUE;
+
+          return PushPage(page, SC_FALSE) ? ScTemplateSearchRequest::CONTINUE : ScTemplateSearchRequest::STOP;
+        },
+        {},
+        // Cancelled search doesn't go deeper for sc-constructions that would be dropped
+        [this](ScAddr const &) -> bool
+        {
+          return !m_isCancelled;
+        });
+  }
+  catch (utils::ScException const & e)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_error = e.Description();
+  }
+
+  PushPage(page, SC_TRUE);
+}
+
+sc_bool ScMemoryTemplateSearchCursor::PushPage(ScMemoryJsonPayload & page, sc_bool isLast)
+{
+  sc_bool isCancelled;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!isLast)
+    {
+      m_cond.wait(
+          lock,
+          [this]
+          {
+            return m_pages.size() < kMaxBufferedPages || m_isCancelled;
+          });
+    }
+
+    if (m_isCancelled == SC_FALSE && !page.empty())
+      m_pages.push(std::move(page));
+    page = ScMemoryJsonPayload::array();
+
+    if (isLast)
+      m_isFinished = SC_TRUE;
+    isCancelled = m_isCancelled;
+  }
+  m_cond.notify_all();
+
+  return !isCancelled;
+}
+
+std::mutex ScMemoryTemplateSearchCursors::m_mutex;
+std::unordered_map<size_t, ScMemoryTemplateSearchCursors::ScMemoryTemplateSearchCursorEntry>
+    ScMemoryTemplateSearchCursors::m_cursors;
+size_t ScMemoryTemplateSearchCursors::m_counter = 0;
+std::condition_variable ScMemoryTemplateSearchCursors::m_reaperCond;
+std::thread ScMemoryTemplateSearchCursors::m_reaperThread;
+sc_bool ScMemoryTemplateSearchCursors::m_isReaperRun = SC_FALSE;
+
+sc_bool ScMemoryTemplateSearchCursors::CanAdd(ScAgentContext const * sessionCtx)
+{
+  std::vector<ScMemoryTemplateSearchCursorPtr> idleCursors;
+  sc_bool canAdd;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    RemoveIdleCursors(idleCursors);
+
+    size_t sessionCursorsCount = 0;
+    for (auto const & it : m_cursors)
+    {
+      if (it.second.m_cursor->GetSessionContext() == sessionCtx)
+        ++sessionCursorsCount;
+    }
+
+    canAdd = sessionCursorsCount < kMaxSessionCursors && m_cursors.size() < kMaxCursors;
+  }
+
+  CancelCursors(idleCursors);
+  return canAdd;
+}
+
+size_t ScMemoryTemplateSearchCursors::Add(ScMemoryTemplateSearchCursorPtr const & cursor)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_isReaperRun == SC_FALSE)
+  {
+    m_isReaperRun = SC_TRUE;
+    m_reaperThread = std::thread(&ScMemoryTemplateSearchCursors::ReapIdleCursors);
+  }
+
+  m_cursors.insert({m_counter, {cursor, std::chrono::steady_clock::now()}});
+  return m_counter++;
+}
+
+void ScMemoryTemplateSearchCursors::ReapIdleCursors()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (m_isReaperRun == SC_TRUE)
+  {
+    // Cursor becomes idle at most `kCursorIdleTimeout` after it is checked, so it is cancelled in two timeouts
+    m_reaperCond.wait_for(
+        lock,
+        kCursorIdleTimeout,
+        []
+        {
+          return m_isReaperRun == SC_FALSE;
+        });
+
+    std::vector<ScMemoryTemplateSearchCursorPtr> idleCursors;
+    RemoveIdleCursors(idleCursors);
+
+    lock.unlock();
+    CancelCursors(idleCursors);
+    lock.lock();
+  }
+}
+
+void ScMemoryTemplateSearchCursors::RemoveIdleCursors(std::vector<ScMemoryTemplateSearchCursorPtr> & idleCursors)
+{
+  auto const now = std::chrono::steady_clock::now();
+  for (auto it = m_cursors.begin(); it != m_cursors.end();)
+  {
+    if (now - it->second.m_lastAccessTime >= kCursorIdleTimeout)
+    {
+      idleCursors.push_back(it->second.m_cursor);
+      it = m_cursors.erase(it);
+    }
+    else
+      ++it;
+  }
+}
+
+ScMemoryTemplateSearchCursorPtr ScMemoryTemplateSearchCursors::Get(size_t cursorId, ScAgentContext const * sessionCtx)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const & it = m_cursors.find(cursorId);
+  if (it == m_cursors.cend() || it->second.m_cursor->GetSessionContext() != sessionCtx)
+    return nullptr;
+
+  it->second.m_lastAccessTime = std::chrono::steady_clock::now();
+  return it->second.m_cursor;
+}
+
+void ScMemoryTemplateSearchCursors::Remove(size_t cursorId)
+{
+  ScMemoryTemplateSearchCursorPtr cursor;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const & it = m_cursors.find(cursorId);
+    if (it == m_cursors.cend())
+      return;
+
+    cursor = it->second.m_cursor;
+    m_cursors.erase(it);
+  }
+
+  cursor->Cancel();
+}
+
+void ScMemoryTemplateSearchCursors::RemoveSessionCursors(ScAgentContext const * sessionCtx)
+{
+  std::vector<ScMemoryTemplateSearchCursorPtr> cursors;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_cursors.begin(); it != m_cursors.end();)
+    {
+      if (it->second.m_cursor->GetSessionContext() == sessionCtx)
+      {
+        cursors.push_back(it->second.m_cursor);
+        it = m_cursors.erase(it);
+      }
+      else
+        ++it;
+    }
+  }
+
+  CancelCursors(cursors);
+}
+
+void ScMemoryTemplateSearchCursors::Clear()
+{
+  std::vector<ScMemoryTemplateSearchCursorPtr> cursors;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isReaperRun = SC_FALSE;
+    for (auto const & it : m_cursors)
+      cursors.push_back(it.second.m_cursor);
+    m_cursors.clear();
+  }
+  m_reaperCond.notify_all();
+
+  if (m_reaperThread.joinable())
+    m_reaperThread.join();
+
+  // Search threads use sc-memory, so they are finished before sc-memory is shut down
+  CancelCursors(cursors);
+  cursors.clear();
+  ScMemoryTemplateSearchCursor::WaitSearches();
+}
+
+void ScMemoryTemplateSearchCursors::CancelCursors(std::vector<ScMemoryTemplateSearchCursorPtr> const & cursors)
+{
+  for (auto const & cursor : cursors)
+    cursor->Cancel();
+}
@@ -0,0 +1,131 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+
+#include <sc-memory/sc_agent_context.hpp>
+
+#include "sc-server-impl/sc-memory-json/sc_memory_json_payload.hpp"
+
+/*!
+ * Searches sc-constructions by sc-template in its own thread and splits found sc-constructions into pages. Search is
+ * paused when there are `kMaxBufferedPages` pages not taken by client, so it goes on only as fast as client takes
+ * pages. Search is stopped when cursor is cancelled: paused search is woken up, and running search rejects all next
+ * candidate sc-elements. Search thread owns cursor until it is finished, so cursor is released without waiting for it.
+ */
+class ScMemoryTemplateSearchCursor : public std::enable_shared_from_this<ScMemoryTemplateSearchCursor>
+{
+public:
+  static size_t constexpr kMaxBufferedPages = 2;
+
+  ScMemoryTemplateSearchCursor(ScAgentContext * sessionCtx, ScTemplate * templ, size_t pageSize);
+
+  ~ScMemoryTemplateSearchCursor();
+
+  //! Starts search thread, cursor must be owned by shared pointer
+  void Start();
+
+  //! Waits until search threads of all cursors are finished, they must be cancelled before
+  static void WaitSearches();
+
+  /*!
+   * Waits for next page of found sc-constructions.
+   * @param[out] page An array of found sc-constructions, every sc-construction is an array of sc-addresses hashes.
+   * @param[out] aliases A map of sc-template aliases to positions of sc-addresses in found sc-constructions.
+   * @param[out] errorsPayload An error occurred during search.
+   * @returns SC_TRUE, if there may be more pages after this one.
+   */
+  sc_bool NextPage(ScMemoryJsonPayload & page, ScMemoryJsonPayload & aliases, ScMemoryJsonPayload & errorsPayload);
+
+  void Cancel();
+
+  ScAgentContext * GetSessionContext() const;
+
+private:
+  ScAgentContext * m_sessionCtx;
+  std::unique_ptr<ScTemplate> m_template;
+  size_t m_pageSize;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::queue<ScMemoryJsonPayload> m_pages;
+  ScMemoryJsonPayload m_aliases;
+  std::string m_error;
+  sc_bool m_isFinished;
+  std::atomic<sc_bool> m_isCancelled;
+
+  static std::mutex m_searchesMutex;
+  static std::condition_variable m_searchesCond;
+  static size_t m_searchesCount;
+
+  void Search(ScAddr const & userAddr);
+
+  sc_bool PushPage(ScMemoryJsonPayload & page, sc_bool isLast);
+};
+
+using ScMemoryTemplateSearchCursorPtr = std::shared_ptr<ScMemoryTemplateSearchCursor>;
+
+/*!
+ * Keeps cursors of paginated template searches of all sc-server sessions. Every cursor has its own search thread, so
+ * count of open cursors is limited. Cursors that are not requested for `kCursorIdleTimeout` are cancelled by reaper
+ * thread, and cursors of session are cancelled when session is closed.
+ */
+class ScMemoryTemplateSearchCursors
+{
+public:
+  static size_t constexpr kMaxSessionCursors = 16;
+  static size_t constexpr kMaxCursors = 256;
+  static std::chrono::seconds constexpr kCursorIdleTimeout = std::chrono::seconds(60);
+
+  //! Cancels idle cursors and checks whether session can open one more cursor
+  static sc_bool CanAdd(ScAgentContext const * sessionCtx);
+
+  //! Adds cursor and starts reaper thread of idle cursors, if it isn't started
+  static size_t Add(ScMemoryTemplateSearchCursorPtr const & cursor);
+
+  //! Gets cursor by id if it has been generated by specified session
+  static ScMemoryTemplateSearchCursorPtr Get(size_t cursorId, ScAgentContext const * sessionCtx);
+
+  static void Remove(size_t cursorId);
+
+  //! Cancels and removes all cursors of session, it must be called before session context is destroyed
+  static void RemoveSessionCursors(ScAgentContext const * sessionCtx);
+
+  //! Stops reaper thread, cancels all cursors and waits for their search threads
+  static void Clear();
+
+private:
+  struct ScMemoryTemplateSearchCursorEntry
+  {
+    ScMemoryTemplateSearchCursorPtr m_cursor;
+    std::chrono::steady_clock::time_point m_lastAccessTime;
+  };
+
+  static std::mutex m_mutex;
+  static std::unordered_map<size_t, ScMemoryTemplateSearchCursorEntry> m_cursors;
+  static size_t m_counter;
+
+  static std::condition_variable m_reaperCond;
+  static std::thread m_reaperThread;
+  static sc_bool m_isReaperRun;
+
+  static void ReapIdleCursors();
+
+  //! Removes cursors that are not requested for `kCursorIdleTimeout`, it must be called under lock
+  static void RemoveIdleCursors(std::vector<ScMemoryTemplateSearchCursorPtr> & idleCursors);
+
+  static void CancelCursors(std::vector<ScMemoryTemplateSearchCursorPtr> const & cursors);
+};
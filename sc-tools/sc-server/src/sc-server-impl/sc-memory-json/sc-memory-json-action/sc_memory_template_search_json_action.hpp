@@ -7,13 +7,19 @@
 #pragma once
 
 #include "sc_memory_make_template_json_action.hpp"
+#include "sc_memory_template_search_cursor.hpp"
 
 class ScMemoryTemplateSearchJsonAction : public ScMemoryMakeTemplateJsonAction
 {
 public:
-  ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
-      override
+  ScMemoryJsonPayload Complete(
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
   {
+    if (IsPaged(requestPayload))
+      return CompletePaged(context, requestPayload, errorsPayload);
+
     ScTemplateSearchResult result;
     auto const & pair = GetTemplate(context, requestPayload);
     context->SearchByTemplate(*pair.first, result);
@@ -36,4 +42,78 @@ public:
     delete pair.first;
     return resultPayload;
   }
+
+  void CompleteBinary(
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload,
+      ScMemoryBinaryPayloadWriter & responseWriter) override
+  {
+    if (IsPaged(requestPayload))
+    {
+      responseWriter.WritePayload(CompletePaged(context, requestPayload, errorsPayload));
+      return;
+    }
+
+    ScTemplateSearchResult result;
+    auto const & pair = GetTemplate(context, requestPayload);
+    context->SearchByTemplate(*pair.first, result);
+    delete pair.first;
+
+    // Every sc-address hash takes at most 9 bytes, but usually it takes 5 bytes
+    size_t const itemSize = result.IsEmpty() ? 0 : result[0].Size();
+    responseWriter.Reserve(result.Size() * (itemSize * 5 + 3));
+
+    responseWriter.WriteMapHeader(2);
+    responseWriter.WriteString("aliases");
+    SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
+    responseWriter.WritePayload(result.GetReplacements());
+    SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
+
+    responseWriter.WriteString("addrs");
+    responseWriter.WriteArrayHeader(result.Size());
+    result.ForEach(
+        [&responseWriter](ScTemplateResultItem const & item)
+        {
+          responseWriter.WriteArrayHeader(item.Size());
+          for (ScAddr const & addr : item)
+            responseWriter.WriteUInt(addr.Hash());
+        });
+  }
+
+protected:
+  static sc_bool IsPaged(ScMemoryJsonPayload const & requestPayload)
+  {
+    return requestPayload.is_object() && requestPayload.contains("page_size");
+  }
+
+  /*!
+   * Starts search in cursor and returns the first page of found sc-constructions. Search goes on in background, next
+   * pages are requested by `search_template_page` with returned cursor id.
+   */
+  ScMemoryJsonPayload CompletePaged(
+      ScAgentContext * context,
+      ScMemoryJsonPayload & requestPayload,
+      ScMemoryJsonPayload & errorsPayload)
+  {
+    if (!ScMemoryTemplateSearchCursors::CanAdd(context))
+    {
+      errorsPayload = "Too many template search cursors are open, take their last pages or cancel them";
+      return {};
+    }
+
+    size_t const pageSize = requestPayload["page_size"].get<size_t>();
+    auto const & pair = GetTemplate(context, requestPayload);
+
+    auto const cursor = std::make_shared<ScMemoryTemplateSearchCursor>(context, pair.first, pageSize);
+    cursor->Start();
+
+    ScMemoryJsonPayload page;
+    ScMemoryJsonPayload aliases;
+    if (!cursor->NextPage(page, aliases, errorsPayload) || !errorsPayload.empty())
+      return {{"aliases", aliases}, {"addrs", page}, {"cursor", nullptr}};
+
+    size_t const cursorId = ScMemoryTemplateSearchCursors::Add(cursor);
+    return {{"aliases", aliases}, {"addrs", page}, {"cursor", cursorId}};
+  }
 };
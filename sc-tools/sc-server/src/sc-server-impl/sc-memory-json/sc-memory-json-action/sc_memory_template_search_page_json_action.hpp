@@ -0,0 +1,56 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+#include "sc_memory_template_search_cursor.hpp"
+
+/*!
+ * Returns next page of paginated template search by cursor id `{"cursor": <id>}`, or cancels search if request
+ * payload is `{"cursor": <id>, "cancel": true}`. Cursor is removed when its last page is returned.
+ */
+class ScMemoryTemplateSearchPageJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    if (!requestPayload.is_object() || !requestPayload.contains("cursor")
+        || !requestPayload["cursor"].is_number_unsigned())
+    {
+      errorsPayload = "Template search page request payload must contain cursor id";
+      return {};
+    }
+
+    size_t const cursorId = requestPayload["cursor"].get<size_t>();
+    ScMemoryTemplateSearchCursorPtr const & cursor = ScMemoryTemplateSearchCursors::Get(cursorId, context);
+    if (cursor == nullptr)
+    {
+      errorsPayload = "Template search cursor " + std::to_string(cursorId) + " does not exist";
+      return {};
+    }
+
+    if (requestPayload.contains("cancel") && requestPayload["cancel"].is_boolean()
+        && requestPayload["cancel"].get<bool>())
+    {
+      ScMemoryTemplateSearchCursors::Remove(cursorId);
+      return {{"aliases", ScMemoryJsonPayload::object()}, {"addrs", ScMemoryJsonPayload::array()}, {"cursor", nullptr}};
+    }
+
+    ScMemoryJsonPayload page;
+    ScMemoryJsonPayload aliases;
+    if (!cursor->NextPage(page, aliases, errorsPayload) || !errorsPayload.empty())
+    {
+      ScMemoryTemplateSearchCursors::Remove(cursorId);
+      return {{"aliases", aliases}, {"addrs", page}, {"cursor", nullptr}};
+    }
+
+    return {{"aliases", aliases}, {"addrs", page}, {"cursor", cursorId}};
+  }
+};
@@ -18,9 +18,8 @@ std::unordered_map<std::string, std::string> const
         {"content_change", "sc_event_before_change_link_content"},
 };
 
-ScMemoryJsonEventsHandler::ScMemoryJsonEventsHandler(ScServer * server, ScAgentContext * processCtx)
+ScMemoryJsonEventsHandler::ScMemoryJsonEventsHandler(ScServer * server)
   : ScMemoryJsonHandler(server)
-  , m_context(processCtx)
   , m_manager(ScMemoryJsonEventsManager::GetInstance())
 {
 }
@@ -29,11 +28,39 @@ ScMemoryJsonEventsHandler::~ScMemoryJsonEventsHandler() = default;
 
 ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleRequestPayload(
     ScServerSessionId const & sessionId,
+    ScAgentContext * sessionCtx,
     std::string const &,
-    ScMemoryJsonPayload const & requestPayload,
+    ScMemoryJsonPayload & requestPayload,
     ScMemoryJsonPayload & errorsPayload,
     sc_bool & status,
     sc_bool & isEvent)
+{
+  return HandleEventsRequestPayload(
+      sessionId, sessionCtx, requestPayload, errorsPayload, status, isEvent, ScServerMessageType::text);
+}
+
+void ScMemoryJsonEventsHandler::HandleBinaryRequestPayload(
+    ScServerSessionId const & sessionId,
+    ScAgentContext * sessionCtx,
+    std::string const &,
+    ScMemoryJsonPayload & requestPayload,
+    ScMemoryJsonPayload & errorsPayload,
+    sc_bool & status,
+    sc_bool & isEvent,
+    ScMemoryBinaryPayloadWriter & responseWriter)
+{
+  responseWriter.WritePayload(HandleEventsRequestPayload(
+      sessionId, sessionCtx, requestPayload, errorsPayload, status, isEvent, ScServerMessageType::binary));
+}
+
+ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleEventsRequestPayload(
+    ScServerSessionId const & sessionId,
+    ScAgentContext * sessionCtx,
+    ScMemoryJsonPayload & requestPayload,
+    ScMemoryJsonPayload & errorsPayload,
+    sc_bool & status,
+    sc_bool & isEvent,
+    ScServerMessageType messageType)
 {
   status = SC_FALSE;
   isEvent = SC_FALSE;
@@ -42,7 +69,7 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleRequestPayload(
 
   ScMemoryJsonPayload responsePayload;
   if (requestPayload.find("create") != requestPayload.cend())
-    responsePayload = HandleGenerate(sessionId, requestPayload["create"], errorsPayload);
+    responsePayload = HandleGenerate(sessionId, sessionCtx, requestPayload["create"], errorsPayload, messageType);
   else if (requestPayload.find("delete") != requestPayload.cend())
     responsePayload = HandleDelete(sessionId, requestPayload["delete"], errorsPayload);
   else
@@ -55,11 +82,17 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleRequestPayload(
 
 ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
     ScServerSessionId const & sessionId,
+    ScAgentContext * sessionCtx,
     ScMemoryJsonPayload const & message,
-    ScMemoryJsonPayload & errorsPayload)
+    ScMemoryJsonPayload & errorsPayload,
+    ScServerMessageType messageType)
 {
-  auto const & onEmitEvent =
-      [](ScServer * server, size_t id, ScServerSessionId const & handle, ScElementaryEvent const & event)
+  // Sc-events are sent in the same encoding as request that has subscribed to them
+  auto const & onEmitEvent = [](ScServer * server,
+                                size_t id,
+                                ScServerSessionId const & handle,
+                                ScServerMessageType type,
+                                ScElementaryEvent const & event)
   {
     auto const & [sourceAddr, connectorAddr, targetAddr] = event.GetTriple();
 
@@ -70,10 +103,10 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
 
     ScMemoryJsonPayload const & responseTextJson =
         ScMemoryJsonHandler::FormResponseMessage(id, isEvent, status, errorsPayload, responsePayload);
-    std::string const responseText = responseTextJson.dump();
+    std::string const responseText = ScMemoryJsonHandler::EncodeMessage(responseTextJson, type);
 
     if (server != nullptr)
-      server->OnEvent(handle, responseText);
+      server->OnEvent(handle, responseText, type);
   };
 
   ScMemoryJsonPayload responsePayload;
@@ -86,10 +119,12 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
     if (it != m_deprecatedEventsIdtfsToSystemEventsIdtfs.cend())
       eventClass = it->second;
 
-    ScAddr const & eventClassAddr = m_context->SearchElementBySystemIdentifier(eventClass);
-    auto const & subscription = m_context->CreateElementaryEventSubscription(
-        eventClassAddr, subscriptionElementAddr, bind(onEmitEvent, m_server, m_manager->Next(), sessionId, ::_1));
-    responsePayload.push_back(m_manager->Add(subscription));
+    ScAddr const & eventClassAddr = sessionCtx->SearchElementBySystemIdentifier(eventClass);
+    size_t const eventId = m_manager->Next();
+    auto const & subscription = sessionCtx->CreateElementaryEventSubscription(
+        eventClassAddr, subscriptionElementAddr, bind(onEmitEvent, m_server, eventId, sessionId, messageType, ::_1));
+    m_manager->Add(eventId, subscription);
+    responsePayload.push_back(eventId);
   }
 
   return responsePayload;
@@ -28,28 +28,49 @@ public:
       ScMemoryJsonEventsManager *,
       ScServer *,
       ScServerSessionId const &)>;
-  explicit ScMemoryJsonEventsHandler(ScServer * server, ScAgentContext * processCtx);
+  explicit ScMemoryJsonEventsHandler(ScServer * server);
 
   ~ScMemoryJsonEventsHandler() override;
 
 private:
-  ScAgentContext * m_context;
   ScMemoryJsonEventsManager * m_manager;
 
   static std::unordered_map<std::string, std::string> const m_deprecatedEventsIdtfsToSystemEventsIdtfs;
 
   ScMemoryJsonPayload HandleRequestPayload(
       ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
       std::string const & requestType,
-      ScMemoryJsonPayload const & requestPayload,
+      ScMemoryJsonPayload & requestPayload,
       ScMemoryJsonPayload & errorsPayload,
       sc_bool & status,
       sc_bool & isEvent) override;
 
+  void HandleBinaryRequestPayload(
+      ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
+      std::string const & requestType,
+      ScMemoryJsonPayload & requestPayload,
+      ScMemoryJsonPayload & errorsPayload,
+      sc_bool & status,
+      sc_bool & isEvent,
+      ScMemoryBinaryPayloadWriter & responseWriter) override;
+
+  ScMemoryJsonPayload HandleEventsRequestPayload(
+      ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
+      ScMemoryJsonPayload & requestPayload,
+      ScMemoryJsonPayload & errorsPayload,
+      sc_bool & status,
+      sc_bool & isEvent,
+      ScServerMessageType messageType);
+
   ScMemoryJsonPayload HandleGenerate(
       ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
       ScMemoryJsonPayload const & message,
-      ScMemoryJsonPayload & errorsPayload);
+      ScMemoryJsonPayload & errorsPayload,
+      ScServerMessageType messageType);
 
   ScMemoryJsonPayload HandleDelete(
       ScServerSessionId const & sessionId,
@@ -7,3 +7,4 @@
 #include "sc_memory_json_events_manager.hpp"
 
 ScMemoryJsonEventsManager * ScMemoryJsonEventsManager::m_instance = nullptr;
+std::mutex ScMemoryJsonEventsManager::m_instanceMutex;
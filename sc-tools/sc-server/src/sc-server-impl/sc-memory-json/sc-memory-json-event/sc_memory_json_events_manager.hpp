@@ -7,6 +7,7 @@
 #pragma once
 
 #include <algorithm>
+#include <mutex>
 
 #include <sc-memory/sc_event_subscription.hpp>
 
@@ -15,25 +16,28 @@ class ScMemoryJsonEventsManager
 public:
   static ScMemoryJsonEventsManager * GetInstance()
   {
+    std::lock_guard<std::mutex> lock(m_instanceMutex);
     if (m_instance == nullptr)
       m_instance = new ScMemoryJsonEventsManager();
 
     return m_instance;
   }
 
-  size_t Add(ScEventSubscriptionPtr const & event)
+  void Add(size_t index, ScEventSubscriptionPtr const & event)
   {
-    m_events.insert({counter, event});
-    return counter++;
+    std::lock_guard<std::mutex> lock(m_eventsMutex);
+    m_events.insert({index, event});
   }
 
-  size_t Next() const
+  size_t Next()
   {
-    return counter;
+    std::lock_guard<std::mutex> lock(m_eventsMutex);
+    return counter++;
   }
 
   ScEventSubscriptionPtr Remove(size_t index)
   {
+    std::lock_guard<std::mutex> lock(m_eventsMutex);
     auto const & it = m_events.find(index);
     if (it != m_events.end())
     {
@@ -55,6 +59,9 @@ public:
 
 private:
   static ScMemoryJsonEventsManager * m_instance;
+  static std::mutex m_instanceMutex;
+
+  std::mutex m_eventsMutex;
   std::unordered_map<size_t, ScEventSubscriptionPtr> m_events;
   size_t counter = 0;
 
@@ -0,0 +1,141 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+#include "sc_memory_json_payload.hpp"
+
+/*!
+ * Writes values encoded in MessagePack directly into buffer. It is used by sc-server to encode responses for binary
+ * messages, large response payloads are written item by item without building their JSON documents.
+ */
+class ScMemoryBinaryPayloadWriter
+{
+public:
+  explicit ScMemoryBinaryPayloadWriter(std::string & buffer)
+    : m_buffer(buffer)
+  {
+  }
+
+  void Reserve(size_t size)
+  {
+    m_buffer.reserve(m_buffer.size() + size);
+  }
+
+  void WriteNil()
+  {
+    Put(0xc0);
+  }
+
+  void WriteBool(bool value)
+  {
+    Put(value ? 0xc3 : 0xc2);
+  }
+
+  void WriteUInt(uint64_t value)
+  {
+    if (value < 0x80)
+      Put(static_cast<uint8_t>(value));
+    else if (value <= UINT8_MAX)
+    {
+      Put(0xcc);
+      PutBigEndian(value, 1);
+    }
+    else if (value <= UINT16_MAX)
+    {
+      Put(0xcd);
+      PutBigEndian(value, 2);
+    }
+    else if (value <= UINT32_MAX)
+    {
+      Put(0xce);
+      PutBigEndian(value, 4);
+    }
+    else
+    {
+      Put(0xcf);
+      PutBigEndian(value, 8);
+    }
+  }
+
+  void WriteString(std::string const & value)
+  {
+    size_t const size = value.size();
+    if (size < 32)
+      Put(static_cast<uint8_t>(0xa0 | size));
+    else if (size <= UINT8_MAX)
+    {
+      Put(0xd9);
+      PutBigEndian(size, 1);
+    }
+    else if (size <= UINT16_MAX)
+    {
+      Put(0xda);
+      PutBigEndian(size, 2);
+    }
+    else
+    {
+      Put(0xdb);
+      PutBigEndian(size, 4);
+    }
+    m_buffer.append(value);
+  }
+
+  void WriteArrayHeader(size_t size)
+  {
+    WriteContainerHeader(size, 0x90, 0xdc, 0xdd);
+  }
+
+  void WriteMapHeader(size_t size)
+  {
+    WriteContainerHeader(size, 0x80, 0xde, 0xdf);
+  }
+
+  //! Writes JSON document encoded in MessagePack
+  void WritePayload(ScMemoryJsonPayload const & payload)
+  {
+    ScMemoryJsonPayload::to_msgpack(payload, m_buffer);
+  }
+
+  //! Writes value that has been already encoded in MessagePack
+  void WriteEncoded(std::string const & encodedValue)
+  {
+    m_buffer.append(encodedValue);
+  }
+
+private:
+  std::string & m_buffer;
+
+  void Put(uint8_t byte)
+  {
+    m_buffer.push_back(static_cast<char>(byte));
+  }
+
+  void PutBigEndian(uint64_t value, size_t bytesCount)
+  {
+    for (size_t i = bytesCount; i > 0; --i)
+      Put(static_cast<uint8_t>(value >> ((i - 1) * 8)));
+  }
+
+  void WriteContainerHeader(size_t size, uint8_t fixPrefix, uint8_t prefix16, uint8_t prefix32)
+  {
+    if (size < 16)
+      Put(static_cast<uint8_t>(fixPrefix | size));
+    else if (size <= UINT16_MAX)
+    {
+      Put(prefix16);
+      PutBigEndian(size, 2);
+    }
+    else
+    {
+      Put(prefix32);
+      PutBigEndian(size, 4);
+    }
+  }
+};
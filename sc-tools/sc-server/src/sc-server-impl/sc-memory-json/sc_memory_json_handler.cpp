@@ -6,58 +6,59 @@
 
 #include "sc_memory_json_handler.hpp"
 
-std::string ScMemoryJsonHandler::Handle(ScServerSessionId const & sessionId, std::string const & requestMessage)
+std::string ScMemoryJsonHandler::Handle(
+    ScServerSessionId const & sessionId,
+    ScAgentContext * sessionCtx,
+    ScMemoryJsonPayload & requestMessage,
+    ScServerMessageType messageType)
 {
-  std::vector<ScMemoryJsonPayload> requestData = ParseRequestMessage(requestMessage);
-  if (requestData.empty())
-    return ScMemoryJsonPayload("Invalid request message").dump();
+  if (!IsRequestMessageValid(requestMessage))
+    return EncodeMessage(ScMemoryJsonPayload("Invalid request message"), messageType);
 
-  std::string const & requestType = requestData.at(0).get<std::string>();
-  ScMemoryJsonPayload const & requestPayload = requestData.at(1);
-  size_t const & requestId = requestData.at(2).get<size_t>();
+  std::string const & requestType = requestMessage["type"].get_ref<std::string const &>();
+  ScMemoryJsonPayload & requestPayload = requestMessage["payload"];
+  size_t const requestId = requestMessage["id"].get<size_t>();
 
-  return ResponseRequestMessage(sessionId, requestId, requestType, requestPayload).dump();
+  return ResponseRequestMessage(sessionId, sessionCtx, requestId, requestType, requestPayload, messageType);
 }
 
-std::vector<ScMemoryJsonPayload> ScMemoryJsonHandler::ParseRequestMessage(std::string const & requestMessage)
+sc_bool ScMemoryJsonHandler::IsRequestMessageValid(ScMemoryJsonPayload const & requestMessage)
 {
-  std::vector<ScMemoryJsonPayload> requestData;
-
-  ScMemoryJsonPayload const & messageJson = JsonifyRequestMessage(requestMessage);
-  if (messageJson.is_null())
-    return requestData;
-
-  if (!messageJson.contains("payload"))
-    return requestData;
-
-  if (!messageJson.contains("id"))
-    return requestData;
+  if (!requestMessage.is_object())
+    return SC_FALSE;
 
-  requestData = {messageJson["type"], messageJson["payload"], messageJson["id"]};
+  auto const & typeIt = requestMessage.find("type");
+  if (typeIt == requestMessage.cend() || !typeIt->is_string())
+    return SC_FALSE;
 
-  return requestData;
-}
-
-ScMemoryJsonPayload ScMemoryJsonHandler::JsonifyRequestMessage(std::string const & requestMessage)
-{
-  return ScMemoryJsonPayload::accept(requestMessage) ? ScMemoryJsonPayload::parse(requestMessage)
-                                                     : ScMemoryJsonPayload();
+  return requestMessage.contains("payload") && requestMessage.contains("id");
 }
 
-ScMemoryJsonPayload ScMemoryJsonHandler::ResponseRequestMessage(
+std::string ScMemoryJsonHandler::ResponseRequestMessage(
     ScServerSessionId const & sessionId,
+    ScAgentContext * sessionCtx,
     size_t const requestId,
     std::string const & requestType,
-    ScMemoryJsonPayload const & requestPayload)
+    ScMemoryJsonPayload & requestPayload,
+    ScServerMessageType messageType)
 {
   sc_bool status = SC_FALSE;
 
   sc_bool isEvent = SC_FALSE;
+  sc_bool isHandled = SC_FALSE;
   ScMemoryJsonPayload responsePayload;
+  std::string encodedResponsePayload;
+  ScMemoryBinaryPayloadWriter responseWriter(encodedResponsePayload);
   ScMemoryJsonPayload errorsPayload = ScMemoryJsonPayload::array({});
   try
   {
-    responsePayload = HandleRequestPayload(sessionId, requestType, requestPayload, errorsPayload, status, isEvent);
+    if (messageType == ScServerMessageType::binary)
+      HandleBinaryRequestPayload(
+          sessionId, sessionCtx, requestType, requestPayload, errorsPayload, status, isEvent, responseWriter);
+    else
+      responsePayload =
+          HandleRequestPayload(sessionId, sessionCtx, requestType, requestPayload, errorsPayload, status, isEvent);
+    isHandled = SC_TRUE;
   }
   catch (ScServerException const & e)
   {
@@ -81,7 +82,30 @@ ScMemoryJsonPayload ScMemoryJsonHandler::ResponseRequestMessage(
     m_server->LogMessage(ScServerErrorLevel::error, errorsPayload.get<std::string>());
   }
 
-  return FormResponseMessage(requestId, isEvent, status, errorsPayload, responsePayload);
+  if (messageType != ScServerMessageType::binary)
+    return FormResponseMessage(requestId, isEvent, status, errorsPayload, responsePayload).dump();
+
+  // Response payload may be written partially if request handling has been interrupted
+  if (isHandled == SC_FALSE)
+    encodedResponsePayload.clear();
+  if (encodedResponsePayload.empty())
+    responseWriter.WriteNil();
+
+  return FormBinaryResponseMessage(requestId, isEvent, status, errorsPayload, encodedResponsePayload);
+}
+
+void ScMemoryJsonHandler::HandleBinaryRequestPayload(
+    ScServerSessionId const & sessionId,
+    ScAgentContext * sessionCtx,
+    std::string const & requestType,
+    ScMemoryJsonPayload & requestPayload,
+    ScMemoryJsonPayload & errorsPayload,
+    sc_bool & status,
+    sc_bool & isEvent,
+    ScMemoryBinaryPayloadWriter & responseWriter)
+{
+  responseWriter.WritePayload(
+      HandleRequestPayload(sessionId, sessionCtx, requestType, requestPayload, errorsPayload, status, isEvent));
 }
 
 ScMemoryJsonPayload ScMemoryJsonHandler::FormResponseMessage(
@@ -98,3 +122,39 @@ ScMemoryJsonPayload ScMemoryJsonHandler::FormResponseMessage(
        {"errors", errorsPayload},
        {"payload", responsePayload}});
 }
+
+std::string ScMemoryJsonHandler::FormBinaryResponseMessage(
+    size_t requestId,
+    sc_bool event,
+    sc_bool status,
+    ScMemoryJsonPayload const & errorsPayload,
+    std::string const & encodedResponsePayload)
+{
+  std::string message;
+  ScMemoryBinaryPayloadWriter writer(message);
+  writer.Reserve(encodedResponsePayload.size() + 64);
+
+  writer.WriteMapHeader(5);
+  writer.WriteString("id");
+  writer.WriteUInt(requestId);
+  writer.WriteString("event");
+  writer.WriteBool(event);
+  writer.WriteString("status");
+  writer.WriteBool(status);
+  writer.WriteString("errors");
+  writer.WritePayload(errorsPayload);
+  writer.WriteString("payload");
+  writer.WriteEncoded(encodedResponsePayload);
+
+  return message;
+}
+
+std::string ScMemoryJsonHandler::EncodeMessage(ScMemoryJsonPayload const & message, ScServerMessageType messageType)
+{
+  if (messageType != ScServerMessageType::binary)
+    return message.dump();
+
+  std::string encodedMessage;
+  ScMemoryJsonPayload::to_msgpack(message, encodedMessage);
+  return encodedMessage;
+}
@@ -9,10 +9,13 @@
 #include <string>
 
 #include "sc_memory_json_payload.hpp"
+#include "sc_memory_binary_payload_writer.hpp"
 
 #include "sc-server-impl/sc_server_defines.hpp"
 #include "sc-server-impl/sc_server.hpp"
 
+class ScAgentContext;
+
 class ScMemoryJsonHandler
 {
 public:
@@ -23,29 +26,51 @@ public:
 
   virtual ~ScMemoryJsonHandler() = default;
 
-  virtual std::string Handle(ScServerSessionId const & sessionId, std::string const & requestMessage);
+  /*!
+   * Handles parsed request message. Payload of request message is moved into request handler, so request message
+   * can't be used after that.
+   * @param messageType A type of websocket message. Response for binary message is encoded in MessagePack, response
+   * for text message is encoded in JSON.
+   * @returns Encoded response message.
+   */
+  virtual std::string Handle(
+      ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
+      ScMemoryJsonPayload & requestMessage,
+      ScServerMessageType messageType);
 
 protected:
   ScServer * m_server;
 
-  std::vector<ScMemoryJsonPayload> ParseRequestMessage(std::string const & requestMessage);
+  static sc_bool IsRequestMessageValid(ScMemoryJsonPayload const & requestMessage);
 
-  ScMemoryJsonPayload JsonifyRequestMessage(std::string const & requestMessage);
-
-  virtual ScMemoryJsonPayload ResponseRequestMessage(
+  virtual std::string ResponseRequestMessage(
       ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
       size_t requestId,
       std::string const & requestType,
-      ScMemoryJsonPayload const & requestPayload);
+      ScMemoryJsonPayload & requestPayload,
+      ScServerMessageType messageType);
 
   virtual ScMemoryJsonPayload HandleRequestPayload(
       ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
       std::string const & requestType,
-      ScMemoryJsonPayload const & requestPayload,
+      ScMemoryJsonPayload & requestPayload,
       ScMemoryJsonPayload & errorsPayload,
       sc_bool & status,
       sc_bool & isEvent) = 0;
 
+  virtual void HandleBinaryRequestPayload(
+      ScServerSessionId const & sessionId,
+      ScAgentContext * sessionCtx,
+      std::string const & requestType,
+      ScMemoryJsonPayload & requestPayload,
+      ScMemoryJsonPayload & errorsPayload,
+      sc_bool & status,
+      sc_bool & isEvent,
+      ScMemoryBinaryPayloadWriter & responseWriter);
+
 public:
   static ScMemoryJsonPayload FormResponseMessage(
       size_t requestId,
@@ -53,4 +78,13 @@ public:
       sc_bool status,
       ScMemoryJsonPayload const & errorsPayload,
       ScMemoryJsonPayload const & responsePayload);
+
+  static std::string FormBinaryResponseMessage(
+      size_t requestId,
+      sc_bool event,
+      sc_bool status,
+      ScMemoryJsonPayload const & errorsPayload,
+      std::string const & encodedResponsePayload);
+
+  static std::string EncodeMessage(ScMemoryJsonPayload const & message, ScServerMessageType messageType);
 };
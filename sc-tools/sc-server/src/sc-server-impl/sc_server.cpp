@@ -142,6 +142,13 @@ void ScServer::Send(ScServerSessionId const & sessionId, std::string const & mes
   m_instance->send(sessionId, message, type);
 }
 
+size_t ScServer::GetSessionBufferedAmount(ScServerSessionId const & sessionId)
+{
+  websocketpp::lib::error_code code;
+  ScServerCore::connection_ptr const connection = m_instance->get_con_from_hdl(sessionId, code);
+  return code ? 0 : connection->get_buffered_amount();
+}
+
 void ScServer::SetChannels(ScServerLogLevel channels)
 {
   m_instance->set_error_channels(channels);
@@ -178,6 +185,11 @@ void ScServer::LogMessage(ScServerLogLevel channel, std::string const & message)
   m_instance->get_elog().write(channel, message);
 }
 
+sc_bool ScServer::IsLogLevelEnabled(ScServerLogLevel channel)
+{
+  return m_instance->get_elog().dynamic_test(channel);
+}
+
 void ScServer::CloseConnection(
     ScServerSessionId const & sessionId,
     ScServerCloseCode const code,
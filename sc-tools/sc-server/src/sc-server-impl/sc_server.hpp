@@ -49,13 +49,18 @@ public:
 
   void Send(ScServerSessionId const & sessionId, std::string const & message, ScServerMessageType type);
 
+  //! Gets size of messages that have been sent to session, but haven't been written to its connection yet
+  size_t GetSessionBufferedAmount(ScServerSessionId const & sessionId);
+
   void ResetLogger(ScServerLogger * logger = nullptr);
 
   void LogMessage(ScServerLogLevel channel, std::string const & message);
 
+  sc_bool IsLogLevelEnabled(ScServerLogLevel channel);
+
   void CloseConnection(ScServerSessionId const & sessionId, ScServerCloseCode code, std::string const & reason);
 
-  virtual void OnEvent(ScServerSessionId const & sessionId, std::string const & msg) = 0;
+  virtual void OnEvent(ScServerSessionId const & sessionId, std::string const & msg, ScServerMessageType type) = 0;
 
   virtual ~ScServer();
 
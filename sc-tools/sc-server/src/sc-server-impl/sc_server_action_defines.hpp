@@ -10,4 +10,4 @@
 #include "sc_server_message_action.hpp"
 #include "sc_server_connect_action.hpp"
 #include "sc_server_disconnect_action.hpp"
-#include "sc_server_event_callback_action.hpp"
+#include "sc_server_events_action.hpp"
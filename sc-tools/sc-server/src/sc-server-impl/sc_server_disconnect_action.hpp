@@ -11,6 +11,8 @@
 #include "sc_server_action.hpp"
 #include "sc_server.hpp"
 
+#include "sc-memory-json/sc-memory-json-action/sc_memory_template_search_cursor.hpp"
+
 class ScServerDisconnectAction : public ScServerAction
 {
 public:
@@ -22,7 +24,9 @@ public:
 
   void Emit() override
   {
-    delete m_server->PopSessionContext(m_sessionId);
+    ScAgentContext * context = m_server->PopSessionContext(m_sessionId);
+    ScMemoryTemplateSearchCursors::RemoveSessionCursors(context);
+    delete context;
   }
 
   ~ScServerDisconnectAction() override = default;
@@ -0,0 +1,35 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <utility>
+
+#include "sc_server_action.hpp"
+#include "sc_server_impl.hpp"
+
+//! Sends buffered sc-events messages of session after action of this session that is being emitted
+class ScServerEventsAction : public ScServerAction
+{
+public:
+  ScServerEventsAction(ScServerImpl * server, ScServerSessionId sessionId, ScServerSessionEvents sessionEvents)
+    : ScServerAction(std::move(sessionId))
+    , m_server(server)
+    , m_sessionEvents(std::move(sessionEvents))
+  {
+  }
+
+  void Emit() override
+  {
+    m_server->EmitSessionEvents(m_sessionId, m_sessionEvents);
+  }
+
+  ~ScServerEventsAction() override = default;
+
+protected:
+  ScServerImpl * m_server;
+  ScServerSessionEvents m_sessionEvents;
+};
@@ -6,19 +6,46 @@
 
 #include "sc_server_impl.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include "sc_server_action_defines.hpp"
+#include "sc-memory-json/sc_memory_binary_payload_writer.hpp"
 
 extern "C"
 {
 #include <sc-store/sc_storage.h>
 }
 
-ScServerImpl::ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions)
+ScServerImpl::ScServerImpl(
+    std::string const & host,
+    ScServerPort port,
+    sc_bool parallelActions,
+    size_t actionsThreadsCount,
+    size_t eventsBatchInterval,
+    size_t sessionEventsLimit)
   : ScServer(host, port)
-  , m_parallelActions(parallelActions)
+  , m_actionsThreadsCount(1)
   , m_actionsRun(SC_TRUE)
-  , m_actions(new ScServerActions())
+  , m_actionsCount(0)
+  , m_sessionsActions(new ScServerSessionsActions())
+  , m_readySessions(new ScServerReadySessions())
+  , m_actionsHandler(new ScMemoryJsonActionsHandler(this))
+  , m_eventsHandler(new ScMemoryJsonEventsHandler(this))
+  , m_eventsBatchInterval(eventsBatchInterval)
+  , m_sessionEventsLimit(sessionEventsLimit)
+  , m_eventsRun(SC_TRUE)
+  , m_eventsCount(0)
+  , m_sessionsEvents(new ScServerSessionsEvents())
+  , m_sessionsPendingEventsCounts(new ScServerSessionsEventsCounts())
 {
+  if (parallelActions == SC_TRUE)
+  {
+    m_actionsThreadsCount = actionsThreadsCount;
+    if (m_actionsThreadsCount == 0)
+      m_actionsThreadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
   ScMemoryJsonActionsHandler::InitializeActionClasses();
 }
 
@@ -31,15 +58,50 @@ void ScServerImpl::Initialize()
 
 void ScServerImpl::AfterInitialize()
 {
-  while (m_actions->empty() == SC_FALSE)
-    ;
+  while (m_actionsCount != 0)
+    std::this_thread::yield();
+
+  // Remaining sc-events messages are pushed into sessions actions queues before events thread is stopped
+  {
+    ScServerLock eventsLock(m_eventsMutex);
+    m_eventsRun = SC_FALSE;
+  }
+  m_eventsCond.notify_all();
+
+  while (m_actionsCount != 0 || m_eventsCount != 0)
+    std::this_thread::yield();
 
-  m_actionsRun = SC_FALSE;
-  m_actionCond.notify_one();
+  {
+    ScServerLock actionLock(m_actionMutex);
+    m_actionsRun = SC_FALSE;
+  }
+  m_actionCond.notify_all();
 }
 
 void ScServerImpl::EmitActions()
 {
+  LogMessage(ScServerErrorLevel::info, "Actions threads count: " + std::to_string(m_actionsThreadsCount));
+
+  std::thread eventsThread(&ScServerImpl::EmitSessionsEvents, this);
+
+  std::vector<std::thread> actionsThreads;
+  actionsThreads.reserve(m_actionsThreadsCount - 1);
+  for (size_t i = 1; i < m_actionsThreadsCount; ++i)
+    actionsThreads.emplace_back(&ScServerImpl::EmitSessionsActions, this);
+
+  EmitSessionsActions();
+
+  for (auto & thread : actionsThreads)
+    thread.join();
+
+  eventsThread.join();
+}
+
+void ScServerImpl::EmitSessionsActions()
+{
+  // TODO(NikitaZotov): sc-server should not know about it
+  sc_storage_start_new_process();
+
   while (m_actionsRun == SC_TRUE)
   {
     ScServerUniqueLock actionLock(m_actionMutex);
@@ -48,14 +110,22 @@ void ScServerImpl::EmitActions()
         actionLock,
         [this]
         {
-          return !m_actions->empty() || !m_actionsRun;
+          return !m_readySessions->empty() || !m_actionsRun;
         });
 
     if (m_actionsRun == SC_FALSE)
       break;
 
-    ScServerAction * action = m_actions->front();
-    m_actions->pop();
+    // Session is removed from ready sessions until its action is emitted, so no other thread takes its next action
+    ScServerSessionId const sessionId = m_readySessions->front();
+    m_readySessions->pop();
+
+    // Sc-events messages of session are sent before actions of its requests that have not been emitted yet
+    auto const sessionIt = m_sessionsActions->find(sessionId);
+    ScServerActions & actions =
+        sessionIt->second.m_eventsActions.empty() ? sessionIt->second.m_actions : sessionIt->second.m_eventsActions;
+    ScServerAction * action = actions.front();
+    actions.pop();
 
     actionLock.unlock();
 
@@ -68,79 +138,290 @@ void ScServerImpl::EmitActions()
       LogMessage(ScServerErrorLevel::error, e.what());
     }
     delete action;
+
+    actionLock.lock();
+    sc_bool const hasSessionActions =
+        !sessionIt->second.m_eventsActions.empty() || !sessionIt->second.m_actions.empty();
+    if (hasSessionActions)
+      m_readySessions->push(sessionId);
+    else
+      m_sessionsActions->erase(sessionIt);
+    actionLock.unlock();
+
+    if (hasSessionActions)
+      m_actionCond.notify_one();
+
+    --m_actionsCount;
   }
-}
 
-sc_bool ScServerImpl::IsWorkable()
-{
-  return m_actions->empty() == SC_FALSE;
+  sc_storage_end_new_process();
 }
 
-void ScServerImpl::OnOpen(ScServerSessionId const & sessionId)
+void ScServerImpl::PushAction(ScServerSessionId const & sessionId, ScServerAction * action, sc_bool isEventsAction)
 {
-  auto * action = new ScServerConnectAction(this, sessionId);
+  sc_bool isNewSession;
   {
-    ScServerLock connectionLock(m_connectionMutex);
     ScServerLock actionLock(m_actionMutex);
-    m_actions->push(action);
+    ++m_actionsCount;
+
+    auto const & [sessionIt, isInserted] = m_sessionsActions->try_emplace(sessionId);
+    if (isEventsAction)
+      sessionIt->second.m_eventsActions.push(action);
+    else
+      sessionIt->second.m_actions.push(action);
+
+    // Session that has actions is already ready or being processed by some thread
+    isNewSession = isInserted;
+    if (isNewSession)
+      m_readySessions->push(sessionId);
   }
-  m_actionCond.notify_one();
+
+  if (isNewSession)
+    m_actionCond.notify_one();
 }
 
-void ScServerImpl::OnClose(ScServerSessionId const & sessionId)
+void ScServerImpl::EmitSessionsEvents()
 {
-  auto * action = new ScServerDisconnectAction(this, sessionId);
+  ScServerUniqueLock eventsLock(m_eventsMutex);
+  while (true)
   {
-    ScServerLock connectionLock(m_connectionMutex);
-    ScServerLock actionLock(m_actionMutex);
-    m_actions->push(action);
+    m_eventsCond.wait(
+        eventsLock,
+        [this]
+        {
+          return !m_sessionsEvents->empty() || !m_eventsRun;
+        });
+
+    if (m_sessionsEvents->empty())
+      break;
+
+    // Events messages that are emitted during interval are collected to be sent in one frame
+    if (m_eventsBatchInterval.count() != 0)
+    {
+      m_eventsCond.wait_for(
+          eventsLock,
+          m_eventsBatchInterval,
+          [this]
+          {
+            return !m_eventsRun;
+          });
+    }
+
+    // Sc-events messages of congested sessions are kept in buffer until their clients read sent messages, remaining
+    // sc-events messages are sent before events thread is stopped
+    ScServerSessionsEvents sessionsEvents;
+    for (auto it = m_sessionsEvents->begin(); it != m_sessionsEvents->end();)
+    {
+      if (m_eventsRun == SC_TRUE && IsSessionCongested(it->first))
+      {
+        ++it;
+        continue;
+      }
+
+      sessionsEvents.insert(m_sessionsEvents->extract(it++));
+    }
+
+    // Sc-events messages of congested sessions are checked again after interval or when new ones are buffered
+    if (sessionsEvents.empty())
+    {
+      size_t const eventsCount = m_eventsCount;
+      m_eventsCond.wait_for(
+          eventsLock,
+          std::chrono::milliseconds(kCongestedSessionsRetryInterval),
+          [this, eventsCount]
+          {
+            return !m_eventsRun || m_eventsCount != eventsCount;
+          });
+      continue;
+    }
+
+    eventsLock.unlock();
+
+    // Sc-events messages are sent by actions threads after action of session that is being emitted
+    for (auto & [sessionId, sessionEvents] : sessionsEvents)
+      PushAction(sessionId, new ScServerEventsAction(this, sessionId, std::move(sessionEvents)), SC_TRUE);
+
+    eventsLock.lock();
   }
-  m_actionCond.notify_one();
 }
 
-void ScServerImpl::OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg)
+sc_bool ScServerImpl::IsSessionCongested(ScServerSessionId const & sessionId)
 {
-  ScServerLock connectionLock(m_connectionMutex);
-  if (!IsSessionValid(sessionId))
-    return;
+  return GetSessionBufferedAmount(sessionId) > kMaxSessionBufferedAmount;
+}
 
-  auto * action = new ScServerMessageAction(this, sessionId, msg);
+void ScServerImpl::ReleaseSessionPendingEvents(ScServerSessionId const & sessionId, size_t eventsCount)
+{
+  if (eventsCount == 0)
+    return;
 
-  if (m_parallelActions == SC_FALSE)
   {
+    ScServerLock eventsLock(m_eventsMutex);
+    auto const it = m_sessionsPendingEventsCounts->find(sessionId);
+    if (it != m_sessionsPendingEventsCounts->cend())
     {
-      ScServerLock actionLock(m_actionMutex);
-      m_actions->push(action);
+      it->second -= std::min(it->second, eventsCount);
+      if (it->second == 0)
+        m_sessionsPendingEventsCounts->erase(it);
     }
-    m_actionCond.notify_one();
+  }
+
+  m_eventsCount -= eventsCount;
+}
+
+void ScServerImpl::EmitSessionEvents(ScServerSessionId const & sessionId, ScServerSessionEvents & sessionEvents)
+{
+  size_t const sessionEventsCount = sessionEvents.m_textMessages.size() + sessionEvents.m_binaryMessages.size();
+  if (IsSessionValid(sessionId))
+    SendSessionEvents(sessionId, sessionEvents);
+  ReleaseSessionPendingEvents(sessionId, sessionEventsCount);
+}
+
+void ScServerImpl::SendSessionEvents(ScServerSessionId const & sessionId, ScServerSessionEvents & sessionEvents)
+{
+  if (sessionEvents.m_droppedCount != 0)
+  {
+    LogMessage(
+        ScServerErrorLevel::warning,
+        std::to_string(sessionEvents.m_droppedCount)
+            + " sc-events messages have been dropped, because session events buffer is full");
+  }
+
+  try
+  {
+    SendEventsMessages(sessionId, sessionEvents.m_textMessages, ScServerMessageType::text);
+    SendEventsMessages(sessionId, sessionEvents.m_binaryMessages, ScServerMessageType::binary);
+  }
+  catch (std::exception const & e)
+  {
+    LogMessage(ScServerErrorLevel::error, e.what());
+  }
+}
+
+void ScServerImpl::SendEventsMessages(
+    ScServerSessionId const & sessionId,
+    std::vector<std::string> const & messages,
+    ScServerMessageType type)
+{
+  if (messages.empty())
+    return;
+
+  if (m_eventsBatchInterval.count() == 0)
+  {
+    for (std::string const & message : messages)
+      Send(sessionId, message, type);
+    return;
+  }
+
+  // Messages have been already encoded, so they are joined into array without decoding
+  std::string frame;
+  if (type == ScServerMessageType::binary)
+  {
+    ScMemoryBinaryPayloadWriter writer(frame);
+    writer.WriteArrayHeader(messages.size());
+    for (std::string const & message : messages)
+      writer.WriteEncoded(message);
   }
   else
   {
-    // TODO(NikitaZotov): sc-server should not know about it
-    sc_storage_start_new_process();
+    frame.push_back('[');
+    for (size_t i = 0; i < messages.size(); ++i)
+    {
+      if (i != 0)
+        frame.push_back(',');
+      frame.append(messages[i]);
+    }
+    frame.push_back(']');
+  }
 
-    action->Emit();
-    delete action;
+  Send(sessionId, frame, type);
+}
+
+sc_bool ScServerImpl::IsWorkable()
+{
+  return m_actionsCount != 0 || m_eventsCount != 0;
+}
+
+void ScServerImpl::OnOpen(ScServerSessionId const & sessionId)
+{
+  PushAction(sessionId, new ScServerConnectAction(this, sessionId));
+}
 
-    sc_storage_end_new_process();
+void ScServerImpl::OnClose(ScServerSessionId const & sessionId)
+{
+  // Sc-events messages kept for closed session can't be sent
+  size_t sessionEventsCount = 0;
+  {
+    ScServerLock eventsLock(m_eventsMutex);
+    auto const it = m_sessionsEvents->find(sessionId);
+    if (it != m_sessionsEvents->cend())
+    {
+      sessionEventsCount = it->second.m_textMessages.size() + it->second.m_binaryMessages.size();
+      m_sessionsEvents->erase(it);
+    }
   }
+  ReleaseSessionPendingEvents(sessionId, sessionEventsCount);
+
+  PushAction(sessionId, new ScServerDisconnectAction(this, sessionId));
+}
+
+void ScServerImpl::OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg)
+{
+  PushAction(sessionId, new ScServerMessageAction(this, m_actionsHandler, m_eventsHandler, sessionId, msg));
 }
 
-void ScServerImpl::OnEvent(ScServerSessionId const & sessionId, std::string const & msg)
+void ScServerImpl::OnEvent(ScServerSessionId const & sessionId, std::string const & msg, ScServerMessageType type)
 {
-  ScServerLock connectionLock(m_connectionMutex);
   if (!IsSessionValid(sessionId))
     return;
 
   {
-    ScServerLock actionLock(m_actionMutex);
-    m_actions->push(new ScServerEventCallbackAction(this, sessionId, msg));
+    ScServerLock eventsLock(m_eventsMutex);
+    // Sc-events messages emitted after events thread is stopped can't be sent
+    if (m_eventsRun == SC_FALSE)
+      return;
+
+    ScServerSessionEvents & sessionEvents = (*m_sessionsEvents)[sessionId];
+
+    // Sc-events messages that are buffered or being sent to session are limited, so they can't be accumulated in
+    // actions queue of session
+    size_t & pendingEventsCount = (*m_sessionsPendingEventsCounts)[sessionId];
+    if (m_sessionEventsLimit != 0 && pendingEventsCount >= m_sessionEventsLimit)
+    {
+      ++sessionEvents.m_droppedCount;
+      return;
+    }
+
+    std::vector<std::string> & messages =
+        type == ScServerMessageType::binary ? sessionEvents.m_binaryMessages : sessionEvents.m_textMessages;
+    messages.push_back(msg);
+    ++pendingEventsCount;
+    ++m_eventsCount;
   }
-  m_actionCond.notify_one();
+
+  m_eventsCond.notify_one();
 }
 
 ScServerImpl::~ScServerImpl()
 {
   ScMemoryJsonActionsHandler::ClearActionClasses();
-  delete m_actions;
+
+  for (auto & it : *m_sessionsActions)
+  {
+    for (ScServerActions * actions : {&it.second.m_eventsActions, &it.second.m_actions})
+    {
+      while (!actions->empty())
+      {
+        delete actions->front();
+        actions->pop();
+      }
+    }
+  }
+  delete m_sessionsActions;
+  delete m_readySessions;
+  delete m_sessionsEvents;
+  delete m_sessionsPendingEventsCounts;
+
+  delete m_actionsHandler;
+  delete m_eventsHandler;
 }
@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <vector>
+#include <map>
+#include <chrono>
+
 #include "sc_server.hpp"
 
 using ScServerUniqueLock = std::unique_lock<ScServerMutex>;
@@ -13,10 +17,65 @@ using ScServerCondVar = std::condition_variable;
 
 using ScServerActions = std::queue<ScServerAction *>;
 
+//! Actions of session, sc-events actions are emitted before pending actions of requests
+struct ScServerSessionActions
+{
+  ScServerActions m_eventsActions;
+  ScServerActions m_actions;
+};
+
+using ScServerSessionsActions =
+    std::map<ScServerSessionId, ScServerSessionActions, std::owner_less<ScServerSessionId>>;
+using ScServerReadySessions = std::queue<ScServerSessionId>;
+
+//! Encoded sc-events messages of session that haven't been sent yet
+struct ScServerSessionEvents
+{
+  std::vector<std::string> m_textMessages;
+  std::vector<std::string> m_binaryMessages;
+  size_t m_droppedCount = 0;
+};
+
+using ScServerSessionsEvents = std::map<ScServerSessionId, ScServerSessionEvents, std::owner_less<ScServerSessionId>>;
+using ScServerSessionsEventsCounts = std::map<ScServerSessionId, size_t, std::owner_less<ScServerSessionId>>;
+
+class ScMemoryJsonHandler;
+
+/*!
+ * Sc-server executes actions by pool of worker threads. Actions of each session are kept in its own queue, and every
+ * session is processed by at most one worker at a time. So actions of different sessions are executed concurrently,
+ * and actions of one session are executed in order they have been received. Input-output thread only pushes actions.
+ *
+ * Sc-events messages are buffered per session by separate thread and then pushed into sc-events actions queue of
+ * session. They are sent after action of session that is being emitted, e.g. after response to request that has
+ * subscribed session to these sc-events, but before actions of requests that haven't been emitted yet. If events
+ * batch interval is set, then all sc-events messages of session buffered during this interval are sent in one frame
+ * as an array. Sc-events messages of session are kept in buffer while its connection has too much data not written to
+ * socket, e.g. client doesn't read messages. Sc-events messages of session are pending from they are buffered until
+ * they are sent, and if count of pending messages reaches session events limit, then new sc-events messages of this
+ * session are dropped.
+ */
 class ScServerImpl : public ScServer
 {
 public:
-  explicit ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions);
+  /*!
+   * @param host A sc-server host name.
+   * @param port A sc-server port.
+   * @param parallelActions If SC_FALSE, then all actions are executed by one worker thread.
+   * @param actionsThreadsCount A count of worker threads executing actions. If it is 0, then count of hardware
+   * threads is used.
+   * @param eventsBatchInterval An interval in milliseconds during which sc-events messages of session are collected
+   * to be sent in one frame. If it is 0, then every sc-events message is sent in its own frame.
+   * @param sessionEventsLimit A maximum count of not sent sc-events messages of session. If it is 0, then count is not
+   * limited.
+   */
+  explicit ScServerImpl(
+      std::string const & host,
+      ScServerPort port,
+      sc_bool parallelActions,
+      size_t actionsThreadsCount = 0,
+      size_t eventsBatchInterval = 0,
+      size_t sessionEventsLimit = 0);
 
   void EmitActions() override;
 
@@ -24,24 +83,64 @@ public:
 
   ~ScServerImpl() override;
 
+  //! A maximum size of data of session connection not written to socket, sc-events messages aren't sent above it
+  static size_t constexpr kMaxSessionBufferedAmount = 1 << 20;
+  //! An interval in milliseconds in which sc-events messages of sessions with too much not written data are resent
+  static size_t constexpr kCongestedSessionsRetryInterval = 100;
+
+  //! Sends sc-events messages of session, if it is still open
+  void EmitSessionEvents(ScServerSessionId const & sessionId, ScServerSessionEvents & sessionEvents);
+
 protected:
   ScServerMutex m_actionMutex;
-  ScServerMutex m_connectionMutex;
   ScServerCondVar m_actionCond;
-  sc_bool m_parallelActions;
+  size_t m_actionsThreadsCount;
 
   std::atomic<sc_bool> m_actionsRun;
-  ScServerActions * m_actions;
+  std::atomic<size_t> m_actionsCount;
+  ScServerSessionsActions * m_sessionsActions;
+  ScServerReadySessions * m_readySessions;
+
+  ScMemoryJsonHandler * m_actionsHandler;
+  ScMemoryJsonHandler * m_eventsHandler;
+
+  ScServerMutex m_eventsMutex;
+  ScServerCondVar m_eventsCond;
+  std::chrono::milliseconds m_eventsBatchInterval;
+  size_t m_sessionEventsLimit;
+
+  std::atomic<sc_bool> m_eventsRun;
+  std::atomic<size_t> m_eventsCount;
+  ScServerSessionsEvents * m_sessionsEvents;
+  ScServerSessionsEventsCounts * m_sessionsPendingEventsCounts;
 
   void Initialize() override;
 
   void AfterInitialize() override;
 
+  void EmitSessionsActions();
+
+  void PushAction(ScServerSessionId const & sessionId, ScServerAction * action, sc_bool isEventsAction = SC_FALSE);
+
+  void EmitSessionsEvents();
+
+  //! Checks that connection of session has too much data not written to socket to send sc-events messages to it
+  virtual sc_bool IsSessionCongested(ScServerSessionId const & sessionId);
+
+  void ReleaseSessionPendingEvents(ScServerSessionId const & sessionId, size_t eventsCount);
+
+  void SendSessionEvents(ScServerSessionId const & sessionId, ScServerSessionEvents & sessionEvents);
+
+  void SendEventsMessages(
+      ScServerSessionId const & sessionId,
+      std::vector<std::string> const & messages,
+      ScServerMessageType type);
+
   void OnOpen(ScServerSessionId const & sessionId) override;
 
   void OnClose(ScServerSessionId const & sessionId) override;
 
   void OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg) override;
 
-  void OnEvent(ScServerSessionId const & sessionId, std::string const & msg) override;
+  void OnEvent(ScServerSessionId const & sessionId, std::string const & msg, ScServerMessageType type) override;
 };
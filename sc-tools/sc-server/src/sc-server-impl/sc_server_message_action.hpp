@@ -21,32 +21,45 @@
 class ScServerMessageAction : public ScServerAction
 {
 public:
-  ScServerMessageAction(ScServer * server, ScServerSessionId const & sessionId, ScServerMessage msg)
+  ScServerMessageAction(
+      ScServer * server,
+      ScMemoryJsonHandler * actionsHandler,
+      ScMemoryJsonHandler * eventsHandler,
+      ScServerSessionId const & sessionId,
+      ScServerMessage msg)
     : ScServerAction(sessionId)
     , m_server(server)
     , m_msg(std::move(msg))
+    , m_actionsHandler(actionsHandler)
+    , m_eventsHandler(eventsHandler)
   {
-    ScAgentContext * sessionCtx = m_server->GetSessionContext(sessionId);
-    m_actionsHandler = new ScMemoryJsonActionsHandler(server, sessionCtx);
-    m_eventsHandler = new ScMemoryJsonEventsHandler(server, sessionCtx);
   }
 
   void HandleEmit()
   {
-    std::string const & messageType = GetMessageType(m_msg);
+    // Message is parsed once, all handlers use parsed message. Binary messages are encoded in MessagePack, responses
+    // for them are sent as binary messages too
+    ScMemoryJsonPayload message =
+        IsBinary() ? ScMemoryJsonPayload::from_msgpack(m_msg->get_payload(), true, false)
+                   : ScMemoryJsonPayload::parse(m_msg->get_payload(), nullptr, false);
+    std::string const & messageType = GetMessageType(message);
 
     if (IsHealthCheck(messageType))
-      OnHealthCheck(m_sessionId, m_msg);
+      OnHealthCheck(m_sessionId);
     else if (IsConnectionInfo(messageType))
-      OnConnectionInfo(m_sessionId, m_msg);
+      OnConnectionInfo(m_sessionId);
     else if (IsEvent(messageType))
-      OnEvent(m_sessionId, m_msg);
+      OnEvent(m_sessionId, message);
     else
-      OnAction(m_sessionId, m_msg);
+      OnAction(m_sessionId, message);
   }
 
   void Emit() override
   {
+    // Session context is added by connect action that has been emitted before this action, if session is still open
+    if (!m_server->IsSessionValid(m_sessionId))
+      return;
+
     try
     {
       HandleEmit();
@@ -61,25 +74,35 @@ public:
     }
   }
 
-  void OnAction(ScServerSessionId const & sessionId, ScServerMessage const & msg)
+  void OnAction(ScServerSessionId const & sessionId, ScMemoryJsonPayload & message)
   {
-    m_server->LogMessage(ScServerErrorLevel::debug, "[request] " + msg->get_payload());
-    auto const & responseText = m_actionsHandler->Handle(sessionId, msg->get_payload());
+    sc_bool const isDebug = m_server->IsLogLevelEnabled(ScServerErrorLevel::debug);
+    if (isDebug)
+      m_server->LogMessage(ScServerErrorLevel::debug, "[request] " + FormatForLog(m_msg->get_payload()));
 
-    m_server->LogMessage(ScServerErrorLevel::debug, "[response] " + responseText);
-    m_server->Send(sessionId, responseText, ScServerMessageType::text);
+    ScAgentContext * sessionCtx = m_server->GetSessionContext(sessionId);
+    std::string const & responseText = m_actionsHandler->Handle(sessionId, sessionCtx, message, GetType());
+
+    if (isDebug)
+      m_server->LogMessage(ScServerErrorLevel::debug, "[response] " + FormatForLog(responseText));
+    m_server->Send(sessionId, responseText, GetType());
   }
 
-  void OnEvent(ScServerSessionId const & sessionId, ScServerMessage const & msg)
+  void OnEvent(ScServerSessionId const & sessionId, ScMemoryJsonPayload & message)
   {
-    m_server->LogMessage(ScServerErrorLevel::debug, "[event] " + msg->get_payload());
-    auto const & responseText = m_eventsHandler->Handle(sessionId, msg->get_payload());
+    sc_bool const isDebug = m_server->IsLogLevelEnabled(ScServerErrorLevel::debug);
+    if (isDebug)
+      m_server->LogMessage(ScServerErrorLevel::debug, "[event] " + FormatForLog(m_msg->get_payload()));
 
-    m_server->LogMessage(ScServerErrorLevel::debug, "[event response] " + responseText);
-    m_server->Send(sessionId, responseText, ScServerMessageType::text);
+    ScAgentContext * sessionCtx = m_server->GetSessionContext(sessionId);
+    std::string const & responseText = m_eventsHandler->Handle(sessionId, sessionCtx, message, GetType());
+
+    if (isDebug)
+      m_server->LogMessage(ScServerErrorLevel::debug, "[event response] " + FormatForLog(responseText));
+    m_server->Send(sessionId, responseText, GetType());
   }
 
-  void OnHealthCheck(ScServerSessionId const & sessionId, ScServerMessage const &)
+  void OnHealthCheck(ScServerSessionId const & sessionId)
   {
     ScMemoryJsonPayload response;
     try
@@ -101,23 +124,19 @@ public:
       m_server->LogMessage(ScServerErrorLevel::info, "I've died...");
     }
 
-    m_server->Send(sessionId, response.dump(), ScServerMessageType::text);
+    m_server->Send(sessionId, ScMemoryJsonHandler::EncodeMessage(response, GetType()), GetType());
     m_server->CloseConnection(sessionId, websocketpp::close::status::normal, "Status checked");
   }
 
-  void OnConnectionInfo(ScServerSessionId const & sessionId, ScServerMessage const &)
+  void OnConnectionInfo(ScServerSessionId const & sessionId)
   {
     ScAddr const & userAddr = m_server->GetSessionContext(sessionId)->GetUser();
     ScMemoryJsonPayload response{{"connection_id", (sc_uint64)sessionId.lock().get()}, {"user_addr", userAddr.Hash()}};
 
-    m_server->Send(sessionId, response.dump(), ScServerMessageType::text);
+    m_server->Send(sessionId, ScMemoryJsonHandler::EncodeMessage(response, GetType()), GetType());
   }
 
-  ~ScServerMessageAction() override
-  {
-    delete m_actionsHandler;
-    delete m_eventsHandler;
-  };
+  ~ScServerMessageAction() override = default;
 
 protected:
   ScServer * m_server;
@@ -126,15 +145,28 @@ protected:
   ScMemoryJsonHandler * m_actionsHandler;
   ScMemoryJsonHandler * m_eventsHandler;
 
-  static std::string GetMessageType(ScServerMessage const & msg)
+  sc_bool IsBinary() const
   {
-    if (ScMemoryJsonPayload::accept(msg->get_payload()))
-    {
-      ScMemoryJsonPayload const & payload = ScMemoryJsonPayload::parse(msg->get_payload());
-      return payload.contains("type") ? payload["type"].get<std::string>() : "";
-    }
+    return m_msg->get_opcode() == ScServerMessageType::binary;
+  }
+
+  ScServerMessageType GetType() const
+  {
+    return IsBinary() ? ScServerMessageType::binary : ScServerMessageType::text;
+  }
+
+  std::string FormatForLog(std::string const & encodedMessage) const
+  {
+    return IsBinary() ? ScMemoryJsonPayload::from_msgpack(encodedMessage, true, false).dump() : encodedMessage;
+  }
+
+  static std::string GetMessageType(ScMemoryJsonPayload const & message)
+  {
+    if (!message.is_object())
+      return "";
 
-    return "";
+    auto const & typeIt = message.find("type");
+    return typeIt != message.cend() && typeIt->is_string() ? typeIt->get<std::string>() : "";
   }
 
   static sc_bool IsEvent(std::string const & messageType)
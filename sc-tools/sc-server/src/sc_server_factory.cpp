@@ -12,8 +12,16 @@ std::shared_ptr<ScServer> ScServerFactory::ConfigureScServer(ScParams const & se
   sc_bool parallelActions = SC_TRUE;
   if (serverParams.Has("parallel_actions"))
     parallelActions = serverParams.Get<std::string>("parallel_actions") == "true";
+  size_t const actionsThreadsCount = serverParams.Get<size_t>("actions_threads", 0);
+  size_t const eventsBatchInterval = serverParams.Get<size_t>("events_batch_interval", 0);
+  size_t const sessionEventsLimit = serverParams.Get<size_t>("session_events_limit", 0);
   std::unique_ptr<ScServer> server = std::unique_ptr<ScServer>(new ScServerImpl(
-      serverParams.Get<std::string>("host", "127.0.0.1"), serverParams.Get("port", 8090), parallelActions));
+      serverParams.Get<std::string>("host", "127.0.0.1"),
+      serverParams.Get("port", 8090),
+      parallelActions,
+      actionsThreadsCount,
+      eventsBatchInterval,
+      sessionEventsLimit));
 
   return server;
 }
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <condition_variable>
+
 #include <nlohmann/json.hpp>
 
 #include "sc-server-impl/sc_server_defines.hpp"
@@ -49,28 +52,39 @@ public:
     m_thread.join();
   }
 
-  sc_bool Send(std::string const & msg)
+  sc_bool Send(std::string const & msg, ScServerMessageType type = ScServerMessageType::text)
   {
     std::this_thread::sleep_for(std::chrono::milliseconds(400));
 
     ScClientErrorCode code;
-    m_instance.send(m_connection, msg, ScServerMessageType::text, code);
+    m_instance.send(m_connection, msg, type, code);
 
     return !code;
   }
 
   void OnMessage(ScServerSessionId const &, ScServerMessage const & msg)
   {
-    m_currentPayload = ScMemoryJsonPayload::parse(msg->get_payload());
-    m_isNewMessage = SC_TRUE;
+    ScMemoryJsonPayload payload = msg->get_opcode() == ScServerMessageType::binary
+                                      ? ScMemoryJsonPayload::from_msgpack(msg->get_payload())
+                                      : ScMemoryJsonPayload::parse(msg->get_payload());
+    {
+      std::lock_guard<std::mutex> lock(m_messageMutex);
+      m_currentPayload = std::move(payload);
+      m_isNewMessage = SC_TRUE;
+    }
+    m_messageCond.notify_all();
   }
 
+  //! Waits for message that has been received after previous call
   ScMemoryJsonPayload GetResponseMessage()
   {
-    while (!m_isNewMessage)
-    {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
+    std::unique_lock<std::mutex> lock(m_messageMutex);
+    m_messageCond.wait(
+        lock,
+        [this]
+        {
+          return m_isNewMessage;
+        });
 
     m_isNewMessage = SC_FALSE;
     return m_currentPayload;
@@ -83,6 +97,8 @@ private:
   ScClientConnection m_connection;
   std::thread m_thread;
 
+  std::mutex m_messageMutex;
+  std::condition_variable m_messageCond;
   sc_bool m_isNewMessage;
   ScMemoryJsonPayload m_currentPayload;
 
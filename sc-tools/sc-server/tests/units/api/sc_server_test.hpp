@@ -51,7 +51,7 @@ protected:
     std::filesystem::remove_all(SC_SERVER_KB_BIN);
   }
 
-  void Initialize(sc_bool parallel_actions)
+  void Initialize(sc_bool parallel_actions, size_t eventsBatchInterval = 0, size_t sessionEventsLimit = 0)
   {
     sc_memory_params params;
     sc_memory_params_clear(&params);
@@ -64,12 +64,21 @@ protected:
 
     ScMemory::LogMute();
     ScMemory::Initialize(params);
-    m_server = std::make_unique<ScServerImpl>("127.0.0.1", 8865, parallel_actions);
+    m_server = CreateServer(parallel_actions, eventsBatchInterval, sessionEventsLimit);
     m_server->ClearChannels();
     m_server->Run();
     ScMemory::LogUnmute();
   }
 
+  virtual std::unique_ptr<ScServer> CreateServer(
+      sc_bool parallel_actions,
+      size_t eventsBatchInterval,
+      size_t sessionEventsLimit)
+  {
+    return std::make_unique<ScServerImpl>(
+        "127.0.0.1", 8865, parallel_actions, 0, eventsBatchInterval, sessionEventsLimit);
+  }
+
   void Shutdown()
   {
     ScMemory::LogMute();
@@ -93,3 +102,84 @@ protected:
     m_ctx = std::make_unique<ScAgentContext>();
   }
 };
+
+class ScServerTestWithEventsBatching : public ScServerTest
+{
+public:
+  static size_t constexpr EVENTS_BATCH_INTERVAL = 1000;
+  static size_t constexpr SESSION_EVENTS_LIMIT = 2;
+
+protected:
+  void SetUp() override
+  {
+    Initialize(SC_TRUE, EVENTS_BATCH_INTERVAL, SESSION_EVENTS_LIMIT);
+    m_ctx = std::make_unique<ScAgentContext>();
+  }
+};
+
+//! Sc-server which client can stop reading sc-events messages, then its connection is congested
+class ScServerWithStoppedReading : public ScServerImpl
+{
+public:
+  using ScServerImpl::ScServerImpl;
+
+  std::atomic<sc_bool> m_isClientReading = SC_TRUE;
+
+  size_t GetSessionPendingEventsCount()
+  {
+    ScServerLock eventsLock(m_eventsMutex);
+    auto const it = m_sessionsPendingEventsCounts->find(m_sessionId);
+    return it == m_sessionsPendingEventsCounts->cend() ? 0 : it->second;
+  }
+
+  size_t GetSessionDroppedEventsCount()
+  {
+    ScServerLock eventsLock(m_eventsMutex);
+    auto const it = m_sessionsEvents->find(m_sessionId);
+    return it == m_sessionsEvents->cend() ? 0 : it->second.m_droppedCount;
+  }
+
+protected:
+  ScServerSessionId m_sessionId;
+
+  sc_bool IsSessionCongested(ScServerSessionId const &) override
+  {
+    return !m_isClientReading;
+  }
+
+  void OnOpen(ScServerSessionId const & sessionId) override
+  {
+    {
+      ScServerLock eventsLock(m_eventsMutex);
+      m_sessionId = sessionId;
+    }
+    ScServerImpl::OnOpen(sessionId);
+  }
+};
+
+class ScServerTestWithStoppedReading : public ScServerTest
+{
+public:
+  static size_t constexpr EVENTS_BATCH_INTERVAL = 100;
+  static size_t constexpr SESSION_EVENTS_LIMIT = 5;
+
+protected:
+  void SetUp() override
+  {
+    Initialize(SC_TRUE, EVENTS_BATCH_INTERVAL, SESSION_EVENTS_LIMIT);
+    m_ctx = std::make_unique<ScAgentContext>();
+  }
+
+  std::unique_ptr<ScServer> CreateServer(
+      sc_bool parallel_actions,
+      size_t eventsBatchInterval,
+      size_t sessionEventsLimit) override
+  {
+    auto server = std::make_unique<ScServerWithStoppedReading>(
+        "127.0.0.1", 8865, parallel_actions, 0, eventsBatchInterval, sessionEventsLimit);
+    m_stoppedReadingServer = server.get();
+    return server;
+  }
+
+  ScServerWithStoppedReading * m_stoppedReadingServer = nullptr;
+};
@@ -343,6 +343,87 @@ TEST_F(ScServerTest, EraseElements)
   client.Stop();
 }
 
+TEST_F(ScServerTest, Batch)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "batch",
+      ScMemoryJsonPayload::array({
+          {
+              {"type", "create_elements"},
+              {"payload",
+               ScMemoryJsonPayload::array({
+                   {
+                       {"el", "node"},
+                       {"type", sc_type_node | sc_type_const},
+                   },
+                   {
+                       {"el", "link"},
+                       {"type", sc_type_const_node_link},
+                       {"content", "batch_link"},
+                   },
+               })},
+          },
+          {
+              {"type", "create_elements"},
+              {"payload",
+               ScMemoryJsonPayload::array({
+                   {
+                       {"el", "edge"},
+                       {"src",
+                        {
+                            {"type", "addr"},
+                            {"value", {{"batch_ref", {0, 0}}}},
+                        }},
+                       {"trg",
+                        {
+                            {"type", "addr"},
+                            {"value", {{"batch_ref", {0, 1}}}},
+                        }},
+                       {"type", sc_type_const_perm_pos_arc},
+                   },
+               })},
+          },
+          {
+              {"type", "check_elements"},
+              {"payload", ScMemoryJsonPayload::array({{{"batch_ref", {1, 0}}}})},
+          },
+          {
+              {"type", "check_elements"},
+              {"payload", ScMemoryJsonPayload::array({{{"batch_ref", {5, 0}}}})},
+          },
+      }));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["errors"].size(), 1u);
+
+  auto const & responsePayload = response["payload"];
+  EXPECT_EQ(responsePayload.size(), 4u);
+  EXPECT_TRUE(responsePayload[0]["status"].get<sc_bool>());
+  EXPECT_TRUE(responsePayload[1]["status"].get<sc_bool>());
+  EXPECT_TRUE(responsePayload[2]["status"].get<sc_bool>());
+  EXPECT_FALSE(responsePayload[3]["status"].get<sc_bool>());
+
+  ScAddr const & nodeAddr = ScAddr(responsePayload[0]["payload"][0].get<size_t>());
+  ScAddr const & linkAddr = ScAddr(responsePayload[0]["payload"][1].get<size_t>());
+  ScAddr const & arcAddr = ScAddr(responsePayload[1]["payload"][0].get<size_t>());
+  EXPECT_TRUE(m_ctx->CreateIterator3(nodeAddr, ScType::ConstPermPosArc, linkAddr)->Next());
+
+  auto const & [sourceAddr, targetAddr] = m_ctx->GetConnectorIncidentElements(arcAddr);
+  EXPECT_EQ(sourceAddr, nodeAddr);
+  EXPECT_EQ(targetAddr, linkAddr);
+  EXPECT_EQ(ScType(responsePayload[2]["payload"][0].get<size_t>()), ScType::ConstPermPosArc);
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, HandleKeynodes)
 {
   ScClient client;
@@ -888,6 +969,180 @@ TEST_F(ScServerTest, SearchTemplate)
   client.Stop();
 }
 
+TEST_F(ScServerTest, SearchTemplateByBinaryMessage)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & link = m_ctx->GenerateLink();
+  ScAddr const & connectorAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, addr, link);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = ScMemoryJsonPayload::array({
+      {
+          {
+              {"type", "addr"},
+              {"value", addr.Hash()},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarCommonArc},
+              {"alias", "_connector"},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarNodeLink},
+              {"alias", "_trg"},
+          },
+      },
+  });
+  payload["params"] = ScMemoryJsonPayload::object({});
+  ScMemoryJsonPayload const & message = {{"id", 1}, {"type", "search_template"}, {"payload", payload}};
+  std::vector<uint8_t> const & encodedMessage = ScMemoryJsonPayload::to_msgpack(message);
+  EXPECT_TRUE(client.Send(std::string(encodedMessage.begin(), encodedMessage.end()), ScServerMessageType::binary));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_EQ(response["id"].get<size_t>(), 1u);
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  auto const & responsePayload = response["payload"];
+  EXPECT_EQ(responsePayload["aliases"]["_connector"].get<size_t>(), 1u);
+  EXPECT_EQ(responsePayload["addrs"].size(), 1u);
+
+  auto const & addrs = responsePayload["addrs"][0].get<std::vector<size_t>>();
+  EXPECT_EQ(addrs.size(), 3u);
+  EXPECT_TRUE(ScAddr(addrs[0]) == addr);
+  EXPECT_TRUE(ScAddr(addrs[1]) == connectorAddr);
+  EXPECT_TRUE(ScAddr(addrs[2]) == link);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, SearchTemplateByPages)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  size_t const linksCount = 5;
+  for (size_t i = 0; i < linksCount; ++i)
+    m_ctx->GenerateConnector(ScType::ConstCommonArc, addr, m_ctx->GenerateLink());
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = ScMemoryJsonPayload::array({
+      {
+          {
+              {"type", "addr"},
+              {"value", addr.Hash()},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarCommonArc},
+              {"alias", "_connector"},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarNodeLink},
+              {"alias", "_trg"},
+          },
+      },
+  });
+  payload["params"] = ScMemoryJsonPayload::object({});
+  payload["page_size"] = 2;
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "search_template", payload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["aliases"]["_trg"].get<size_t>(), 2u);
+  EXPECT_EQ(response["payload"]["addrs"].size(), 2u);
+  EXPECT_FALSE(response["payload"]["cursor"].is_null());
+
+  size_t const cursorId = response["payload"]["cursor"].get<size_t>();
+  size_t foundCount = response["payload"]["addrs"].size();
+  for (size_t id = 2; !response["payload"]["cursor"].is_null(); ++id)
+  {
+    EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(id, "search_template_page", {{"cursor", cursorId}})));
+
+    response = client.GetResponseMessage();
+    EXPECT_FALSE(response.is_null());
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+    EXPECT_TRUE(response["errors"].empty());
+
+    for (auto const & item : response["payload"]["addrs"])
+    {
+      EXPECT_TRUE(ScAddr(item[0].get<size_t>()) == addr);
+      ++foundCount;
+    }
+  }
+  EXPECT_EQ(foundCount, linksCount);
+
+  // Finished cursor is removed
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(10, "search_template_page", {{"cursor", cursorId}})));
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, CancelSearchTemplateByPages)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  for (size_t i = 0; i < 10; ++i)
+    m_ctx->GenerateConnector(ScType::ConstCommonArc, addr, m_ctx->GenerateLink());
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = ScMemoryJsonPayload::array({
+      {
+          {
+              {"type", "addr"},
+              {"value", addr.Hash()},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarCommonArc},
+          },
+          {
+              {"type", "type"},
+              {"value", *ScType::VarNodeLink},
+          },
+      },
+  });
+  payload["page_size"] = 1;
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "search_template", payload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+
+  size_t const cursorId = response["payload"]["cursor"].get<size_t>();
+  ScMemoryJsonPayload const & cancelPayload = {{"cursor", cursorId}, {"cancel", true}};
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(2, "search_template_page", cancelPayload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["payload"]["cursor"].is_null());
+
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(3, "search_template_page", {{"cursor", cursorId}})));
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, SearchStringTemplate)
 {
   ScAddr const & addr1 = m_ctx->ResolveElementSystemIdentifier("node1", ScType::ConstNode);
@@ -1225,6 +1480,116 @@ TEST_F(ScServerTest, HandleEvents)
   client.Stop();
 }
 
+TEST_F(ScServerTestWithEventsBatching, HandleEventsInBatches)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "events",
+      ScMemoryJsonPayload::object({{
+          "create",
+          ScMemoryJsonPayload::array({
+              {
+                  {"type", "sc_event_after_generate_outgoing_arc"},
+                  {"addr", addr1.Hash()},
+              },
+          }),
+      }}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  // Events messages above session limit are dropped
+  for (size_t i = 0; i < SESSION_EVENTS_LIMIT + 3; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+
+  // Client waits for frame sent after events batch interval
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response.is_array());
+  EXPECT_EQ(response.size(), SESSION_EVENTS_LIMIT);
+  for (auto const & eventMessage : response)
+  {
+    EXPECT_TRUE(eventMessage["event"].get<sc_bool>());
+    EXPECT_TRUE(eventMessage["payload"][0].get<uint64_t>() == addr1.Hash());
+  }
+
+  client.Stop();
+}
+
+TEST_F(ScServerTestWithStoppedReading, DropEventsWhenClientStopsReading)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "events",
+      ScMemoryJsonPayload::object({{
+          "create",
+          ScMemoryJsonPayload::array({
+              {
+                  {"type", "sc_event_after_generate_outgoing_arc"},
+                  {"addr", addr1.Hash()},
+              },
+          }),
+      }}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  auto const & waitFor = [](auto const & predicate)
+  {
+    for (size_t i = 0; i < 500 && !predicate(); ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return predicate();
+  };
+
+  // Sc-events messages aren't sent to client that stops reading, they are pending until limit and then dropped
+  m_stoppedReadingServer->m_isClientReading = SC_FALSE;
+  for (size_t i = 0; i < SESSION_EVENTS_LIMIT + 10; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(waitFor(
+      [this]
+      {
+        return m_stoppedReadingServer->GetSessionDroppedEventsCount() == 10;
+      }));
+  EXPECT_EQ(m_stoppedReadingServer->GetSessionPendingEventsCount(), SESSION_EVENTS_LIMIT);
+
+  for (size_t i = 0; i < 100; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(waitFor(
+      [this]
+      {
+        return m_stoppedReadingServer->GetSessionDroppedEventsCount() == 110;
+      }));
+  EXPECT_EQ(m_stoppedReadingServer->GetSessionPendingEventsCount(), SESSION_EVENTS_LIMIT);
+
+  // Pending sc-events messages are sent when client reads again
+  m_stoppedReadingServer->m_isClientReading = SC_TRUE;
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response.is_array());
+  EXPECT_EQ(response.size(), SESSION_EVENTS_LIMIT);
+  EXPECT_TRUE(waitFor(
+      [this]
+      {
+        return m_stoppedReadingServer->GetSessionPendingEventsCount() == 0;
+      }));
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, UnknownEvent)
 {
   ScClient client;
@@ -6,11 +6,15 @@
 
 #include "sc_server_test.hpp"
 
+#include <atomic>
+#include <thread>
+
 #include <sc-config/sc_options.hpp>
 #include <sc-config/sc_config.hpp>
 #include <sc-config/sc_memory_config.hpp>
 
 #include "sc-client/sc_client.hpp"
+#include "sc-client/sc_memory_json_converter.hpp"
 
 #include "sc_server_module.hpp"
 
@@ -112,6 +116,47 @@ TEST_F(ScServerTestWithoutParallelMode, HealthcheckOK)
   client.Stop();
 }
 
+TEST_F(ScServerTest, GenerateElementsByClientsInParallel)
+{
+  size_t const CLIENTS = 8;
+  std::vector<std::thread> threads;
+  std::atomic<size_t> generatedNodesCount = 0;
+  for (size_t i = 0; i < CLIENTS; ++i)
+  {
+    threads.emplace_back(
+        [this, &generatedNodesCount]()
+        {
+          ScClient client;
+          EXPECT_TRUE(client.Connect(m_server->GetUri()));
+          client.Run();
+
+          std::string const payloadString = ScMemoryJsonConverter::From(
+              0,
+              "create_elements",
+              ScMemoryJsonPayload::array({
+                  {
+                      {"el", "node"},
+                      {"type", sc_type_node | sc_type_const},
+                  },
+              }));
+          EXPECT_TRUE(client.Send(payloadString));
+
+          auto const response = client.GetResponseMessage();
+          EXPECT_FALSE(response.is_null());
+          EXPECT_TRUE(response["status"].get<sc_bool>());
+          if (ScAddr(response["payload"][0].get<size_t>()).IsValid())
+            ++generatedNodesCount;
+
+          client.Stop();
+        });
+  }
+
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_EQ(generatedNodesCount.load(), CLIENTS);
+}
+
 void TEST_N_CONNECTIONS(std::unique_ptr<ScServer> const & server, size_t const amount)
 {
   size_t const CONNECTIONS = amount;
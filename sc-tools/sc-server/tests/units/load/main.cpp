@@ -0,0 +1,206 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <sc-memory/sc_memory.hpp>
+
+#include <sc-config/sc_options.hpp>
+
+extern "C"
+{
+#include <sc-core/sc_memory_params.h>
+}
+
+#include "sc-server-impl/sc_server_impl.hpp"
+
+#include "sc_load_client.hpp"
+
+static std::string const SC_SERVER_LOAD_KB_BIN = "sc-server-load-kb-bin";
+
+static std::string const OPERATIONS_NAMES[] = {"generate", "search_template", "content", "events"};
+
+struct ScLoadParams
+{
+  size_t m_clientsCount = 32;
+  size_t m_requestsCount = 1000;
+  std::array<size_t, 4> m_weights = {40, 40, 15, 5};
+  size_t m_port = 8898;
+  size_t m_actionsThreadsCount = 0;
+  size_t m_eventsBatchInterval = 0;
+  size_t m_hubConnectorsCount = 100;
+};
+
+void PrintHelpMessage(std::string const & binaryName)
+{
+  std::cout << "Usage:\n"
+            << "  " << binaryName << " [options]\n\n"
+            << "Starts sc-server locally, replays mixed workload from concurrent websocket clients against it and "
+               "reports latency percentiles and throughput.\n\n"
+            << "Options:\n"
+            << "  --clients|-c <count>                    Count of concurrent clients. By default, it is 32.\n"
+            << "  --requests|-r <count>                   Count of requests sent by every client. By default, it is "
+               "1000.\n"
+            << "  --mix|-m <g,s,c,e>                      Weights of generate, search template, content and events "
+               "operations. By default, it is 40,40,15,5.\n"
+            << "  --port|-p <port>                        Port of sc-server. By default, it is 8898.\n"
+            << "  --actions-threads <count>               Count of sc-server actions threads. By default, it is 0, "
+               "that means count of hardware threads.\n"
+            << "  --events-batch-interval <ms>            Sc-server events batch interval. By default, it is 0.\n"
+            << "  --help                                  Display this help message.\n";
+}
+
+std::array<size_t, 4> ParseWeights(std::string const & mix)
+{
+  std::array<size_t, 4> weights{};
+  std::stringstream stream(mix);
+  std::string weight;
+  for (size_t i = 0; i < weights.size(); ++i)
+  {
+    if (!std::getline(stream, weight, ','))
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Operations mix must contain 4 weights: " << mix);
+    weights[i] = std::stoul(weight);
+  }
+  return weights;
+}
+
+void PrintRow(std::string const & name, ScLatencyHistogram const & histogram, double elapsedSeconds)
+{
+  std::cout << std::left << std::setw(18) << name << std::right << std::setw(10) << histogram.GetCount()
+            << std::setw(14) << std::fixed << std::setprecision(1)
+            << static_cast<double>(histogram.GetCount()) / elapsedSeconds << std::setw(12)
+            << histogram.GetPercentile(50) << std::setw(12) << histogram.GetPercentile(99) << std::setw(12)
+            << histogram.GetPercentile(99.9) << std::setw(12) << histogram.GetMax() << "\n";
+}
+
+void RunLoad(ScLoadParams const & params)
+{
+  sc_memory_params memoryParams;
+  sc_memory_params_clear(&memoryParams);
+  memoryParams.storage = SC_SERVER_LOAD_KB_BIN.c_str();
+  memoryParams.clear = SC_TRUE;
+  memoryParams.dump_memory = SC_FALSE;
+  memoryParams.dump_memory_statistics = SC_FALSE;
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(memoryParams);
+
+  ScAddr hubAddr;
+  ScAddr linkAddr;
+  {
+    ScMemoryContext context;
+    hubAddr = context.GenerateNode(ScType::ConstNode);
+    for (size_t i = 0; i < params.m_hubConnectorsCount; ++i)
+      context.GenerateConnector(ScType::ConstPermPosArc, hubAddr, context.GenerateNode(ScType::ConstNode));
+    linkAddr = context.GenerateLink();
+  }
+
+  auto server = std::make_unique<ScServerImpl>(
+      "127.0.0.1", params.m_port, SC_TRUE, params.m_actionsThreadsCount, params.m_eventsBatchInterval);
+  server->ClearChannels();
+  server->Run();
+
+  std::vector<std::unique_ptr<ScLoadClient>> clients;
+  clients.reserve(params.m_clientsCount);
+  for (size_t i = 0; i < params.m_clientsCount; ++i)
+  {
+    auto client = std::make_unique<ScLoadClient>(hubAddr, linkAddr, params.m_weights, i);
+    if (!client->Connect(server->GetUri()))
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Client " << i << " can't connect to " << server->GetUri());
+    client->Subscribe();
+    clients.push_back(std::move(client));
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  threads.reserve(clients.size());
+  for (auto & client : clients)
+    threads.emplace_back(&ScLoadClient::Run, client.get(), params.m_requestsCount);
+  for (auto & thread : threads)
+    thread.join();
+
+  auto const end = std::chrono::steady_clock::now();
+  double const elapsedSeconds = std::chrono::duration<double>(end - start).count();
+
+  ScLoadHistograms histograms;
+  ScLatencyHistogram totalHistogram;
+  size_t failedCount = 0;
+  size_t eventsCount = 0;
+  for (auto & client : clients)
+  {
+    for (size_t i = 0; i < histograms.size(); ++i)
+    {
+      histograms[i].Merge(client->GetHistograms()[i]);
+      totalHistogram.Merge(client->GetHistograms()[i]);
+    }
+    failedCount += client->GetFailedCount();
+    eventsCount += client->GetEventsCount();
+    client->Stop();
+  }
+
+  server->Stop();
+  server = nullptr;
+  ScMemory::Shutdown(false);
+  ScMemory::LogUnmute();
+  std::filesystem::remove_all(SC_SERVER_LOAD_KB_BIN);
+
+  std::cout << "Clients: " << params.m_clientsCount << ", requests per client: " << params.m_requestsCount
+            << ", elapsed: " << std::fixed << std::setprecision(3) << elapsedSeconds << " s\n\n";
+  std::cout << std::left << std::setw(18) << "operation" << std::right << std::setw(10) << "count" << std::setw(14)
+            << "rps" << std::setw(12) << "p50, us" << std::setw(12) << "p99, us" << std::setw(12) << "p999, us"
+            << std::setw(12) << "max, us"
+            << "\n";
+  for (size_t i = 0; i < histograms.size(); ++i)
+    PrintRow(OPERATIONS_NAMES[i], histograms[i], elapsedSeconds);
+  PrintRow("total", totalHistogram, elapsedSeconds);
+  std::cout << "\nFailed operations: " << failedCount << "\nReceived sc-events messages: " << eventsCount << "\n";
+}
+
+int main(int argc, char * argv[])
+try
+{
+  std::string const binaryName{argv[0]};
+
+  ScOptions options{argc, argv};
+  if (options.Has({"help"}))
+  {
+    PrintHelpMessage(binaryName);
+    return EXIT_SUCCESS;
+  }
+
+  ScLoadParams params;
+  if (options.Has({"clients", "c"}))
+    params.m_clientsCount = std::stoul(options[{"clients", "c"}].second);
+  if (options.Has({"requests", "r"}))
+    params.m_requestsCount = std::stoul(options[{"requests", "r"}].second);
+  if (options.Has({"mix", "m"}))
+    params.m_weights = ParseWeights(options[{"mix", "m"}].second);
+  if (options.Has({"port", "p"}))
+    params.m_port = std::stoul(options[{"port", "p"}].second);
+  if (options.Has({"actions-threads"}))
+    params.m_actionsThreadsCount = std::stoul(options[{"actions-threads"}].second);
+  if (options.Has({"events-batch-interval"}))
+    params.m_eventsBatchInterval = std::stoul(options[{"events-batch-interval"}].second);
+
+  RunLoad(params);
+  return EXIT_SUCCESS;
+}
+catch (utils::ScException const & e)
+{
+  std::cout << e.Message() << "\n";
+  return EXIT_FAILURE;
+}
+catch (std::exception const & e)
+{
+  std::cout << e.what() << "\n";
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,92 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+
+/*!
+ * Counts latencies in log-linear buckets: every power of two range is split into 16 equal buckets, so percentiles
+ * are computed with relative error at most 1/16 and memory doesn't depend on count of recorded values.
+ */
+class ScLatencyHistogram
+{
+public:
+  void Record(uint64_t value)
+  {
+    ++m_buckets[GetBucketIndex(value)];
+    ++m_count;
+    m_max = std::max(m_max, value);
+  }
+
+  void Merge(ScLatencyHistogram const & other)
+  {
+    for (size_t i = 0; i < kBucketsCount; ++i)
+      m_buckets[i] += other.m_buckets[i];
+    m_count += other.m_count;
+    m_max = std::max(m_max, other.m_max);
+  }
+
+  uint64_t GetCount() const
+  {
+    return m_count;
+  }
+
+  uint64_t GetMax() const
+  {
+    return m_max;
+  }
+
+  //! Returns upper bound of bucket that contains value at specified percentile, e.g. 99.9
+  uint64_t GetPercentile(double percentile) const
+  {
+    if (m_count == 0)
+      return 0;
+
+    auto const rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(m_count - 1)) + 1;
+    uint64_t count = 0;
+    for (size_t i = 0; i < kBucketsCount; ++i)
+    {
+      count += m_buckets[i];
+      if (count >= rank)
+        return std::min(GetBucketUpperBound(i), m_max);
+    }
+
+    return m_max;
+  }
+
+private:
+  static size_t constexpr kSubBucketsBits = 5;
+  static uint64_t constexpr kSubBucketsCount = 1ull << kSubBucketsBits;
+  static uint64_t constexpr kHalfSubBucketsCount = kSubBucketsCount / 2;
+  static size_t constexpr kBucketsCount = kSubBucketsCount + 64 * kHalfSubBucketsCount;
+
+  std::array<uint64_t, kBucketsCount> m_buckets{};
+  uint64_t m_count = 0;
+  uint64_t m_max = 0;
+
+  static size_t GetBucketIndex(uint64_t value)
+  {
+    if (value < kSubBucketsCount)
+      return value;
+
+    size_t const highestBit = 63 - __builtin_clzll(value);
+    size_t const shift = highestBit - (kSubBucketsBits - 1);
+    return kSubBucketsCount + (shift - 1) * kHalfSubBucketsCount + ((value >> shift) - kHalfSubBucketsCount);
+  }
+
+  static uint64_t GetBucketUpperBound(size_t index)
+  {
+    if (index < kSubBucketsCount)
+      return index;
+
+    size_t const shift = (index - kSubBucketsCount) / kHalfSubBucketsCount + 1;
+    uint64_t const subBucket = (index - kSubBucketsCount) % kHalfSubBucketsCount + kHalfSubBucketsCount;
+    return ((subBucket + 1) << shift) - 1;
+  }
+};
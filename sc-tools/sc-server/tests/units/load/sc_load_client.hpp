@@ -0,0 +1,265 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include <sc-memory/sc_addr.hpp>
+#include <sc-memory/sc_type.hpp>
+
+#include "sc-server-impl/sc_server_defines.hpp"
+
+#include "sc-client/sc_client_defines.hpp"
+#include "sc-client/sc_memory_json_converter.hpp"
+
+#include "sc_latency_histogram.hpp"
+
+enum class ScLoadOperation : size_t
+{
+  Generate = 0,
+  SearchTemplate,
+  Content,
+  Events,
+  Count
+};
+
+using ScLoadHistograms = std::array<ScLatencyHistogram, static_cast<size_t>(ScLoadOperation::Count)>;
+
+/*!
+ * Websocket client that sends requests of mixed workload one by one and measures time from sending of request to
+ * receiving of its response in microseconds. It doesn't wait before sending like `ScClient`, so it loads sc-server as
+ * fast as sc-server responds. Sc-events messages received by client are only counted.
+ */
+class ScLoadClient
+{
+public:
+  static inline std::chrono::seconds const kResponseTimeout{10};
+
+  ScLoadClient(ScAddr const & hubAddr, ScAddr const & linkAddr, std::array<size_t, 4> const & weights, size_t seed)
+    : m_hubAddr(hubAddr)
+    , m_linkAddr(linkAddr)
+    , m_operationDistribution(weights.cbegin(), weights.cend())
+    , m_generator(seed)
+  {
+    m_instance.clear_access_channels(ScServerErrorLevel::all);
+    m_instance.clear_error_channels(ScServerErrorLevel::all);
+    m_instance.init_asio();
+    m_instance.set_message_handler(bind(&ScLoadClient::OnMessage, this, std::placeholders::_1, std::placeholders::_2));
+    m_instance.set_open_handler(bind(&ScLoadClient::OnOpen, this, std::placeholders::_1));
+  }
+
+  sc_bool Connect(std::string const & uri)
+  {
+    ScClientErrorCode code;
+    m_connection = m_instance.get_connection(uri, code);
+    if (code.value())
+      return SC_FALSE;
+
+    m_instance.connect(m_connection);
+    m_thread = std::thread(&ScClientCore::run, &m_instance);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_cond.wait_for(
+        lock,
+        kResponseTimeout,
+        [this]
+        {
+          return m_isOpened;
+        });
+  }
+
+  void Stop()
+  {
+    m_instance.stop();
+    if (m_thread.joinable())
+      m_thread.join();
+  }
+
+  //! Subscribes client to sc-events of generating connectors from hub, they are emitted by generate operations
+  void Subscribe()
+  {
+    ScMemoryJsonPayload const & payload = {
+        {"create",
+         ScMemoryJsonPayload::array({{{"type", "sc_event_after_generate_outgoing_arc"}, {"addr", m_hubAddr.Hash()}}})}};
+    Request("events", payload);
+  }
+
+  void Run(size_t requestsCount)
+  {
+    for (size_t i = 0; i < requestsCount; ++i)
+    {
+      auto const operation = static_cast<ScLoadOperation>(m_operationDistribution(m_generator));
+
+      auto const start = std::chrono::steady_clock::now();
+      sc_bool const isCompleted = RunOperation(operation);
+      auto const end = std::chrono::steady_clock::now();
+
+      if (isCompleted)
+        m_histograms[static_cast<size_t>(operation)].Record(
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+      else
+        ++m_failedCount;
+    }
+  }
+
+  ScLoadHistograms const & GetHistograms() const
+  {
+    return m_histograms;
+  }
+
+  size_t GetFailedCount() const
+  {
+    return m_failedCount;
+  }
+
+  size_t GetEventsCount() const
+  {
+    return m_eventsCount;
+  }
+
+private:
+  ScClientCore m_instance;
+  ScClientConnection m_connection;
+  std::thread m_thread;
+
+  ScAddr m_hubAddr;
+  ScAddr m_linkAddr;
+  std::discrete_distribution<size_t> m_operationDistribution;
+  std::mt19937 m_generator;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  sc_bool m_isOpened = SC_FALSE;
+  size_t m_requestId = 0;
+  size_t m_respondedId = 0;
+  sc_bool m_responseStatus = SC_FALSE;
+  ScMemoryJsonPayload m_responsePayload;
+  std::atomic<size_t> m_eventsCount = 0;
+
+  ScLoadHistograms m_histograms;
+  size_t m_failedCount = 0;
+
+  sc_bool RunOperation(ScLoadOperation operation)
+  {
+    switch (operation)
+    {
+    case ScLoadOperation::Generate:
+      return Request(
+          "create_elements",
+          ScMemoryJsonPayload::array({
+              {{"el", "node"}, {"type", *ScType::ConstNode}},
+              {{"el", "edge"},
+               {"src", {{"type", "addr"}, {"value", m_hubAddr.Hash()}}},
+               {"trg", {{"type", "ref"}, {"value", 0}}},
+               {"type", *ScType::ConstPermPosArc}},
+          }));
+    case ScLoadOperation::SearchTemplate:
+      return Request(
+          "search_template",
+          ScMemoryJsonPayload::array({
+              {
+                  {{"type", "addr"}, {"value", m_hubAddr.Hash()}},
+                  {{"type", "type"}, {"value", *ScType::VarPermPosArc}},
+                  {{"type", "type"}, {"value", *ScType::VarNode}},
+              },
+          }));
+    case ScLoadOperation::Content:
+      return Request(
+          "content",
+          ScMemoryJsonPayload::array({
+              {{"command", "set"}, {"type", "string"}, {"data", "load"}, {"addr", m_linkAddr.Hash()}},
+              {{"command", "get"}, {"addr", m_linkAddr.Hash()}},
+          }));
+    case ScLoadOperation::Events:
+    {
+      // Subscription is removed at once, so only cost of subscribing is measured
+      ScMemoryJsonPayload const & payload = {
+          {"create",
+           ScMemoryJsonPayload::array({{{"type", "sc_event_before_erase_element"}, {"addr", m_linkAddr.Hash()}}})}};
+      ScMemoryJsonPayload response;
+      if (!Request("events", payload, &response))
+        return SC_FALSE;
+      return Request("events", {{"delete", response}});
+    }
+    default:
+      return SC_FALSE;
+    }
+  }
+
+  sc_bool Request(
+      std::string const & type,
+      ScMemoryJsonPayload const & payload,
+      ScMemoryJsonPayload * response = nullptr)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    size_t const id = ++m_requestId;
+    m_responsePayload = nullptr;
+
+    ScClientErrorCode code;
+    m_instance.send(m_connection, ScMemoryJsonConverter::From(id, type, payload), ScServerMessageType::text, code);
+    if (code)
+      return SC_FALSE;
+
+    sc_bool const isResponded = m_cond.wait_for(
+        lock,
+        kResponseTimeout,
+        [this, id]
+        {
+          return m_respondedId == id;
+        });
+    if (!isResponded || !m_responseStatus)
+      return SC_FALSE;
+
+    if (response != nullptr)
+      *response = std::move(m_responsePayload);
+    return SC_TRUE;
+  }
+
+  void OnOpen(ScServerSessionId const &)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isOpened = SC_TRUE;
+    }
+    m_cond.notify_all();
+  }
+
+  void OnMessage(ScServerSessionId const &, ScServerMessage const & msg)
+  {
+    ScMemoryJsonPayload message = ScMemoryJsonPayload::parse(msg->get_payload(), nullptr, false);
+
+    // Batched sc-events messages are sent as array
+    if (message.is_array())
+    {
+      m_eventsCount += message.size();
+      return;
+    }
+
+    if (!message.is_object() || !message.contains("id"))
+      return;
+
+    if (message.value("event", false))
+    {
+      ++m_eventsCount;
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_respondedId = message["id"].get<size_t>();
+      m_responseStatus = message["status"].get<sc_bool>();
+      m_responsePayload = std::move(message["payload"]);
+    }
+    m_cond.notify_all();
+  }
+};
@@ -105,6 +105,11 @@ BENCHMARK_TEMPLATE(BM_ServerThreaded, TestGenerateNode)
     ->Iterations(kNodeIters / 32)
     ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+BENCHMARK_TEMPLATE(BM_ServerThreaded, TestGenerateNode)
+    ->Threads(64)
+    ->Iterations(kNodeIters / 64)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
 sc_int constexpr kLinkIters = 100;
 
 BENCHMARK_TEMPLATE(BM_ServerThreaded, TestGenerateLink)
@@ -137,6 +142,11 @@ BENCHMARK_TEMPLATE(BM_ServerThreaded, TestGenerateLink)
     ->Iterations(kLinkIters / 32)
     ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+BENCHMARK_TEMPLATE(BM_ServerThreaded, TestGenerateLink)
+    ->Threads(64)
+    ->Iterations(kLinkIters / 64)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
 // ------------------------------------
 template <class BMType>
 void BM_ServerRanged(benchmark::State & state)